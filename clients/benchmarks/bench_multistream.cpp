@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_multistream.hpp"
+#include "bench_problem.hpp"
+#include "rocblas_test.hpp"
+#include "singletons.hpp"
+#include "timing_statistics.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+
+namespace
+{
+    struct entry_samples
+    {
+        std::vector<double> latency_us;
+        double              host_us = 0;
+    };
+
+    // The handle and operands outlive the worker, since freeing device memory synchronizes the
+    // device and would stall the workers still running
+    struct worker_result
+    {
+        rocblas_handle                                      handle = nullptr;
+        std::vector<std::unique_ptr<rocblas_bench_problem>> problems;
+        std::vector<entry_samples>                          entries;
+        std::vector<std::string>                            names;
+        std::vector<double>                                 gflop;
+        size_t                                              calls = 0;
+    };
+
+    // Releases the workers together once all of them have finished their cold passes
+    class start_gate
+    {
+        std::mutex              m_mutex;
+        std::condition_variable m_cv;
+        int                     m_ready = 0;
+        bool                    m_open  = false;
+
+    public:
+        void arrive_and_wait()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ready++;
+            m_cv.notify_all();
+            m_cv.wait(lock, [&] { return m_open; });
+        }
+
+        void wait_for(int workers)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&] { return m_ready == workers; });
+        }
+
+        void open()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_open = true;
+            m_cv.notify_all();
+        }
+    };
+
+    void run_worker(int                                      device,
+                    int                                      index,
+                    hipStream_t                              stream,
+                    const rocblas_bench_multistream_options& opt,
+                    const std::vector<Arguments>&            workload,
+                    start_gate&                              gate,
+                    worker_result&                           result)
+    {
+        CHECK_HIP_ERROR(hipSetDevice(device));
+
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&result.handle));
+        rocblas_handle handle = result.handle;
+        CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+        CHECK_ROCBLAS_ERROR(rocblas_set_performance_metric(handle, opt.performance_metric));
+
+        auto& problems = result.problems;
+        for(const auto& arg : workload)
+        {
+            problems.push_back(rocblas_bench_make_problem(arg));
+            result.names.push_back(problems.back()->name());
+            result.gflop.push_back(problems.back()->gflop());
+        }
+
+        size_t n = problems.size();
+        for(int pass = 0; pass < opt.cold_iters; pass++)
+            for(size_t e = 0; e < n; e++)
+                CHECK_ROCBLAS_ERROR(problems[(index + pass + e) % n]->run(handle));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        result.entries.assign(n, entry_samples{});
+
+        rocblas_bench_event_ring ring(stream, [&](size_t entry, double us) {
+            result.entries[entry].latency_us.push_back(us);
+        });
+
+        gate.arrive_and_wait();
+
+        double start_us = get_time_us_no_sync();
+        for(int pass = 0; opt.duration > 0 || pass < opt.iters; pass++)
+        {
+            if(opt.duration > 0 && get_time_us_no_sync() - start_us >= opt.duration * 1e6)
+                break;
+
+            for(size_t e = 0; e < n; e++)
+            {
+                size_t entry = (index + pass + e) % n;
+                ring.start(entry);
+
+                double host_us = get_time_us_no_sync();
+                CHECK_ROCBLAS_ERROR(problems[entry]->run(handle));
+                result.entries[entry].host_us += get_time_us_no_sync() - host_us;
+
+                ring.stop();
+                result.calls++;
+            }
+        }
+        ring.drain();
+    }
+
+    void print_latency(const char* prefix, std::vector<double>& latency_us)
+    {
+        std::sort(latency_us.begin(), latency_us.end());
+        double mean = latency_us.empty()
+                          ? 0
+                          : std::accumulate(latency_us.begin(), latency_us.end(), 0.0)
+                                / latency_us.size();
+        rocblas_cout << prefix << mean << ',' << rocblas_timing_percentile(latency_us, 0.5) << ','
+                     << rocblas_timing_percentile(latency_us, 0.9) << ','
+                     << rocblas_timing_percentile(latency_us, 0.99);
+    }
+}
+
+bool rocblas_bench_parse_performance_metric(const std::string&          str,
+                                            rocblas_performance_metric& metric)
+{
+    if(str == "default")
+        metric = rocblas_default_performance_metric;
+    else if(str == "device_efficiency")
+        metric = rocblas_device_efficiency_performance_metric;
+    else if(str == "cu_efficiency")
+        metric = rocblas_cu_efficiency_performance_metric;
+    else
+        return false;
+    return true;
+}
+
+int rocblas_bench_run_multistream(const rocblas_bench_multistream_options& opt,
+                                  const std::vector<Arguments>&            workload)
+{
+    if(workload.empty())
+    {
+        rocblas_cerr << "rocblas-bench: the workload has no problems" << std::endl;
+        return 1;
+    }
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    int workers = opt.streams * opt.handles_per_stream;
+
+    std::vector<hipStream_t> streams(opt.streams);
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    std::vector<worker_result> results(workers);
+    std::vector<std::thread>   threads;
+    start_gate                 gate;
+
+    for(int w = 0; w < workers; w++)
+        threads.emplace_back(run_worker,
+                             device,
+                             w,
+                             streams[w / opt.handles_per_stream],
+                             std::cref(opt),
+                             std::cref(workload),
+                             std::ref(gate),
+                             std::ref(results[w]));
+
+    gate.wait_for(workers);
+    double wall_us = get_time_us_no_sync();
+    gate.open();
+
+    for(auto& thread : threads)
+        thread.join();
+    wall_us = get_time_us_no_sync() - wall_us;
+
+    for(auto& r : results)
+    {
+        r.problems.clear();
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(r.handle));
+    }
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // Merge the samples of all workers per entry
+    size_t                     calls = 0;
+    double                     gflop = 0;
+    std::vector<entry_samples> entries(workload.size());
+    std::vector<double>        all_latency_us;
+    for(const auto& r : results)
+    {
+        calls += r.calls;
+        for(size_t i = 0; i < entries.size(); i++)
+        {
+            const auto& e = r.entries[i];
+            gflop += r.gflop[i] * e.latency_us.size();
+            entries[i].host_us += e.host_us;
+            entries[i].latency_us.insert(
+                entries[i].latency_us.end(), e.latency_us.begin(), e.latency_us.end());
+        }
+    }
+    const auto& names = results[0].names;
+
+    rocblas_cout << std::fixed << std::setprecision(3);
+    rocblas_cout << "streams,handles_per_stream,calls,wall_us,calls_per_s,aggregate-Gflops,"
+                    "latency_mean_us,latency_p50_us,latency_p90_us,latency_p99_us"
+                 << std::endl;
+
+    for(auto& e : entries)
+        all_latency_us.insert(all_latency_us.end(), e.latency_us.begin(), e.latency_us.end());
+    rocblas_cout << opt.streams << ',' << opt.handles_per_stream << ',' << calls << ',' << wall_us
+                 << ',' << calls / wall_us * 1e6 << ',' << gflop / wall_us * 1e6;
+    print_latency(",", all_latency_us);
+    rocblas_cout << std::endl << std::endl;
+
+    rocblas_cout << "entry,problem,calls,host_us_mean,latency_mean_us,latency_p50_us,"
+                    "latency_p90_us,latency_p99_us"
+                 << std::endl;
+    for(size_t i = 0; i < entries.size(); i++)
+    {
+        auto&  e     = entries[i];
+        size_t count = e.latency_us.size();
+        rocblas_cout << i << ',' << names[i] << ',' << count << ','
+                     << (count ? e.host_us / count : 0);
+        print_latency(",", e.latency_us);
+        rocblas_cout << std::endl;
+    }
+
+    return 0;
+}
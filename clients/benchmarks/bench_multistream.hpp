@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocblas_arguments.hpp"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Concurrent multi-stream workload mode of rocblas-bench
+ *
+ * A host thread per handle submits the workload problems, with handles_per_stream handles
+ * sharing each of the streams, as a server issuing many small calls concurrently on one
+ * device would. Each thread owns its own copy of the operands.
+ */
+
+/*! \brief rocblas-bench multi-stream options, set from the command line */
+struct rocblas_bench_multistream_options
+{
+    int                        streams            = 0; // 0 disables the mode
+    int                        handles_per_stream = 1;
+    int                        iters              = 10; // timed passes over the workload
+    int                        cold_iters         = 2; // untimed passes before timing starts
+    double                     duration           = 0; // seconds, 0 runs iters passes
+    rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
+};
+
+/*! \brief Parse "default", "device_efficiency" or "cu_efficiency", returning false otherwise */
+bool rocblas_bench_parse_performance_metric(const std::string&          str,
+                                            rocblas_performance_metric& metric);
+
+/*! \brief Run the workload concurrently on the current device.
+
+    Every thread makes passes over the workload, starting each pass at a different entry so
+    that the threads do not issue the same problem in lockstep. Prints the aggregate throughput
+    over the wall time of the timed passes, and the per-call latency of each entry, measured
+    with events around each call on its stream. Returns non-zero on failure.
+*/
+int rocblas_bench_run_multistream(const rocblas_bench_multistream_options& opt,
+                                  const std::vector<Arguments>&            workload);
@@ -0,0 +1,696 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_problem.hpp"
+#include "flops.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "singletons.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Device memory from the rocblas-bench allocator, so that repeated workloads reuse blocks
+    class device_buffer
+    {
+        void* m_ptr = nullptr;
+
+    public:
+        device_buffer() = default;
+
+        explicit device_buffer(size_t bytes)
+        {
+            if(bytes)
+                CHECK_HIP_ERROR(d_vector_malloc(&m_ptr, bytes));
+        }
+
+        ~device_buffer()
+        {
+            if(m_ptr)
+                CHECK_HIP_ERROR(d_vector_free(m_ptr));
+        }
+
+        device_buffer(device_buffer&& other) noexcept
+            : m_ptr(other.m_ptr)
+        {
+            other.m_ptr = nullptr;
+        }
+
+        device_buffer& operator=(device_buffer&& other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            return *this;
+        }
+
+        void* get() const
+        {
+            return m_ptr;
+        }
+    };
+
+    template <typename T>
+    device_buffer random_buffer(size_t n)
+    {
+        std::vector<T> h(n);
+        for(auto& v : h)
+            v = random_generator<T>();
+
+        device_buffer d(n * sizeof(T));
+        if(n)
+            CHECK_HIP_ERROR(hipMemcpy(d.get(), h.data(), n * sizeof(T), hipMemcpyHostToDevice));
+        return d;
+    }
+
+    device_buffer random_buffer(rocblas_datatype type, size_t n)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+            return random_buffer<rocblas_half>(n);
+        case rocblas_datatype_bf16_r:
+            return random_buffer<rocblas_bfloat16>(n);
+        case rocblas_datatype_f32_r:
+            return random_buffer<float>(n);
+        case rocblas_datatype_f64_r:
+            return random_buffer<double>(n);
+        case rocblas_datatype_f32_c:
+            return random_buffer<rocblas_float_complex>(n);
+        case rocblas_datatype_f64_c:
+            return random_buffer<rocblas_double_complex>(n);
+        case rocblas_datatype_i8_r:
+            return random_buffer<int8_t>(n);
+        case rocblas_datatype_i32_r:
+            return random_buffer<int32_t>(n);
+        default:
+            throw std::invalid_argument(std::string("Unsupported datatype in workload: ")
+                                        + rocblas_datatype2string(type));
+        }
+    }
+
+    // Triangular matrices are made diagonally dominant so that repeated solves stay finite
+    template <typename T>
+    device_buffer triangular_buffer(int64_t k, int64_t lda, int64_t stride, int64_t batch_count)
+    {
+        size_t         n = size_t(stride) * (batch_count - 1) + size_t(lda) * k;
+        std::vector<T> h(n, T(0));
+        for(int64_t b = 0; b < batch_count; b++)
+            for(int64_t j = 0; j < k; j++)
+                for(int64_t i = 0; i < k; i++)
+                    h[b * stride + j * lda + i] = i == j ? T(k + 1) : random_generator<T>() / T(k);
+
+        device_buffer d(n * sizeof(T));
+        CHECK_HIP_ERROR(hipMemcpy(d.get(), h.data(), n * sizeof(T), hipMemcpyHostToDevice));
+        return d;
+    }
+
+    size_t strided_size(int64_t ld, int64_t cols, rocblas_stride stride, int64_t batch_count)
+    {
+        return size_t(stride) * (batch_count - 1) + size_t(ld) * cols;
+    }
+
+    bool is_strided_batched(const Arguments& arg)
+    {
+        return strstr(arg.function, "_strided_batched") != nullptr;
+    }
+
+    // Raise leading dimensions and strides to their minimum, so workload files may omit them
+    void set_minimum_dimensions(Arguments& arg)
+    {
+        const std::string function = arg.function;
+
+        if(!is_strided_batched(arg))
+            arg.batch_count = 1;
+
+        if(function.rfind("gemm", 0) == 0)
+        {
+            int64_t rows_a = arg.transA == 'N' ? arg.M : arg.K;
+            int64_t cols_a = arg.transA == 'N' ? arg.K : arg.M;
+            int64_t rows_b = arg.transB == 'N' ? arg.K : arg.N;
+            int64_t cols_b = arg.transB == 'N' ? arg.N : arg.K;
+
+            arg.lda      = std::max<int64_t>({arg.lda, rows_a, 1});
+            arg.ldb      = std::max<int64_t>({arg.ldb, rows_b, 1});
+            arg.ldc      = std::max<int64_t>({arg.ldc, arg.M, 1});
+            arg.ldd      = std::max<int64_t>({arg.ldd, arg.M, 1});
+            arg.stride_a = std::max<rocblas_stride>(arg.stride_a, arg.lda * cols_a);
+            arg.stride_b = std::max<rocblas_stride>(arg.stride_b, arg.ldb * cols_b);
+            arg.stride_c = std::max<rocblas_stride>(arg.stride_c, arg.ldc * arg.N);
+            arg.stride_d = std::max<rocblas_stride>(arg.stride_d, arg.ldd * arg.N);
+        }
+        else if(function.rfind("gemv", 0) == 0)
+        {
+            int64_t dim_x = arg.transA == 'N' ? arg.N : arg.M;
+            int64_t dim_y = arg.transA == 'N' ? arg.M : arg.N;
+
+            if(!arg.incx)
+                arg.incx = 1;
+            if(!arg.incy)
+                arg.incy = 1;
+
+            arg.lda      = std::max<int64_t>({arg.lda, arg.M, 1});
+            arg.stride_a = std::max<rocblas_stride>(arg.stride_a, arg.lda * arg.N);
+            arg.stride_x = std::max<rocblas_stride>(arg.stride_x, dim_x * std::abs(arg.incx));
+            arg.stride_y = std::max<rocblas_stride>(arg.stride_y, dim_y * std::abs(arg.incy));
+        }
+        else if(function.rfind("trsm", 0) == 0)
+        {
+            int64_t k = arg.side == 'L' ? arg.M : arg.N;
+
+            arg.lda      = std::max<int64_t>({arg.lda, k, 1});
+            arg.ldb      = std::max<int64_t>({arg.ldb, arg.M, 1});
+            arg.stride_a = std::max<rocblas_stride>(arg.stride_a, arg.lda * k);
+            arg.stride_b = std::max<rocblas_stride>(arg.stride_b, arg.ldb * arg.N);
+        }
+    }
+
+    template <typename T>
+    class gemm_problem : public rocblas_bench_problem
+    {
+        device_buffer m_A, m_B, m_C;
+        T             m_alpha, m_beta;
+
+    public:
+        explicit gemm_problem(const Arguments& arg)
+            : rocblas_bench_problem(arg)
+            , m_alpha(m_arg.get_alpha<T>())
+            , m_beta(m_arg.get_beta<T>())
+        {
+            const auto& a = m_arg;
+            m_A = random_buffer<T>(
+                strided_size(a.lda, a.transA == 'N' ? a.K : a.M, a.stride_a, a.batch_count));
+            m_B = random_buffer<T>(
+                strided_size(a.ldb, a.transB == 'N' ? a.N : a.K, a.stride_b, a.batch_count));
+            m_C     = random_buffer<T>(strided_size(a.ldc, a.N, a.stride_c, a.batch_count));
+            m_gflop = gemm_gflop_count<T>(a.M, a.N, a.K) * a.batch_count;
+        }
+
+        rocblas_status run(rocblas_handle handle) override
+        {
+            const auto& a      = m_arg;
+            auto        transA = char2rocblas_operation(a.transA);
+            auto        transB = char2rocblas_operation(a.transB);
+            auto        A      = static_cast<const T*>(m_A.get());
+            auto        B      = static_cast<const T*>(m_B.get());
+            auto        C      = static_cast<T*>(m_C.get());
+
+            if(is_strided_batched(a))
+                return rocblas_gemm_strided_batched<T>(handle,
+                                                       transA,
+                                                       transB,
+                                                       a.M,
+                                                       a.N,
+                                                       a.K,
+                                                       &m_alpha,
+                                                       A,
+                                                       a.lda,
+                                                       a.stride_a,
+                                                       B,
+                                                       a.ldb,
+                                                       a.stride_b,
+                                                       &m_beta,
+                                                       C,
+                                                       a.ldc,
+                                                       a.stride_c,
+                                                       a.batch_count);
+
+            return rocblas_gemm<T>(
+                handle, transA, transB, a.M, a.N, a.K, &m_alpha, A, a.lda, B, a.ldb, &m_beta, C, a.ldc);
+        }
+    };
+
+    class gemm_ex_problem : public rocblas_bench_problem
+    {
+        device_buffer m_A, m_B, m_C, m_D;
+
+        // alpha and beta in compute_type
+        alignas(16) char m_alpha[16];
+        alignas(16) char m_beta[16];
+
+        template <typename T>
+        void set_scalars()
+        {
+            static_assert(sizeof(T) <= sizeof(m_alpha), "scalar too large");
+            T alpha = m_arg.get_alpha<T>();
+            T beta  = m_arg.get_beta<T>();
+            memcpy(m_alpha, &alpha, sizeof(T));
+            memcpy(m_beta, &beta, sizeof(T));
+        }
+
+    public:
+        explicit gemm_ex_problem(const Arguments& arg)
+            : rocblas_bench_problem(arg)
+        {
+            const auto& a = m_arg;
+            switch(a.compute_type)
+            {
+            case rocblas_datatype_f16_r:
+                set_scalars<rocblas_half>();
+                break;
+            case rocblas_datatype_f32_r:
+                set_scalars<float>();
+                break;
+            case rocblas_datatype_f64_r:
+                set_scalars<double>();
+                break;
+            case rocblas_datatype_f32_c:
+                set_scalars<rocblas_float_complex>();
+                break;
+            case rocblas_datatype_f64_c:
+                set_scalars<rocblas_double_complex>();
+                break;
+            case rocblas_datatype_i32_r:
+                set_scalars<int32_t>();
+                break;
+            default:
+                throw std::invalid_argument(std::string("Unsupported compute_type in workload: ")
+                                            + rocblas_datatype2string(a.compute_type));
+            }
+
+            m_A = random_buffer(
+                a.a_type,
+                strided_size(a.lda, a.transA == 'N' ? a.K : a.M, a.stride_a, a.batch_count));
+            m_B = random_buffer(
+                a.b_type,
+                strided_size(a.ldb, a.transB == 'N' ? a.N : a.K, a.stride_b, a.batch_count));
+            m_C = random_buffer(a.c_type, strided_size(a.ldc, a.N, a.stride_c, a.batch_count));
+            if(a.outofplace)
+                m_D = random_buffer(a.d_type, strided_size(a.ldd, a.N, a.stride_d, a.batch_count));
+
+            bool is_complex = a.compute_type == rocblas_datatype_f32_c
+                              || a.compute_type == rocblas_datatype_f64_c;
+            m_gflop = (is_complex ? gemm_gflop_count<rocblas_float_complex>(a.M, a.N, a.K)
+                                  : gemm_gflop_count<float>(a.M, a.N, a.K))
+                      * a.batch_count;
+        }
+
+        rocblas_status run(rocblas_handle handle) override
+        {
+            const auto& a      = m_arg;
+            auto        transA = char2rocblas_operation(a.transA);
+            auto        transB = char2rocblas_operation(a.transB);
+            void*       D      = a.outofplace ? m_D.get() : m_C.get();
+            auto        ldd    = a.outofplace ? a.ldd : a.ldc;
+            auto        sd     = a.outofplace ? a.stride_d : a.stride_c;
+
+            if(is_strided_batched(a))
+                return rocblas_gemm_strided_batched_ex(handle,
+                                                       transA,
+                                                       transB,
+                                                       a.M,
+                                                       a.N,
+                                                       a.K,
+                                                       m_alpha,
+                                                       m_A.get(),
+                                                       a.a_type,
+                                                       a.lda,
+                                                       a.stride_a,
+                                                       m_B.get(),
+                                                       a.b_type,
+                                                       a.ldb,
+                                                       a.stride_b,
+                                                       m_beta,
+                                                       m_C.get(),
+                                                       a.c_type,
+                                                       a.ldc,
+                                                       a.stride_c,
+                                                       D,
+                                                       a.d_type,
+                                                       ldd,
+                                                       sd,
+                                                       a.batch_count,
+                                                       a.compute_type,
+                                                       rocblas_gemm_algo(a.algo),
+                                                       a.solution_index,
+                                                       a.flags);
+
+            return rocblas_gemm_ex(handle,
+                                   transA,
+                                   transB,
+                                   a.M,
+                                   a.N,
+                                   a.K,
+                                   m_alpha,
+                                   m_A.get(),
+                                   a.a_type,
+                                   a.lda,
+                                   m_B.get(),
+                                   a.b_type,
+                                   a.ldb,
+                                   m_beta,
+                                   m_C.get(),
+                                   a.c_type,
+                                   a.ldc,
+                                   D,
+                                   a.d_type,
+                                   ldd,
+                                   a.compute_type,
+                                   rocblas_gemm_algo(a.algo),
+                                   a.solution_index,
+                                   a.flags);
+        }
+    };
+
+    template <typename T>
+    class gemv_problem : public rocblas_bench_problem
+    {
+        device_buffer m_A, m_x, m_y;
+        T             m_alpha, m_beta;
+
+    public:
+        explicit gemv_problem(const Arguments& arg)
+            : rocblas_bench_problem(arg)
+            , m_alpha(m_arg.get_alpha<T>())
+            , m_beta(m_arg.get_beta<T>())
+        {
+            const auto& a     = m_arg;
+            int64_t     dim_x = a.transA == 'N' ? a.N : a.M;
+            int64_t     dim_y = a.transA == 'N' ? a.M : a.N;
+
+            m_A = random_buffer<T>(strided_size(a.lda, a.N, a.stride_a, a.batch_count));
+            m_x = random_buffer<T>(strided_size(std::abs(a.incx), dim_x, a.stride_x, a.batch_count));
+            m_y = random_buffer<T>(strided_size(std::abs(a.incy), dim_y, a.stride_y, a.batch_count));
+            m_gflop = gemv_gflop_count<T>(char2rocblas_operation(a.transA), a.M, a.N) * a.batch_count;
+        }
+
+        rocblas_status run(rocblas_handle handle) override
+        {
+            const auto& a      = m_arg;
+            auto        transA = char2rocblas_operation(a.transA);
+            auto        A      = static_cast<const T*>(m_A.get());
+            auto        x      = static_cast<const T*>(m_x.get());
+            auto        y      = static_cast<T*>(m_y.get());
+
+            if(is_strided_batched(a))
+                return rocblas_gemv_strided_batched<T>(handle,
+                                                       transA,
+                                                       a.M,
+                                                       a.N,
+                                                       &m_alpha,
+                                                       A,
+                                                       a.lda,
+                                                       a.stride_a,
+                                                       x,
+                                                       a.incx,
+                                                       a.stride_x,
+                                                       &m_beta,
+                                                       y,
+                                                       a.incy,
+                                                       a.stride_y,
+                                                       a.batch_count);
+
+            return rocblas_gemv<T>(
+                handle, transA, a.M, a.N, &m_alpha, A, a.lda, x, a.incx, &m_beta, y, a.incy);
+        }
+    };
+
+    template <typename T>
+    class trsm_problem : public rocblas_bench_problem
+    {
+        device_buffer m_A, m_B;
+        T             m_alpha;
+
+    public:
+        explicit trsm_problem(const Arguments& arg)
+            : rocblas_bench_problem(arg)
+            , m_alpha(m_arg.get_alpha<T>())
+        {
+            const auto& a = m_arg;
+            int64_t     k = a.side == 'L' ? a.M : a.N;
+
+            m_A     = triangular_buffer<T>(k, a.lda, a.stride_a, a.batch_count);
+            m_B     = random_buffer<T>(strided_size(a.ldb, a.N, a.stride_b, a.batch_count));
+            m_gflop = trsm_gflop_count<T>(a.M, a.N, k) * a.batch_count;
+        }
+
+        rocblas_status run(rocblas_handle handle) override
+        {
+            const auto& a      = m_arg;
+            auto        side   = char2rocblas_side(a.side);
+            auto        uplo   = char2rocblas_fill(a.uplo);
+            auto        transA = char2rocblas_operation(a.transA);
+            auto        diag   = char2rocblas_diagonal(a.diag);
+            auto        A      = static_cast<T*>(m_A.get());
+            auto        B      = static_cast<T*>(m_B.get());
+
+            if(is_strided_batched(a))
+                return rocblas_trsm_strided_batched<T>(handle,
+                                                       side,
+                                                       uplo,
+                                                       transA,
+                                                       diag,
+                                                       a.M,
+                                                       a.N,
+                                                       &m_alpha,
+                                                       A,
+                                                       a.lda,
+                                                       a.stride_a,
+                                                       B,
+                                                       a.ldb,
+                                                       a.stride_b,
+                                                       a.batch_count);
+
+            return rocblas_trsm<T>(
+                handle, side, uplo, transA, diag, a.M, a.N, &m_alpha, A, a.lda, B, a.ldb);
+        }
+    };
+
+    enum class problem_family
+    {
+        unsupported,
+        gemm,
+        gemm_ex,
+        gemv,
+        trsm
+    };
+
+    problem_family family(const Arguments& arg)
+    {
+        static const struct
+        {
+            const char*    function;
+            problem_family family;
+        } functions[] = {{"gemm", problem_family::gemm},
+                         {"gemm_strided_batched", problem_family::gemm},
+                         {"gemm_ex", problem_family::gemm_ex},
+                         {"gemm_strided_batched_ex", problem_family::gemm_ex},
+                         {"gemv", problem_family::gemv},
+                         {"gemv_strided_batched", problem_family::gemv},
+                         {"trsm", problem_family::trsm},
+                         {"trsm_strided_batched", problem_family::trsm}};
+
+        for(const auto& f : functions)
+            if(!strcmp(arg.function, f.function))
+                return f.family;
+        return problem_family::unsupported;
+    }
+
+    bool typed_precision(const Arguments& arg)
+    {
+        switch(arg.a_type)
+        {
+        case rocblas_datatype_f16_r:
+            return family(arg) == problem_family::gemm;
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_f64_c:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <template <typename> class PROBLEM, bool HALF = false>
+    std::unique_ptr<rocblas_bench_problem> make_typed(const Arguments& arg)
+    {
+        switch(arg.a_type)
+        {
+        case rocblas_datatype_f32_r:
+            return std::make_unique<PROBLEM<float>>(arg);
+        case rocblas_datatype_f64_r:
+            return std::make_unique<PROBLEM<double>>(arg);
+        case rocblas_datatype_f32_c:
+            return std::make_unique<PROBLEM<rocblas_float_complex>>(arg);
+        case rocblas_datatype_f64_c:
+            return std::make_unique<PROBLEM<rocblas_double_complex>>(arg);
+        default:
+            if constexpr(HALF)
+                return std::make_unique<PROBLEM<rocblas_half>>(arg);
+            return nullptr;
+        }
+    }
+
+    // Types of the gemm_ex operands and scalars which random_buffer and gemm_ex_problem handle
+    bool ex_operand_type(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_f64_c:
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_i32_r:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool ex_compute_type(rocblas_datatype type)
+    {
+        return type != rocblas_datatype_bf16_r && type != rocblas_datatype_i8_r
+               && ex_operand_type(type);
+    }
+}
+
+rocblas_bench_event_ring::rocblas_bench_event_ring(hipStream_t stream, sink done, size_t size)
+    : m_stream(stream)
+    , m_done(std::move(done))
+    , m_start(size)
+    , m_stop(size)
+    , m_tag(size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        CHECK_HIP_ERROR(hipEventCreate(&m_start[i]));
+        CHECK_HIP_ERROR(hipEventCreate(&m_stop[i]));
+    }
+}
+
+rocblas_bench_event_ring::~rocblas_bench_event_ring()
+{
+    for(size_t i = 0; i < m_start.size(); i++)
+    {
+        CHECK_HIP_ERROR(hipEventDestroy(m_start[i]));
+        CHECK_HIP_ERROR(hipEventDestroy(m_stop[i]));
+    }
+}
+
+void rocblas_bench_event_ring::complete(size_t slot)
+{
+    float ms = 0;
+    CHECK_HIP_ERROR(hipEventSynchronize(m_stop[slot]));
+    CHECK_HIP_ERROR(hipEventElapsedTime(&ms, m_start[slot], m_stop[slot]));
+    m_done(m_tag[slot], ms * 1000.0);
+    m_completed++;
+}
+
+void rocblas_bench_event_ring::start(size_t tag)
+{
+    size_t slot = m_calls % m_start.size();
+    if(m_calls - m_completed == m_start.size())
+        complete(slot);
+
+    m_tag[slot] = tag;
+    CHECK_HIP_ERROR(hipEventRecord(m_start[slot], m_stream));
+}
+
+void rocblas_bench_event_ring::stop()
+{
+    CHECK_HIP_ERROR(hipEventRecord(m_stop[m_calls % m_stop.size()], m_stream));
+    m_calls++;
+}
+
+void rocblas_bench_event_ring::drain()
+{
+    while(m_completed < m_calls)
+        complete(m_completed % m_start.size());
+}
+
+rocblas_bench_problem::rocblas_bench_problem(const Arguments& arg)
+    : m_arg(arg)
+{
+}
+
+std::string rocblas_bench_problem::name() const
+{
+    const auto&        a = m_arg;
+    std::ostringstream name;
+
+    name << a.function << ' ' << rocblas_datatype2string(a.a_type) << ' ';
+    if(family(a) == problem_family::trsm)
+        name << a.side << a.uplo << a.transA << a.diag << ' ' << a.M << 'x' << a.N;
+    else if(family(a) == problem_family::gemv)
+        name << a.transA << ' ' << a.M << 'x' << a.N;
+    else
+        name << a.transA << a.transB << ' ' << a.M << 'x' << a.N << 'x' << a.K;
+    if(is_strided_batched(a))
+        name << " batch " << a.batch_count;
+    return name.str();
+}
+
+void rocblas_bench_check_problem(const Arguments& arg)
+{
+    auto f = family(arg);
+    if(f == problem_family::unsupported)
+        throw std::invalid_argument(std::string("Unsupported function in workload: ")
+                                    + arg.function);
+
+    bool precision = f == problem_family::gemm_ex
+                         ? ex_operand_type(arg.a_type) && ex_operand_type(arg.b_type)
+                               && ex_operand_type(arg.c_type) && ex_operand_type(arg.d_type)
+                               && ex_compute_type(arg.compute_type)
+                         : typed_precision(arg);
+    if(!precision)
+        throw std::invalid_argument(std::string("Unsupported precision in workload: ")
+                                    + arg.function + " " + rocblas_datatype2string(arg.a_type));
+
+    constexpr int64_t max = std::numeric_limits<rocblas_int>::max();
+    for(int64_t v : {arg.M, arg.N, arg.K, arg.lda, arg.ldb, arg.ldc, arg.ldd, arg.batch_count})
+        if(v > max)
+            throw std::invalid_argument(std::string("Workload sizes of ") + arg.function
+                                        + " must fit in rocblas_int");
+}
+
+std::unique_ptr<rocblas_bench_problem> rocblas_bench_make_problem(const Arguments& arg)
+{
+    Arguments a(arg);
+    set_minimum_dimensions(a);
+
+    switch(family(a))
+    {
+    case problem_family::gemm:
+        return make_typed<gemm_problem, true>(a);
+    case problem_family::gemm_ex:
+        return std::make_unique<gemm_ex_problem>(a);
+    case problem_family::gemv:
+        return make_typed<gemv_problem>(a);
+    case problem_family::trsm:
+        return make_typed<trsm_problem>(a);
+    case problem_family::unsupported:
+        break;
+    }
+    return nullptr;
+}
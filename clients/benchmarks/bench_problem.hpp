@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocblas_arguments.hpp"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Preallocated problems for the workload modes of rocblas-bench
+ *
+ * The workload modes issue many different problems back to back, or concurrently from several
+ * handles, so each problem owns its device operands and only enqueues the rocBLAS call when it
+ * is run. Results are not checked.
+ */
+
+/*! \brief A rocBLAS call with its device operands allocated and initialized */
+class rocblas_bench_problem
+{
+public:
+    explicit rocblas_bench_problem(const Arguments& arg);
+    virtual ~rocblas_bench_problem() = default;
+
+    rocblas_bench_problem(const rocblas_bench_problem&) = delete;
+    rocblas_bench_problem& operator=(const rocblas_bench_problem&) = delete;
+
+    /*! \brief Enqueue the call on the stream of handle, which must be in host pointer mode */
+    virtual rocblas_status run(rocblas_handle handle) = 0;
+
+    const Arguments& arguments() const
+    {
+        return m_arg;
+    }
+
+    /*! \brief Floating point operations of one call, in units of 10^9 */
+    double gflop() const
+    {
+        return m_gflop;
+    }
+
+    /*! \brief Short description of the problem, e.g. "gemm f32_r NT 128x128x64" */
+    std::string name() const;
+
+protected:
+    Arguments m_arg;
+    double    m_gflop = 0;
+};
+
+/*! \brief Throw std::invalid_argument if the workload modes do not support arg.
+
+    Supported are gemm, gemm_strided_batched, gemm_ex, gemm_strided_batched_ex, gemv,
+    gemv_strided_batched, trsm and trsm_strided_batched, in the precisions of their typed
+    client wrappers, with sizes which fit in rocblas_int.
+*/
+void rocblas_bench_check_problem(const Arguments& arg);
+
+/*! \brief Allocate and initialize the operands of arg on the current device.
+
+    Leading dimensions and strides smaller than the minimum for the problem are raised to it.
+    arg must pass rocblas_bench_check_problem.
+*/
+std::unique_ptr<rocblas_bench_problem> rocblas_bench_make_problem(const Arguments& arg);
+
+/*! \brief Times calls enqueued on a stream with a ring of event pairs.
+
+    A pair is reused once the call timed with it has completed, so up to size calls are queued
+    without synchronizing. The time of each call, in microseconds, is passed to done with the
+    tag given to start once the call has completed.
+*/
+class rocblas_bench_event_ring
+{
+public:
+    using sink = std::function<void(size_t tag, double us)>;
+
+    rocblas_bench_event_ring(hipStream_t stream, sink done, size_t size = 64);
+    ~rocblas_bench_event_ring();
+
+    rocblas_bench_event_ring(const rocblas_bench_event_ring&) = delete;
+    rocblas_bench_event_ring& operator=(const rocblas_bench_event_ring&) = delete;
+
+    // Record the start event of the next call, first waiting for the oldest call if all
+    // pairs are in use
+    void start(size_t tag);
+
+    // Record the stop event of the call
+    void stop();
+
+    // Wait for all calls and pass their times to done
+    void drain();
+
+private:
+    void complete(size_t slot);
+
+    hipStream_t             m_stream;
+    sink                    m_done;
+    std::vector<hipEvent_t> m_start, m_stop;
+    std::vector<size_t>     m_tag;
+    size_t                  m_calls     = 0; // calls started
+    size_t                  m_completed = 0; // calls passed to done
+};
@@ -0,0 +1,282 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_sweep.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "singletons.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    int64_t parse_sweep_value(const std::string& str,
+                              const std::string& spec,
+                              const std::string& option)
+    {
+        char*     end   = nullptr;
+        long long value = str.empty() ? -1 : std::strtoll(str.c_str(), &end, 10);
+        if(value < 0 || *end)
+            throw std::invalid_argument("Invalid value for --" + option + " " + spec);
+        return value;
+    }
+
+    size_t datatype_size(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f8_r:
+        case rocblas_datatype_bf8_r:
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_u8_r:
+            return 1;
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_i8_c:
+        case rocblas_datatype_u8_c:
+            return 2;
+        case rocblas_datatype_f16_c:
+        case rocblas_datatype_bf16_c:
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_i32_r:
+        case rocblas_datatype_u32_r:
+            return 4;
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_i32_c:
+        case rocblas_datatype_u32_c:
+            return 8;
+        case rocblas_datatype_f64_c:
+            return 16;
+        default:
+            return 4;
+        }
+    }
+
+    bool is_gemm(const Arguments& arg)
+    {
+        const char* function = arg.function;
+        if(!strncmp(function, "testing_", 8))
+            function += 8;
+        return !strncmp(function, "gemm", 4) && strncmp(function, "gemmt", 5);
+    }
+
+    // Set the leading dimensions which are not swept and the strides to their minimum
+    void set_minimum_dimensions(Arguments& arg, bool lda_swept, bool ldb_swept, bool ldc_swept)
+    {
+        int64_t rows_a, cols_a, rows_b, cols_b, rows_c, cols_c;
+        if(is_gemm(arg))
+        {
+            rows_a = arg.transA == 'N' ? arg.M : arg.K;
+            cols_a = arg.transA == 'N' ? arg.K : arg.M;
+            rows_b = arg.transB == 'N' ? arg.K : arg.N;
+            cols_b = arg.transB == 'N' ? arg.N : arg.K;
+            rows_c = arg.M;
+            cols_c = arg.N;
+        }
+        else
+        {
+            // Bound the operands of other functions by a square matrix
+            rows_a = cols_a = rows_b = cols_b = rows_c = cols_c
+                = std::max({arg.M, arg.N, arg.K});
+        }
+
+        if(!lda_swept || !arg.lda)
+            arg.lda = std::max<int64_t>(rows_a, 1);
+        if(!ldb_swept || !arg.ldb)
+            arg.ldb = std::max<int64_t>(rows_b, 1);
+        if(!ldc_swept || !arg.ldc)
+            arg.ldc = std::max<int64_t>(rows_c, 1);
+        arg.ldd = arg.ldc;
+
+        int64_t length = std::max(arg.M, arg.N);
+        arg.stride_a   = arg.lda * cols_a;
+        arg.stride_b   = arg.ldb * cols_b;
+        arg.stride_c   = arg.ldc * cols_c;
+        arg.stride_d   = arg.ldd * cols_c;
+        arg.stride_x   = length * std::max<int64_t>(std::abs(arg.incx), 1);
+        arg.stride_y   = length * std::max<int64_t>(std::abs(arg.incy), 1);
+    }
+
+    // Approximate device memory used by a point, to find the one to warm up with
+    double footprint(const Arguments& arg)
+    {
+        double matrices = double(datatype_size(arg.a_type)) * arg.stride_a
+                          + double(datatype_size(arg.b_type)) * arg.stride_b
+                          + double(datatype_size(arg.c_type)) * arg.stride_c
+                          + double(datatype_size(arg.d_type)) * arg.stride_d;
+        double vectors  = double(datatype_size(arg.a_type)) * (arg.stride_x + arg.stride_y);
+        return (matrices + vectors) * std::max<int64_t>(arg.batch_count, 1);
+    }
+
+    template <typename T, typename F>
+    void expand(std::vector<Arguments>& points, const std::vector<T>& values, F set)
+    {
+        if(values.empty())
+            return;
+
+        std::vector<Arguments> expanded;
+        expanded.reserve(points.size() * values.size());
+        for(const auto& point : points)
+            for(const auto& value : values)
+            {
+                expanded.push_back(point);
+                set(expanded.back(), value);
+            }
+        points.swap(expanded);
+    }
+
+    // Disables the device memory cache when a sweep ends
+    struct d_vector_cache_guard
+    {
+        d_vector_cache_guard()
+        {
+            d_vector_set_cache(true);
+        }
+
+        ~d_vector_cache_guard()
+        {
+            d_vector_set_cache(false);
+        }
+    };
+}
+
+std::vector<int64_t> rocblas_bench_parse_sweep(const std::string& spec, const std::string& option)
+{
+    std::vector<int64_t> values;
+    size_t               pos = 0;
+    do
+    {
+        size_t      comma = spec.find(',', pos);
+        std::string item  = spec.substr(pos, comma == std::string::npos ? comma : comma - pos);
+        pos               = comma == std::string::npos ? comma : comma + 1;
+        item.erase(std::remove_if(item.begin(), item.end(), ::isspace), item.end());
+
+        // A '-' after the first character separates the ends of a range
+        size_t dash = item.find('-', 1);
+        if(dash == std::string::npos)
+        {
+            values.push_back(parse_sweep_value(item, spec, option));
+            continue;
+        }
+
+        size_t      colon = item.find(':', dash);
+        std::string step  = colon == std::string::npos ? "1" : item.substr(colon + 1);
+        int64_t     start = parse_sweep_value(item.substr(0, dash), spec, option);
+        int64_t     end   = parse_sweep_value(
+            item.substr(dash + 1, colon == std::string::npos ? colon : colon - dash - 1),
+            spec,
+            option);
+        if(end < start)
+            throw std::invalid_argument("Invalid value for --" + option + " " + spec);
+
+        if(!step.empty() && step[0] == '*')
+        {
+            char*  rest   = nullptr;
+            double factor = std::strtod(step.c_str() + 1, &rest);
+            if(!(factor > 1) || *rest || !start)
+                throw std::invalid_argument("Invalid value for --" + option + " " + spec);
+            for(int64_t v = start; v <= end; v = std::max<int64_t>(v + 1, std::llround(v * factor)))
+                values.push_back(v);
+        }
+        else
+        {
+            int64_t inc = parse_sweep_value(step, spec, option);
+            if(!inc)
+                throw std::invalid_argument("Invalid value for --" + option + " " + spec);
+            for(int64_t v = start; v <= end; v += inc)
+                values.push_back(v);
+        }
+    } while(pos != std::string::npos);
+
+    return values;
+}
+
+bool rocblas_bench_sweep::empty() const
+{
+    return m.empty() && n.empty() && k.empty() && size.empty() && lda.empty() && ldb.empty()
+           && ldc.empty() && batch_count.empty() && transposes.empty() && precisions.empty();
+}
+
+std::vector<Arguments> rocblas_bench_sweep_points(const rocblas_bench_sweep& sweep,
+                                                  const Arguments&           arg)
+{
+    std::vector<Arguments> points{arg};
+
+    expand(points, sweep.precisions, [](Arguments& a, const std::string& precision) {
+        auto prec = string2rocblas_datatype(precision);
+        if(prec == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for --sweep_precisions " + precision);
+        a.a_type = a.b_type = a.c_type = a.d_type = a.compute_type = prec;
+    });
+    expand(points, sweep.transposes, [](Arguments& a, const std::string& trans) {
+        auto valid = [](char c) { return c == 'N' || c == 'T' || c == 'C'; };
+        if(trans.size() != 2 || !valid(trans[0]) || !valid(trans[1]))
+            throw std::invalid_argument("Invalid value for --sweep_transposes " + trans);
+        a.transA = trans[0];
+        a.transB = trans[1];
+    });
+    expand(points, sweep.batch_count, [](Arguments& a, int64_t v) { a.batch_count = v; });
+    expand(points, sweep.size, [](Arguments& a, int64_t v) { a.M = a.N = a.K = v; });
+    expand(points, sweep.m, [](Arguments& a, int64_t v) { a.M = v; });
+    expand(points, sweep.n, [](Arguments& a, int64_t v) { a.N = v; });
+    expand(points, sweep.k, [](Arguments& a, int64_t v) { a.K = v; });
+    expand(points, sweep.lda, [](Arguments& a, int64_t v) { a.lda = v; });
+    expand(points, sweep.ldb, [](Arguments& a, int64_t v) { a.ldb = v; });
+    expand(points, sweep.ldc, [](Arguments& a, int64_t v) { a.ldc = v; });
+
+    for(auto& point : points)
+        set_minimum_dimensions(
+            point, !sweep.lda.empty(), !sweep.ldb.empty(), !sweep.ldc.empty());
+
+    return points;
+}
+
+int rocblas_bench_run_sweep(const rocblas_bench_sweep&            sweep,
+                            const Arguments&                      arg,
+                            const std::function<int(Arguments&)>& run)
+{
+    std::vector<Arguments> points = rocblas_bench_sweep_points(sweep, arg);
+    if(points.empty())
+        return 0;
+
+    d_vector_cache_guard cache;
+
+    // A single unverified, unreported call of the largest point allocates the buffers
+    Arguments warmup = *std::max_element(
+        points.begin(), points.end(), [](const Arguments& a, const Arguments& b) {
+            return footprint(a) < footprint(b);
+        });
+    warmup.iters      = 0;
+    warmup.cold_iters = 1;
+    warmup.norm_check = 0;
+    run(warmup);
+
+    // Each point reports its result as soon as it finishes
+    int ret = 0;
+    for(auto& point : points)
+        ret |= run(point);
+    return ret;
+}
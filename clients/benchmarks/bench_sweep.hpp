@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief In-process size sweeps for rocblas-bench
+ */
+
+/*! \brief Parse the values of a swept argument from a comma separated list of items.
+ *
+ *  Each item is a single value, a linear range start-end[:step] (step defaults to 1) or a
+ *  geometric range start-end:*factor, e.g. "64-4096:*2" or "1,8,64-512:64". Throws
+ *  std::invalid_argument naming option if spec is malformed.
+ */
+std::vector<int64_t> rocblas_bench_parse_sweep(const std::string& spec, const std::string& option);
+
+/*! \brief Swept values of a rocblas-bench run; empty lists are not swept */
+struct rocblas_bench_sweep
+{
+    std::vector<int64_t>     m, n, k, size, lda, ldb, ldc, batch_count;
+    std::vector<std::string> transposes; // transA and transB, e.g. "NT"
+    std::vector<std::string> precisions;
+
+    bool empty() const;
+};
+
+/*! \brief Expand arg into the cartesian product of the swept values.
+ *
+ *  Points are ordered by precision, transposes, batch_count, size, m, n, k, lda, ldb and ldc,
+ *  with the last varying fastest. Leading dimensions which are not swept, or swept as 0, and
+ *  the strides are set to their minimum for each point.
+ */
+std::vector<Arguments> rocblas_bench_sweep_points(const rocblas_bench_sweep& sweep,
+                                                  const Arguments&           arg);
+
+/*! \brief Run every point of a sweep with run.
+ *
+ *  Device memory is cached across the points, after a warmup of the point with the largest
+ *  footprint allocates the buffers which the other points reuse. Returns the bitwise or of
+ *  the results of run.
+ */
+int rocblas_bench_run_sweep(const rocblas_bench_sweep&            sweep,
+                            const Arguments&                      arg,
+                            const std::function<int(Arguments&)>& run);
@@ -0,0 +1,276 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_workload.hpp"
+#include "argument_model.hpp"
+#include "bench_problem.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+namespace
+{
+    // Picks the entry of each call in proportion to the weights
+    class weighted_schedule
+    {
+        rocblas_bench_workload_order       m_order;
+        std::vector<double>                m_weight;
+        std::vector<double>                m_current;
+        double                             m_total = 0;
+        std::mt19937_64                    m_rng{0x5eed};
+        std::discrete_distribution<size_t> m_dist;
+
+    public:
+        weighted_schedule(rocblas_bench_workload_order order, const std::vector<double>& weight)
+            : m_order(order)
+            , m_weight(weight)
+            , m_current(weight.size(), 0)
+            , m_dist(weight.begin(), weight.end())
+        {
+            for(double w : weight)
+                m_total += w;
+        }
+
+        size_t next()
+        {
+            if(m_order == rocblas_bench_workload_order::random)
+                return m_dist(m_rng);
+
+            // Smooth weighted round robin spreads the calls of each entry evenly over the
+            // sequence, instead of issuing them in runs
+            size_t best = 0;
+            for(size_t i = 0; i < m_weight.size(); i++)
+            {
+                m_current[i] += m_weight[i];
+                if(m_current[i] > m_current[best])
+                    best = i;
+            }
+            m_current[best] -= m_total;
+            return best;
+        }
+    };
+
+    // Entry names made unique by numbering repeated problems, so they can key a baseline
+    std::vector<std::string> unique_names(const std::vector<std::string>& names)
+    {
+        std::map<std::string, int> seen;
+        std::vector<std::string>   unique;
+        for(const auto& name : names)
+        {
+            int n = ++seen[name];
+            unique.push_back(n == 1 ? name : name + " #" + std::to_string(n));
+        }
+        return unique;
+    }
+
+    // Baseline files hold lines "problem,weight,mean_us" after a header line
+    std::map<std::string, double> read_baseline(const std::string& path)
+    {
+        std::ifstream                 is(path);
+        std::map<std::string, double> mean_us;
+        std::string                   line;
+
+        if(!is || !std::getline(is, line))
+            throw std::invalid_argument("Cannot read --baseline file " + path);
+
+        while(std::getline(is, line))
+        {
+            size_t last  = line.rfind(',');
+            size_t first = last == std::string::npos ? last : line.rfind(',', last - 1);
+            if(first == std::string::npos)
+                throw std::invalid_argument("Invalid line in --baseline file " + path + ": "
+                                            + line);
+            mean_us[line.substr(0, first)] = std::atof(line.c_str() + last + 1);
+        }
+        return mean_us;
+    }
+
+    double percent_delta(double value, double base)
+    {
+        return base > 0 ? (value / base - 1) * 100 : ArgumentLogging::NA_value;
+    }
+}
+
+bool rocblas_bench_parse_workload_order(const std::string&            str,
+                                        rocblas_bench_workload_order& order)
+{
+    if(str == "sequence")
+        order = rocblas_bench_workload_order::sequence;
+    else if(str == "random")
+        order = rocblas_bench_workload_order::random;
+    else
+        return false;
+    return true;
+}
+
+int rocblas_bench_run_workload(const rocblas_bench_workload_options& opt,
+                               const std::vector<Arguments>&         workload)
+{
+    if(workload.empty())
+    {
+        rocblas_cerr << "rocblas-bench: the workload has no problems" << std::endl;
+        return 1;
+    }
+
+    std::vector<double> weight;
+    for(const auto& arg : workload)
+    {
+        if(!(arg.weight > 0) || !std::isfinite(arg.weight))
+            throw std::invalid_argument(std::string("Invalid weight in workload for ")
+                                        + arg.function);
+        weight.push_back(arg.weight);
+    }
+
+    std::map<std::string, double> baseline;
+    if(!opt.baseline.empty())
+        baseline = read_baseline(opt.baseline);
+
+    rocblas_local_handle handle;
+    hipStream_t          stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    size_t                                              n = workload.size();
+    std::vector<std::unique_ptr<rocblas_bench_problem>> problems;
+    std::vector<std::string>                            names;
+    for(const auto& arg : workload)
+    {
+        problems.push_back(rocblas_bench_make_problem(arg));
+        names.push_back(problems.back()->name());
+    }
+    names = unique_names(names);
+
+    for(int i = 0; i < opt.cold_iters; i++)
+        for(auto& problem : problems)
+            CHECK_ROCBLAS_ERROR(problem->run(handle));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    std::vector<double> time_us(n, 0);
+    std::vector<size_t> calls(n, 0);
+    size_t              total_calls = 0;
+    size_t              max_calls   = opt.duration > 0 ? SIZE_MAX : size_t(opt.iters) * n;
+    weighted_schedule   schedule(opt.order, weight);
+
+    {
+        rocblas_bench_event_ring ring(stream, [&](size_t entry, double us) {
+            time_us[entry] += us;
+            calls[entry]++;
+        });
+
+        double wall_us = get_time_us_no_sync();
+        while(total_calls < max_calls)
+        {
+            if(opt.duration > 0 && get_time_us_no_sync() - wall_us >= opt.duration * 1e6)
+                break;
+
+            size_t entry = schedule.next();
+            ring.start(entry);
+            CHECK_ROCBLAS_ERROR(problems[entry]->run(handle));
+            ring.stop();
+            total_calls++;
+        }
+        ring.drain();
+    }
+
+    double total_us = 0, step_us = 0, step_gflop = 0;
+    double matched_us = 0, matched_base_us = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+        total_us += time_us[i];
+        if(calls[i])
+        {
+            double mean_us = time_us[i] / calls[i];
+            step_us += weight[i] * mean_us;
+            step_gflop += weight[i] * problems[i]->gflop();
+
+            auto base = baseline.find(names[i]);
+            if(base != baseline.end())
+            {
+                matched_us += weight[i] * mean_us;
+                matched_base_us += weight[i] * base->second;
+            }
+        }
+    }
+
+    rocblas_cout << std::fixed << std::setprecision(3);
+    rocblas_cout << "entry,problem,weight,calls,mean_us,time_us,share_%,Gflops";
+    if(!baseline.empty())
+        rocblas_cout << ",baseline_mean_us,delta_%";
+    rocblas_cout << std::endl;
+
+    for(size_t i = 0; i < n; i++)
+    {
+        double mean_us = calls[i] ? time_us[i] / calls[i] : ArgumentLogging::NA_value;
+        rocblas_cout << i << ',' << names[i] << ',' << weight[i] << ',' << calls[i] << ','
+                     << mean_us << ',' << time_us[i] << ','
+                     << (total_us > 0 ? time_us[i] / total_us * 100 : 0) << ','
+                     << (calls[i] ? problems[i]->gflop() / mean_us * 1e6 : 0);
+        if(!baseline.empty())
+        {
+            auto base = baseline.find(names[i]);
+            if(base != baseline.end() && calls[i])
+                rocblas_cout << ',' << base->second << ',' << percent_delta(mean_us, base->second);
+            else
+                rocblas_cout << ',' << ArgumentLogging::NA_value << ','
+                             << ArgumentLogging::NA_value;
+        }
+        rocblas_cout << std::endl;
+    }
+
+    rocblas_cout << std::endl << "order,calls,time_us,step_us,step-Gflops";
+    if(!baseline.empty())
+        rocblas_cout << ",baseline_step_us,delta_%";
+    rocblas_cout << std::endl
+                 << (opt.order == rocblas_bench_workload_order::random ? "random" : "sequence")
+                 << ',' << total_calls << ',' << total_us << ',' << step_us << ','
+                 << (step_us > 0 ? step_gflop / step_us * 1e6 : 0);
+    if(!baseline.empty())
+    {
+        // Only the entries found in the baseline are compared
+        double base_step_us = matched_us > 0 ? step_us * matched_base_us / matched_us : 0;
+        rocblas_cout << ',' << base_step_us << ',' << percent_delta(matched_us, matched_base_us);
+    }
+    rocblas_cout << std::endl;
+
+    if(!opt.save_baseline.empty())
+    {
+        std::ofstream os(opt.save_baseline);
+        os << std::setprecision(9) << "problem,weight,mean_us\n";
+        for(size_t i = 0; i < n; i++)
+            if(calls[i])
+                os << names[i] << ',' << weight[i] << ',' << time_us[i] / calls[i] << '\n';
+        if(!os)
+        {
+            rocblas_cerr << "rocblas-bench: cannot write " << opt.save_baseline << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
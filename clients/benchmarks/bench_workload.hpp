@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Weighted mixed-problem workload mode of rocblas-bench
+ *
+ * The entries of a --yaml or --data workload are issued back to back on one handle, each
+ * with a share of the calls proportional to its weight argument, e.g. its number of calls
+ * in one training step.
+ */
+
+enum class rocblas_bench_workload_order
+{
+    sequence, // deterministic interleaving by smooth weighted round robin
+    random, // entries drawn with probability proportional to their weights
+};
+
+/*! \brief rocblas-bench workload options, set from the command line */
+struct rocblas_bench_workload_options
+{
+    rocblas_bench_workload_order order      = rocblas_bench_workload_order::sequence;
+    int                          iters      = 10; // with duration 0, iters calls per entry on average
+    int                          cold_iters = 2; // untimed calls of each entry
+    double                       duration   = 0; // seconds
+    std::string                  baseline; // results to compare against
+    std::string                  save_baseline; // file to write the results to
+};
+
+/*! \brief Parse "sequence" or "random", returning false for other values */
+bool rocblas_bench_parse_workload_order(const std::string&            str,
+                                        rocblas_bench_workload_order& order);
+
+/*! \brief Run the weighted workload on the current device.
+
+    Prints the mean time of each entry, its share of the measured time, and the time of one
+    step, the sum of the mean times multiplied by the weights, with the deltas against the
+    --baseline results of matching entries. Throws std::invalid_argument for weights which
+    are not positive or a baseline which cannot be read. Returns non-zero on failure.
+*/
+int rocblas_bench_run_workload(const rocblas_bench_workload_options& opt,
+                               const std::vector<Arguments>&         workload);
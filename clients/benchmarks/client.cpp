@@ -20,13 +20,22 @@
  *
  * ************************************************************************ */
 #define ROCBLAS_BETA_FEATURES_API
+#include "bench_multistream.hpp"
+#include "bench_output.hpp"
+#include "bench_problem.hpp"
+#include "bench_sweep.hpp"
+#include "bench_workload.hpp"
+#include "graph_timing.hpp"
+#include "launch_breakdown.hpp"
 #include "program_options.hpp"
 
 #include "rocblas.hpp"
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_parse_data.hpp"
+#include "rotating_buffer.hpp"
 #include "tensile_host.hpp"
+#include "timing_statistics.hpp"
 #include "type_dispatch.hpp"
 #include "utility.hpp"
 #include <algorithm>
@@ -35,9 +44,13 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 // aux
 #include "testing_set_get_matrix.hpp"
@@ -1070,6 +1083,44 @@ struct perf_blas_rotg<
     }
 };
 
+// Functions which time their hot calls with rocblas_time_hot_calls, the only ones which
+// implement the hot call timing options
+bool rocblas_bench_times_hot_calls(const char* function)
+{
+    static const std::set<std::string> functions = {"gemm",
+                                                    "gemm_batched",
+                                                    "gemm_strided_batched",
+                                                    "gemm_ex",
+                                                    "gemm_batched_ex",
+                                                    "gemm_strided_batched_ex",
+                                                    "gemv",
+                                                    "gemv_batched",
+                                                    "gemv_strided_batched",
+                                                    "ger",
+                                                    "geru",
+                                                    "gerc",
+                                                    "symv",
+                                                    "hemv",
+                                                    "trmv",
+                                                    "syrk"};
+    return functions.count(function);
+}
+
+// Warn once for each function which ignores an enabled hot call timing option
+void rocblas_bench_check_timing_option(const char* function, bool enabled, const char* option)
+{
+    if(!enabled || rocblas_bench_times_hot_calls(function))
+        return;
+
+    static std::mutex            mutex;
+    static std::set<std::string> warned;
+    std::lock_guard<std::mutex>  lock(mutex);
+    if(warned.insert(std::string(option) + " " + function).second)
+        rocblas_cerr << "rocblas-bench warning: " << option << " is ignored by " << function
+                     << ", which does not time its hot calls with rocblas_time_hot_calls"
+                     << std::endl;
+}
+
 int run_bench_test(bool               init,
                    Arguments&         arg,
                    const std::string& filter,
@@ -1115,6 +1166,15 @@ int run_bench_test(bool               init,
             return 0;
     }
 
+    rocblas_bench_check_timing_option(
+        function, rocblas_get_iteration_timing().enabled, "--iteration_timing");
+    rocblas_bench_check_timing_option(
+        function, rocblas_get_rotating_buffer().enabled, "--rotating_buffer");
+    rocblas_bench_check_timing_option(
+        function, rocblas_get_graph_timing().enabled, "--graph_timing");
+    rocblas_bench_check_timing_option(
+        function, rocblas_get_launch_breakdown().enabled, "--launch_breakdown");
+
 #if BUILD_WITH_TENSILE
     if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
     {
@@ -1391,6 +1451,20 @@ int rocblas_bench_datafile(const std::string& filter,
     return ret;
 }
 
+// Run the problems of the data file concurrently with --streams, or as a weighted mix
+int rocblas_bench_workload_datafile(const rocblas_bench_multistream_options& multistream,
+                                    const rocblas_bench_workload_options*    mix)
+{
+    std::vector<Arguments> workload;
+    for(Arguments arg : RocBLAS_TestData())
+    {
+        rocblas_bench_check_problem(arg);
+        workload.push_back(arg);
+    }
+    return mix ? rocblas_bench_run_workload(*mix, workload)
+               : rocblas_bench_run_multistream(multistream, workload);
+}
+
 void gpu_thread_init_device(int                id,
                             const Arguments&   arg,
                             const std::string& filter,
@@ -1482,6 +1556,19 @@ try
     std::string arithmetic_check;
     std::string filter;
     std::string name_filter;
+    std::string output_format;
+    std::string sweep_m;
+    std::string sweep_n;
+    std::string sweep_k;
+    std::string sweep_size;
+    std::string sweep_lda;
+    std::string sweep_ldb;
+    std::string sweep_ldc;
+    std::string sweep_batch_count;
+    std::string sweep_transposes;
+    std::string sweep_precisions;
+    std::string performance_metric;
+    std::string workload_order;
     int32_t     device_id           = 0;
     int32_t     parallel_devices    = 0;
     int32_t     flags               = 0;
@@ -1497,6 +1584,13 @@ try
     uint64_t    flush_malloc_size   = 0;
     bool        fortran             = false;
 
+    rocblas_iteration_timing_options  iteration_timing;
+    rocblas_rotating_buffer_options   rotating_buffer;
+    rocblas_graph_timing_options      graph_timing;
+    rocblas_launch_breakdown_options  launch_breakdown;
+    rocblas_bench_multistream_options multistream;
+    rocblas_bench_workload_options    workload;
+
     arg.init(); // set all defaults
 
     options_description desc("rocblas-bench command line options");
@@ -1747,6 +1841,147 @@ try
          value<uint64_t>(&arg.flush_malloc_size)->default_value(0),
          "Set to 2x cache size for cache flushing in timing code")
 
+        ("rotating_buffer",
+         bool_switch(&rotating_buffer.enabled)->default_value(false),
+         "Cycle the hot calls of gemm, gemm_ex, gemv and their batched forms, and of ger, geru, "
+         "gerc, symv, hemv, trmv and syrk, through copies of their operands so that they are "
+         "not resident in the L2 cache or MALL, and report the cold-cache time with the "
+         "hot-cache time alongside. Other functions ignore it with a warning")
+
+        ("rotating_buffer_size",
+         value<size_t>(&rotating_buffer.bytes)->default_value(0),
+         "Total bytes of the operand copies for --rotating_buffer (0: twice the L2 cache and "
+         "MALL size of the device)")
+
+        ("graph_timing",
+         bool_switch(&graph_timing.enabled)->default_value(false),
+         "Also capture the iters hot calls of the functions which support --rotating_buffer "
+         "into a hipGraph and time its replay, reporting the time per call without the host "
+         "launch overhead next to the usual time. Other functions ignore it with a warning")
+
+        ("launch_breakdown",
+         bool_switch(&launch_breakdown.enabled)->default_value(false),
+         "Also time the iters hot calls of the functions which support --rotating_buffer one at "
+         "a time, and split each into host API time, queueing delay and device time. Other "
+         "functions ignore it with a warning")
+
+        ("host_overhead_threshold",
+         value<double>(&launch_breakdown.host_threshold)->default_value(0.5),
+         "Share of host API time in a call above which --launch_breakdown counts it as "
+         "host-bound")
+
+        ("iteration_timing",
+         bool_switch(&iteration_timing.enabled)->default_value(false),
+         "Time each hot call of gemm, gemm_ex, gemv and their batched forms, and of ger, geru, "
+         "gerc, symv, hemv, trmv and syrk, with a pair of events and report the min, median, "
+         "p90, p99, max, standard deviation and bootstrap confidence interval of the mean. "
+         "Other functions ignore it with a warning")
+
+        ("timing_ci",
+         value<double>(&iteration_timing.ci_target)->default_value(0),
+         "With --iteration_timing, keep running until the confidence interval half width "
+         "relative to the mean is below this value, e.g. 0.01 (default 0: run iters calls)")
+
+        ("timing_confidence",
+         value<double>(&iteration_timing.confidence)->default_value(0.95),
+         "Confidence level of the bootstrap interval for --iteration_timing")
+
+        ("timing_budget",
+         value<double>(&iteration_timing.time_budget)->default_value(10),
+         "Seconds after which an adaptive --timing_ci run stops (0: limited only by "
+         "--timing_max_samples)")
+
+        ("timing_max_samples",
+         value<size_t>(&iteration_timing.max_samples)->default_value(20000),
+         "Maximum number of hot calls timed by an adaptive --timing_ci run")
+
+        ("timing_samples",
+         bool_switch(&iteration_timing.keep_values)->default_value(false),
+         "With --iteration_timing, write the time of every hot call to the json and csv "
+         "records, as used by rocblas_bench_compare.py")
+
+        ("output_format,output-format",
+         value<std::string>(&output_format)->default_value("table"),
+         "Result output format: table, json (one object per line) or csv. The json and csv "
+         "fields are described by rocblas_bench_schema.json")
+
+        ("streams",
+         value<int>(&multistream.streams)->default_value(0),
+         "Submit the problems of the --yaml or --data workload, or the problem given on the "
+         "command line, concurrently from this many streams, and report the aggregate "
+         "throughput and per-call latency (0: disabled)")
+
+        ("handles_per_stream,handles-per-stream",
+         value<int>(&multistream.handles_per_stream)->default_value(1),
+         "Number of handles, each driven by its own host thread, sharing each of the --streams")
+
+        ("duration",
+         value<double>(&multistream.duration)->default_value(0),
+         "Seconds to run the --streams or --workload_order workload for, instead of a number of "
+         "calls set by --iters")
+
+        ("performance_metric",
+         value<std::string>(&performance_metric)->default_value("default"),
+         "Tensile solution selection metric of the --streams handles: default, "
+         "device_efficiency or cu_efficiency")
+
+        ("workload_order",
+         value<std::string>(&workload_order),
+         "Run the --yaml or --data workload as a mix, with each entry's share of the calls "
+         "proportional to its weight argument, issued in a deterministic interleaved sequence "
+         "or in random order: sequence or random. Runs --duration seconds, or --iters calls per "
+         "entry on average")
+
+        ("baseline",
+         value<std::string>(&workload.baseline),
+         "Report the deltas of the --workload_order results against those saved in this file")
+
+        ("save_baseline",
+         value<std::string>(&workload.save_baseline),
+         "Save the --workload_order results to this file for use with --baseline")
+
+        ("sweep_m",
+         value<std::string>(&sweep_m),
+         "Sweep m over a comma separated list of values and ranges start-end[:step] or "
+         "start-end:*factor, e.g. 64-4096:*2")
+
+        ("sweep_n",
+         value<std::string>(&sweep_n),
+         "Sweep n, see --sweep_m")
+
+        ("sweep_k",
+         value<std::string>(&sweep_k),
+         "Sweep k, see --sweep_m")
+
+        ("sweep_size",
+         value<std::string>(&sweep_size),
+         "Sweep m = n = k, see --sweep_m")
+
+        ("sweep_lda",
+         value<std::string>(&sweep_lda),
+         "Sweep lda, see --sweep_m. Leading dimensions which are not swept, or swept as 0, "
+         "are set to their minimum for each point of a sweep")
+
+        ("sweep_ldb",
+         value<std::string>(&sweep_ldb),
+         "Sweep ldb, see --sweep_lda")
+
+        ("sweep_ldc",
+         value<std::string>(&sweep_ldc),
+         "Sweep ldc and ldd, see --sweep_lda")
+
+        ("sweep_batch_count",
+         value<std::string>(&sweep_batch_count),
+         "Sweep batch_count, see --sweep_m")
+
+        ("sweep_transposes",
+         value<std::string>(&sweep_transposes),
+         "Sweep comma separated transposeA and transposeB pairs, e.g. NN,NT,TN,TT")
+
+        ("sweep_precisions",
+         value<std::string>(&sweep_precisions),
+         "Sweep comma separated precisions, each used as if given by --precision, e.g. s,d,h")
+
         ("name_filter",
          value<std::string>(&name_filter),
          "Simple strstr filter on test name only without wildcards, only used with --yaml or --data")
@@ -1827,6 +2062,24 @@ try
 
     arg.geam_ex_op = rocblas_geam_ex_operation(geam_ex_op);
 
+    if(iteration_timing.confidence <= 0 || iteration_timing.confidence >= 1)
+        throw std::invalid_argument("Invalid value for --timing_confidence");
+    if(iteration_timing.keep_values && !iteration_timing.enabled)
+        throw std::invalid_argument("--timing_samples requires --iteration_timing");
+    rocblas_set_iteration_timing(iteration_timing);
+
+    rocblas_set_rotating_buffer(rotating_buffer);
+    rocblas_set_graph_timing(graph_timing);
+
+    if(launch_breakdown.host_threshold <= 0 || launch_breakdown.host_threshold >= 1)
+        throw std::invalid_argument("Invalid value for --host_overhead_threshold");
+    rocblas_set_launch_breakdown(launch_breakdown);
+
+    rocblas_client_output_format output_fmt;
+    if(!rocblas_client_output_format_parse(output_format, output_fmt))
+        throw std::invalid_argument("Invalid value for --output_format " + output_format);
+    ArgumentModel_set_output_format(output_fmt);
+
     ArgumentModel_set_log_function_name(log_function_name);
 
     ArgumentModel_set_log_datatype(log_datatype);
@@ -1840,8 +2093,35 @@ try
     if(device_id >= 0)
         set_device(device_id);
 
+    if(multistream.streams < 0 || multistream.handles_per_stream < 1)
+        throw std::invalid_argument("Invalid value for --streams or --handles_per_stream");
+    if(multistream.streams && output_fmt != rocblas_client_output_format::table)
+        throw std::invalid_argument("--streams only supports --output_format table");
+    if(!rocblas_bench_parse_performance_metric(performance_metric, multistream.performance_metric))
+        throw std::invalid_argument("Invalid value for --performance_metric " + performance_metric);
+    multistream.iters      = arg.iters;
+    multistream.cold_iters = arg.cold_iters;
+
+    if(!workload_order.empty())
+    {
+        if(!rocblas_bench_parse_workload_order(workload_order, workload.order))
+            throw std::invalid_argument("Invalid value for --workload_order " + workload_order);
+        if(!datafile || multistream.streams)
+            throw std::invalid_argument(
+                "--workload_order requires --yaml or --data, and cannot be used with --streams");
+        workload.iters      = arg.iters;
+        workload.cold_iters = arg.cold_iters;
+        workload.duration   = multistream.duration;
+    }
+
     if(datafile)
+    {
+        if(!workload_order.empty())
+            return rocblas_bench_workload_datafile(multistream, &workload);
+        if(multistream.streams)
+            return rocblas_bench_workload_datafile(multistream, nullptr);
         return rocblas_bench_datafile(filter, name_filter, any_stride);
+    }
 
     // single bench run
 
@@ -1896,6 +2176,50 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    rocblas_bench_sweep sweep;
+    auto                sweep_values = [](const std::string& spec, const char* option) {
+        return spec.empty() ? std::vector<int64_t>{} : rocblas_bench_parse_sweep(spec, option);
+    };
+    auto sweep_list = [](std::string spec, int (*convert)(int)) {
+        std::vector<std::string> items;
+        std::transform(spec.begin(), spec.end(), spec.begin(), convert);
+        std::istringstream stream(spec);
+        for(std::string item; std::getline(stream, item, ',');)
+            items.push_back(item);
+        return items;
+    };
+    sweep.m           = sweep_values(sweep_m, "sweep_m");
+    sweep.n           = sweep_values(sweep_n, "sweep_n");
+    sweep.k           = sweep_values(sweep_k, "sweep_k");
+    sweep.size        = sweep_values(sweep_size, "sweep_size");
+    sweep.lda         = sweep_values(sweep_lda, "sweep_lda");
+    sweep.ldb         = sweep_values(sweep_ldb, "sweep_ldb");
+    sweep.ldc         = sweep_values(sweep_ldc, "sweep_ldc");
+    sweep.batch_count = sweep_values(sweep_batch_count, "sweep_batch_count");
+    sweep.transposes  = sweep_list(sweep_transposes, ::toupper);
+    sweep.precisions  = sweep_list(sweep_precisions, ::tolower);
+
+    if(multistream.streams)
+    {
+        if(parallel_devices || !sweep.empty())
+            throw std::invalid_argument(
+                "--streams cannot be used with --parallel_devices or --sweep options");
+
+        rocblas_bench_check_problem(arg);
+        return rocblas_bench_run_multistream(multistream, {arg});
+    }
+
+    if(!sweep.empty())
+    {
+        if(parallel_devices)
+            throw std::invalid_argument("--sweep options cannot be used with --parallel_devices");
+
+        std::string name_filter = "";
+        return rocblas_bench_run_sweep(sweep, arg, [&](Arguments& point) {
+            return run_bench_test(true, point, filter, name_filter, any_stride);
+        });
+    }
+
     if(!parallel_devices)
     {
         std::string name_filter = "";
@@ -19,17 +19,30 @@
  * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  *
  * ************************************************************************ */
+#include "gemm_tune_shapes.hpp"
 #include "gemm_tuners.hpp"
 
 #include "type_dispatch.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 static const auto DELIM = ",";
 
+// Set from the command line before any tuning starts
+static bool successive_halving = true;
+
+// Serializes the unsupported type and function warnings of the device threads
+static std::mutex warn_mutex;
+
 template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
 struct GEMMTunerDispatch
 {
@@ -41,6 +54,7 @@ struct GEMMTunerDispatch
         ss << arg.a_type << arg.c_type << arg.compute_type;
         std::string key = ss.str();
 
+        std::lock_guard<std::mutex> lock(warn_mutex);
         if(!displayed.count(key))
         {
             displayed.insert(key);
@@ -75,6 +89,7 @@ struct GEMMTunerDispatch<Ti, To, Tc, std::enable_if_t<!std::is_same_v<Tc, void>>
 
             std::string key(arg.function);
 
+            std::lock_guard<std::mutex> lock(warn_mutex);
             if(!displayed.count(key))
             {
                 displayed.insert(key);
@@ -91,19 +106,139 @@ struct GEMMTunerDispatch<Ti, To, Tc, std::enable_if_t<!std::is_same_v<Tc, void>>
         static_assert(std::is_base_of_v<GEMMTunerBase<Tc>, GEMMTUNER<Ti, To, Tc>>,
                       "GEMMtuner must be derived from GEMMTunerBase");
         GEMMTUNER<Ti, To, Tc> gemm_tuner(arg);
-        return gemm_tuner.get_best_solution();
+        return gemm_tuner.get_best_solution(successive_halving);
+    }
+};
+
+struct GEMMTuneOptions
+{
+    std::string shapes;
+    std::string bench_log;
+    std::string output;
+    int         devices    = 0; // 0 uses all devices of the same arch
+    int         iters      = -1; // -1 keeps the iters of each problem
+    int         cold_iters = -1;
+};
+
+// Parse the options left by rocblas_parse_data, returning false if they are invalid
+static bool parse_tune_options(int argc, char* argv[], GEMMTuneOptions& opt)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string option = argv[i];
+
+        if(option == "--exhaustive")
+        {
+            successive_halving = false;
+            continue;
+        }
+        if(option == "-h" || option == "--help")
+            return false;
+
+        if(i + 1 == argc || !argv[i + 1][0])
+        {
+            rocblas_cerr << "The " << option << " option requires an argument" << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if(option == "--shapes")
+            opt.shapes = value;
+        else if(option == "--bench_log")
+            opt.bench_log = value;
+        else if(option == "-o" || option == "--output")
+            opt.output = value;
+        else if(option == "--devices")
+            opt.devices = std::max(atoi(value.c_str()), 0);
+        else if(option == "--iters")
+            opt.iters = atoi(value.c_str());
+        else if(option == "--cold_iters")
+            opt.cold_iters = atoi(value.c_str());
+        else
+        {
+            rocblas_cerr << "Unknown option " << option << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// The current device and the other devices of its arch, which share its solution indices
+static std::vector<int> get_tuning_devices(int max_devices)
+{
+    int current, count;
+    CHECK_HIP_ERROR(hipGetDevice(&current));
+    CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, current));
+    std::string arch = props.gcnArchName;
+
+    std::vector<int> devices{current};
+    for(int d = 0; d < count && (!max_devices || int(devices.size()) < max_devices); ++d)
+    {
+        if(d == current)
+            continue;
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&props, d));
+        if(arch == props.gcnArchName)
+            devices.push_back(d);
     }
+    return devices;
+}
+
+struct GEMMTuneTask
+{
+    Arguments   arg;
+    std::string key; // log entry without the solution index
+    bool        strided;
+    int         solution = -1;
 };
 
+// Tune the tasks not yet taken by another device
+static void tune_device(int device, std::vector<GEMMTuneTask>& tasks, std::atomic<size_t>& next)
+{
+    CHECK_HIP_ERROR(hipSetDevice(device));
+    rocblas_initialize();
+
+    for(size_t i; (i = next++) < tasks.size();)
+    {
+        auto& task       = tasks[i];
+        task.arg.devices = device;
+
+        // run benchmark
+        try
+        {
+            task.solution = rocblas_gemm_dispatch<GEMMTunerDispatch>(task.arg);
+        }
+        catch(const std::exception& e)
+        {
+            rocblas_cout << "rocblas-gemm-tune WARN: " << task.key << ": " << e.what()
+                         << std::endl;
+        }
+
+        if(task.solution > 0)
+            rocblas_cout << "rocblas-gemm-tune INFO: [" << i + 1 << "/" << tasks.size()
+                         << "] device " << device << ": " << task.key << DELIM << task.solution
+                         << std::endl;
+    }
+}
+
 int main(int argc, char* argv[])
 {
 #if BUILD_WITH_TENSILE
-    // Get arguments from file
-    if(!rocblas_parse_data(argc, argv))
+    // Get arguments from file and command line
+    bool            has_data = rocblas_parse_data(argc, argv);
+    GEMMTuneOptions opt;
+    if(!parse_tune_options(argc, argv, opt)
+       || (!has_data && opt.shapes.empty() && opt.bench_log.empty()))
     {
         rocblas_cout << "Usage:"
                      << "\n"
-                     << "  <path> points to file generated by profile logging."
+                     << "  " << argv[0]
+                     << " [ --data <path> | --yaml <path> ] [ --shapes <path> ] "
+                        "[ --bench_log <path> ] <options> ..."
+                     << "\n\n"
+                     << "  --yaml <path> points to file generated by profile logging."
                      << "\n\n"
                      << "  To activate profile logging use environment variable ROCBLAS_LAYER:"
                      << "\n"
@@ -114,42 +249,46 @@ int main(int argc, char* argv[])
                      << "  - {'rocblas_function': 'rocblas_sgemm', 'transA': 'T', 'transB': 'N', "
                         "'M': 512, 'N': 8320, 'K': 512, 'alpha': 1, 'lda': 512, 'ldb': 512, "
                         "'beta': 0, 'ldc': 512, 'device': 0, 'cold_iters': 5, 'iters': 20}"
+                     << "\n\n"
+                     << "  --shapes <path> points to CSV lines with a header line naming the "
+                        "columns, such as a file written by --output."
+                     << "\n"
+                     << "  --bench_log <path> points to file generated by bench logging "
+                        "(ROCBLAS_LAYER & 2) != 0; its gemm calls are tuned."
+                     << "\n\n"
+                     << "Options:"
+                     << "\n"
+                     << "  -o, --output <path>  Write the results to <path>, in the format of "
+                        "ROCBLAS_TENSILE_GEMM_OVERRIDE_PATH"
+                     << "\n"
+                     << "  --devices <n>        Use at most n devices of the arch of the current "
+                        "device (default 0: all)"
+                     << "\n"
+                     << "  --iters <n>          Timed iterations of the final round of each "
+                        "problem"
+                     << "\n"
+                     << "  --cold_iters <n>     Untimed iterations of each solution"
+                     << "\n"
+                     << "  --exhaustive         Time every solution with all iterations, "
+                        "instead of successive halving"
                      << std::endl;
         return EXIT_FAILURE;
     }
 
-    rocblas_parallel_initialize(1);
     rocblas_cout << "\n";
 
-    // Keep separate streams for strided/non-strided since param numbers are different
-    rocblas_internal_ostream gemm_ex_os;
-    bool                     gemm_ex_has_entries = false;
-    gemm_ex_os << "transA" << DELIM << "transB" << DELIM << "M" << DELIM << "N" << DELIM
-               << "batch_count" << DELIM << "K" << DELIM << "alpha" << DELIM << "beta" << DELIM
-               << "lda" << DELIM << "ldb" << DELIM << "ldc" << DELIM << "input_type" << DELIM
-               << "output_type" << DELIM << "compute_type" << DELIM << "solution_index"
-               << "\n";
-
-    rocblas_internal_ostream gemm_strided_ex_os;
-    bool                     gemm_strided_ex_has_entries = false;
-    gemm_strided_ex_os << "transA" << DELIM << "transB" << DELIM << "M" << DELIM << "N" << DELIM
-                       << "batch_count" << DELIM << "K" << DELIM << "alpha" << DELIM << "beta"
-                       << DELIM << "lda" << DELIM << "ldb" << DELIM << "ldc" << DELIM << "stride_a"
-                       << DELIM << "stride_b" << DELIM << "stride_c" << DELIM << "input_type"
-                       << DELIM << "output_type" << DELIM << "compute_type" << DELIM
-                       << "solution_index"
-                       << "\n";
-
-    rocblas_internal_ostream* current_os;
-    bool*                     current_entry;
-
     // Track unique args to avoid duplicates
+    std::vector<GEMMTuneTask>       tasks;
     std::unordered_set<std::string> processed{};
 
-    // Benchmark each case
-    for(const Arguments& arg : RocBLAS_TestData())
-    {
+    auto add_task = [&](Arguments arg) {
         std::stringstream ss;
+        bool              strided;
+
+        if(opt.iters >= 0)
+            arg.iters = opt.iters;
+        if(opt.cold_iters >= 0)
+            arg.cold_iters = opt.cold_iters;
 
         // Build log entry, which doubles as set key for duplicate check
         if(!strcmp(arg.function, "gemm") || !strcmp(arg.function, "gemm_ex")
@@ -162,8 +301,7 @@ int main(int argc, char* argv[])
                << rocblas_datatype2string(arg.c_type) << DELIM
                << rocblas_datatype2string(arg.compute_type);
 
-            current_os    = &gemm_ex_os;
-            current_entry = &gemm_ex_has_entries;
+            strided = false;
         }
         else
         {
@@ -176,40 +314,103 @@ int main(int argc, char* argv[])
                << rocblas_datatype2string(arg.c_type) << DELIM
                << rocblas_datatype2string(arg.compute_type);
 
-            current_os    = &gemm_strided_ex_os;
-            current_entry = &gemm_strided_ex_has_entries;
+            strided = true;
         }
 
         std::string arg_key = ss.str();
         if(!processed.count(arg_key))
         {
             processed.insert(arg_key);
+            tasks.push_back({arg, arg_key, strided});
+        }
+    };
 
-            // run benchmark
-            int best_solution_index = rocblas_gemm_dispatch<GEMMTunerDispatch>(arg);
+    try
+    {
+        if(has_data)
+            for(const Arguments& arg : RocBLAS_TestData())
+                add_task(arg);
+        if(!opt.shapes.empty())
+            for(const Arguments& arg : gemm_tune_read_shapes(opt.shapes))
+                add_task(arg);
+        if(!opt.bench_log.empty())
+            for(const Arguments& arg : gemm_tune_read_bench_log(opt.bench_log))
+                add_task(arg);
+    }
+    catch(const std::invalid_argument& e)
+    {
+        rocblas_cerr << "rocblas-gemm-tune ERROR: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
 
-            // log result, if solution is found
-            if(best_solution_index > 0)
-            {
-                *current_entry = true;
-                *current_os << arg_key << DELIM << best_solution_index << "\n";
-            }
+    // Benchmark each case, with the devices taking the next case as they become free
+    std::vector<int> devices = get_tuning_devices(opt.devices);
+    rocblas_cout << "rocblas-gemm-tune INFO: tuning " << tasks.size() << " problems on "
+                 << devices.size() << " device(s)" << std::endl;
+
+    std::atomic<size_t>      next{0};
+    std::vector<std::thread> threads;
+    for(int device : devices)
+        threads.emplace_back(tune_device, device, std::ref(tasks), std::ref(next));
+    for(auto& thread : threads)
+        thread.join();
+
+    // Keep separate streams for strided/non-strided since param numbers are different
+    rocblas_internal_ostream gemm_ex_os;
+    bool                     gemm_ex_has_entries = false;
+    gemm_ex_os << "transA" << DELIM << "transB" << DELIM << "M" << DELIM << "N" << DELIM
+               << "batch_count" << DELIM << "K" << DELIM << "alpha" << DELIM << "beta" << DELIM
+               << "lda" << DELIM << "ldb" << DELIM << "ldc" << DELIM << "input_type" << DELIM
+               << "output_type" << DELIM << "compute_type" << DELIM << "solution_index"
+               << "\n";
+
+    rocblas_internal_ostream gemm_strided_ex_os;
+    bool                     gemm_strided_ex_has_entries = false;
+    gemm_strided_ex_os << "transA" << DELIM << "transB" << DELIM << "M" << DELIM << "N" << DELIM
+                       << "batch_count" << DELIM << "K" << DELIM << "alpha" << DELIM << "beta"
+                       << DELIM << "lda" << DELIM << "ldb" << DELIM << "ldc" << DELIM << "stride_a"
+                       << DELIM << "stride_b" << DELIM << "stride_c" << DELIM << "input_type"
+                       << DELIM << "output_type" << DELIM << "compute_type" << DELIM
+                       << "solution_index"
+                       << "\n";
+
+    // log result in input order, if solution is found
+    for(const auto& task : tasks)
+    {
+        if(task.solution > 0)
+        {
+            auto& os = task.strided ? gemm_strided_ex_os : gemm_ex_os;
+            (task.strided ? gemm_strided_ex_has_entries : gemm_ex_has_entries) = true;
+            os << task.key << DELIM << task.solution << "\n";
         }
     }
 
     // final log
+    rocblas_internal_ostream log;
     if(gemm_ex_has_entries)
     {
-        rocblas_cout << gemm_ex_os;
+        log << gemm_ex_os;
 
         if(gemm_strided_ex_has_entries)
-            rocblas_cout << "\n";
+            log << "\n";
     }
 
     if(gemm_strided_ex_has_entries)
-        rocblas_cout << gemm_strided_ex_os;
+        log << gemm_strided_ex_os;
 
-    rocblas_cout << std::endl;
+    if(opt.output.empty())
+        rocblas_cout << log << std::endl;
+    else
+    {
+        std::ofstream file(opt.output);
+        file << log.str();
+        if(!file)
+        {
+            rocblas_cerr << "rocblas-gemm-tune ERROR: cannot write " << opt.output << std::endl;
+            return EXIT_FAILURE;
+        }
+        rocblas_cout << "rocblas-gemm-tune INFO: wrote " << opt.output << std::endl;
+    }
 
     test_cleanup::cleanup();
     return EXIT_SUCCESS;
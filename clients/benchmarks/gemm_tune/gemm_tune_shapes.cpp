@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gemm_tune_shapes.hpp"
+#include "rocblas_datatype2string.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    const char* const gemm_functions[] = {"gemm",
+                                          "gemm_ex",
+                                          "gemm_batched",
+                                          "gemm_batched_ex",
+                                          "gemm_strided_batched",
+                                          "gemm_strided_batched_ex"};
+
+    bool is_gemm_function(const std::string& function)
+    {
+        for(auto f : gemm_functions)
+            if(function == f)
+                return true;
+        return false;
+    }
+
+    Arguments default_arguments()
+    {
+        Arguments arg{};
+        arg.init();
+        arg.composite_compute_type = rocblas_compute_type_invalid;
+        arg.transA                 = 'N';
+        arg.transB                 = 'N';
+        return arg;
+    }
+
+    template <typename T>
+    T parse_number(const std::string& value, const std::string& name, const std::string& where)
+    {
+        char*  end;
+        double x = strtod(value.c_str(), &end);
+        if(value.empty() || *end)
+            throw std::invalid_argument("Invalid value for " + name + " in " + where + ": "
+                                        + value);
+        return T(x);
+    }
+
+    rocblas_datatype parse_datatype(const std::string& value,
+                                    const std::string& name,
+                                    const std::string& where)
+    {
+        auto type = string2rocblas_datatype(value);
+        if(type == rocblas_datatype_invalid)
+            throw std::invalid_argument("Invalid value for " + name + " in " + where + ": "
+                                        + value);
+        return type;
+    }
+
+    char parse_operation(const std::string& value,
+                         const std::string& name,
+                         const std::string& where)
+    {
+        if(value != "N" && value != "T" && value != "C")
+            throw std::invalid_argument("Invalid value for " + name + " in " + where + ": "
+                                        + value);
+        return value[0];
+    }
+
+    void set_function(Arguments& arg, const std::string& function, const std::string& where)
+    {
+        if(!is_gemm_function(function) || function.size() >= sizeof(arg.function))
+            throw std::invalid_argument("Unsupported function in " + where + ": " + function);
+        strcpy(arg.function, function.c_str());
+    }
+
+    std::vector<std::string> split(const std::string& line, char delim)
+    {
+        std::vector<std::string> fields;
+        std::istringstream       is(line);
+        std::string              field;
+        while(std::getline(is, field, delim))
+        {
+            auto first = field.find_first_not_of(" \t\r");
+            auto last  = field.find_last_not_of(" \t\r");
+            fields.push_back(first == std::string::npos ? ""
+                                                        : field.substr(first, last - first + 1));
+        }
+        return fields;
+    }
+}
+
+std::vector<Arguments> gemm_tune_read_shapes(const std::string& path)
+{
+    std::ifstream is(path);
+    if(!is)
+        throw std::invalid_argument("Cannot read shapes file " + path);
+
+    std::vector<Arguments>   shapes;
+    std::vector<std::string> header;
+    std::string              line;
+    int                      line_number = 0;
+
+    while(std::getline(is, line))
+    {
+        ++line_number;
+        auto fields = split(line, ',');
+        if(fields.empty() || (fields.size() == 1 && fields[0].empty()))
+        {
+            // A blank line ends the section, and the next line is a header
+            header.clear();
+            continue;
+        }
+
+        if(header.empty())
+        {
+            header = fields;
+            continue;
+        }
+
+        std::string where = path + ":" + std::to_string(line_number);
+        if(fields.size() != header.size())
+            throw std::invalid_argument("Wrong number of columns in " + where);
+
+        std::map<std::string, std::string> column;
+        for(size_t i = 0; i < header.size(); i++)
+            column[header[i]] = fields[i];
+
+        auto has = [&](const char* name) { return column.count(name) != 0; };
+        auto get = [&](const char* name) { return column[name]; };
+
+        Arguments arg = default_arguments();
+
+        if(has("transA"))
+            arg.transA = parse_operation(get("transA"), "transA", where);
+        if(has("transB"))
+            arg.transB = parse_operation(get("transB"), "transB", where);
+
+#define SHAPE_NUMBER(NAME)                                                 \
+    if(has(#NAME))                                                         \
+    arg.NAME = parse_number<decltype(arg.NAME)>(get(#NAME), #NAME, where)
+
+        SHAPE_NUMBER(M);
+        SHAPE_NUMBER(N);
+        SHAPE_NUMBER(K);
+        SHAPE_NUMBER(batch_count);
+        SHAPE_NUMBER(alpha);
+        SHAPE_NUMBER(beta);
+        SHAPE_NUMBER(lda);
+        SHAPE_NUMBER(ldb);
+        SHAPE_NUMBER(ldc);
+        SHAPE_NUMBER(stride_a);
+        SHAPE_NUMBER(stride_b);
+        SHAPE_NUMBER(stride_c);
+#undef SHAPE_NUMBER
+
+        arg.ldd      = arg.ldc;
+        arg.stride_d = arg.stride_c;
+
+        if(has("input_type"))
+            arg.a_type = arg.b_type = parse_datatype(get("input_type"), "input_type", where);
+        arg.c_type = arg.d_type = has("output_type")
+                                      ? parse_datatype(get("output_type"), "output_type", where)
+                                      : arg.a_type;
+        arg.compute_type = has("compute_type")
+                               ? parse_datatype(get("compute_type"), "compute_type", where)
+                               : arg.c_type;
+
+        if(has("function"))
+            set_function(arg, get("function"), where);
+        else if(has("stride_a") || has("stride_b") || has("stride_c"))
+            set_function(arg, "gemm_strided_batched_ex", where);
+        else
+            set_function(arg, arg.batch_count > 1 ? "gemm_batched_ex" : "gemm_ex", where);
+
+        shapes.push_back(arg);
+    }
+
+    return shapes;
+}
+
+std::vector<Arguments> gemm_tune_read_bench_log(const std::string& path)
+{
+    std::ifstream is(path);
+    if(!is)
+        throw std::invalid_argument("Cannot read bench log " + path);
+
+    std::vector<Arguments> calls;
+    std::string            line;
+    int                    line_number = 0;
+
+    while(std::getline(is, line))
+    {
+        ++line_number;
+
+        std::istringstream       tokens(line);
+        std::vector<std::string> words;
+        for(std::string word; tokens >> word;)
+            words.push_back(word);
+
+        // Commands start with the path of rocblas-bench
+        static constexpr char bench[] = "rocblas-bench";
+        if(words.empty() || words[0].size() < strlen(bench)
+           || words[0].compare(words[0].size() - strlen(bench), std::string::npos, bench))
+            continue;
+
+        std::string where = path + ":" + std::to_string(line_number);
+        Arguments   arg   = default_arguments();
+
+        std::string function, precision, a_type, b_type, c_type, d_type, compute_type;
+        for(size_t i = 1; i < words.size(); i++)
+        {
+            const std::string& option = words[i];
+
+            if(option == "--atomics_not_allowed")
+            {
+                arg.atomics_mode = rocblas_atomics_not_allowed;
+                continue;
+            }
+
+            // Other options take a value, which may be negative
+            if(i + 1 == words.size())
+                break;
+            const std::string& value = words[++i];
+
+            if(option == "-f" || option == "--function")
+                function = value;
+            else if(option == "-r" || option == "--precision")
+                precision = value;
+            else if(option == "--a_type")
+                a_type = value;
+            else if(option == "--b_type")
+                b_type = value;
+            else if(option == "--c_type")
+                c_type = value;
+            else if(option == "--d_type")
+                d_type = value;
+            else if(option == "--compute_type")
+                compute_type = value;
+            else if(option == "--transposeA")
+                arg.transA = parse_operation(value, option, where);
+            else if(option == "--transposeB")
+                arg.transB = parse_operation(value, option, where);
+            else if(option == "-m" || option == "--sizem")
+                arg.M = parse_number<int64_t>(value, option, where);
+            else if(option == "-n" || option == "--sizen")
+                arg.N = parse_number<int64_t>(value, option, where);
+            else if(option == "-k" || option == "--sizek")
+                arg.K = parse_number<int64_t>(value, option, where);
+            else if(option == "--alpha")
+                arg.alpha = parse_number<double>(value, option, where);
+            else if(option == "--alphai")
+                arg.alphai = parse_number<double>(value, option, where);
+            else if(option == "--beta")
+                arg.beta = parse_number<double>(value, option, where);
+            else if(option == "--betai")
+                arg.betai = parse_number<double>(value, option, where);
+            else if(option == "--lda")
+                arg.lda = parse_number<int64_t>(value, option, where);
+            else if(option == "--ldb")
+                arg.ldb = parse_number<int64_t>(value, option, where);
+            else if(option == "--ldc")
+                arg.ldc = parse_number<int64_t>(value, option, where);
+            else if(option == "--ldd")
+                arg.ldd = parse_number<int64_t>(value, option, where);
+            else if(option == "--stride_a")
+                arg.stride_a = parse_number<int64_t>(value, option, where);
+            else if(option == "--stride_b")
+                arg.stride_b = parse_number<int64_t>(value, option, where);
+            else if(option == "--stride_c")
+                arg.stride_c = parse_number<int64_t>(value, option, where);
+            else if(option == "--stride_d")
+                arg.stride_d = parse_number<int64_t>(value, option, where);
+            else if(option == "--batch_count")
+                arg.batch_count = parse_number<int64_t>(value, option, where);
+            // --algo, --solution_index and --flags select the kernel being tuned, and other
+            // options do not change the problem
+        }
+
+        if(!is_gemm_function(function))
+            continue;
+        set_function(arg, function, where);
+
+        auto prec = precision.empty() ? rocblas_datatype_f32_r
+                                      : parse_datatype(precision, "--precision", where);
+        auto type = [&](const std::string& value, const char* name) {
+            return value.empty() ? prec : parse_datatype(value, name, where);
+        };
+        arg.a_type       = type(a_type, "--a_type");
+        arg.b_type       = type(b_type, "--b_type");
+        arg.c_type       = type(c_type, "--c_type");
+        arg.d_type       = type(d_type, "--d_type");
+        arg.compute_type = type(compute_type, "--compute_type");
+
+        calls.push_back(arg);
+    }
+
+    return calls;
+}
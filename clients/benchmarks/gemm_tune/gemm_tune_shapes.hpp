@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief GEMM problems for rocblas-gemm-tune from shape lists and bench logs
+ */
+
+/*! \brief Read a list of shapes in CSV form.
+
+    Each section of the file starts with a header line naming its columns, and sections are
+    separated by blank lines, so a ROCBLAS_TENSILE_GEMM_OVERRIDE_PATH file written by
+    rocblas-gemm-tune is a valid list. The columns are transA, transB, M, N, K, batch_count,
+    alpha, beta, lda, ldb, ldc, stride_a, stride_b, stride_c, input_type, output_type,
+    compute_type and function, and others such as solution_index are ignored. Columns which
+    are missing take the defaults of the Arguments fields. Without a function column, sections
+    with stride columns are gemm_strided_batched_ex, others gemm_batched_ex for a batch_count
+    above 1 and gemm_ex otherwise. Throws std::invalid_argument if the file cannot be read or
+    a line is malformed.
+*/
+std::vector<Arguments> gemm_tune_read_shapes(const std::string& path);
+
+/*! \brief Read the gemm calls of a bench log, as written with ROCBLAS_LAYER=2.
+
+    Lines which are not rocblas-bench commands of gemm, gemm_batched, gemm_strided_batched or
+    their _ex variants are skipped, so the log of a whole application can be used. Throws
+    std::invalid_argument if the file cannot be read or an option value is invalid.
+*/
+std::vector<Arguments> gemm_tune_read_bench_log(const std::string& path);
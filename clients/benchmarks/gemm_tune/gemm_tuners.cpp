@@ -21,6 +21,9 @@
  * ************************************************************************ */
 #include "gemm_tuners.hpp"
 
+#include <algorithm>
+#include <utility>
+
 /* COMMON */
 template <typename Tc>
 GEMMTunerBase<Tc>::GEMMTunerBase(const Arguments& arg)
@@ -67,7 +70,7 @@ GEMMTunerBase<Tc>::GEMMTunerBase(const Arguments& arg)
 }
 
 template <typename Tc>
-int GEMMTunerBase<Tc>::get_best_solution()
+int GEMMTunerBase<Tc>::get_best_solution(bool successive_halving)
 {
     CHECK_HIP_ERROR(hipSetDevice(m_device));
 
@@ -78,36 +81,54 @@ int GEMMTunerBase<Tc>::get_best_solution()
     std::vector<rocblas_int> solutions(n_solutions);
     CHECK_ROCBLAS_ERROR(get_solutions(solutions.data(), &n_solutions));
 
-    // Benchmark each and return best
-    double         best_time = std::numeric_limits<double>::max();
-    rocblas_int    best_sol  = -1;
-    rocblas_status status;
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &stream));
+
+    // With successive halving, all solutions are first timed with few iterations, then the
+    // faster half is kept and timed with twice as many, until the last pair is timed with
+    // m_iters. Otherwise each solution is timed once with m_iters.
+    int rounds = 1;
+    while(successive_halving && (size_t(1) << rounds) < solutions.size())
+        ++rounds;
 
-    for(auto sol : solutions)
+    rocblas_int                                 best_sol = -1;
+    std::vector<std::pair<double, rocblas_int>> times;
+    for(int round = rounds - 1; round >= 0 && !solutions.empty(); --round)
     {
-        // warmup
-        for(rocblas_int c = 0; c < m_cold_iters; ++c)
-        {
-            CHECK_ROCBLAS_ERROR(run_with_solution(sol));
-        }
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &stream));
-        double time = get_time_us_sync(stream); // in microseconds
+        rocblas_int iters = m_iters > 0 ? std::max(m_iters >> round, 1) : 0;
 
-        // timing loop
-        for(rocblas_int c = 0; c < m_iters; ++c)
+        times.clear();
+        for(auto sol : solutions)
         {
-            CHECK_ROCBLAS_ERROR(run_with_solution(sol));
+            // warmup, once per solution
+            if(round == rounds - 1)
+            {
+                for(rocblas_int c = 0; c < m_cold_iters; ++c)
+                {
+                    CHECK_ROCBLAS_ERROR(run_with_solution(sol));
+                }
+            }
+            double time = get_time_us_sync(stream); // in microseconds
+
+            // timing loop
+            for(rocblas_int c = 0; c < iters; ++c)
+            {
+                CHECK_ROCBLAS_ERROR(run_with_solution(sol));
+            }
+            time = get_time_us_sync(stream) - time;
+
+            times.emplace_back(iters ? (time / iters) : 0, sol);
         }
-        time = get_time_us_sync(stream) - time;
 
-        // track winner
-        double avg_time = m_iters ? (time / m_iters) : 0;
-        if(avg_time < best_time)
-        {
-            best_sol  = sol;
-            best_time = avg_time;
-        }
+        // keep the faster half, in the order of the solution list for equal times
+        std::stable_sort(times.begin(), times.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+        best_sol = times.front().second;
+
+        solutions.resize((times.size() + 1) / 2);
+        for(size_t i = 0; i < solutions.size(); ++i)
+            solutions[i] = times[i].second;
     }
 
     return best_sol;
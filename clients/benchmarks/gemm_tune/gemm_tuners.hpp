@@ -39,7 +39,9 @@ public:
     GEMMTunerBase(const Arguments& arg);
     virtual ~GEMMTunerBase() {}
 
-    int get_best_solution();
+    // Index of the fastest solution, found by successive halving of the candidates unless
+    // successive_halving is false
+    int get_best_solution(bool successive_halving = true);
 
 private:
     // These two methods marshall the GEMM calls depending on function type
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+Compare two sets of rocblas-bench results for performance regressions
+
+The inputs are records written by rocblas-bench --output_format json or csv, as
+described by rocblas_bench_schema.json. Records of the two sets are matched by
+their arguments, and the times of each matched problem are compared with a
+two-sided Mann-Whitney U test. The per-iteration times of --iteration_timing
+--timing_samples runs are used when present, otherwise the time per call of each
+record, so repeated runs of the same problem are pooled into one sample.
+
+A problem has regressed when its median time grew by more than --threshold and
+the test is significant at --alpha. The exit code is 1 if any problem regressed,
+so the script can gate an upgrade. A problem with too few samples for any p value
+below --alpha to be possible, such as a single record without --timing_samples on
+each side, cannot be compared and is reported as insufficient, with exit code 2
+unless a regression was found."""
+
+import argparse
+import csv
+import json
+import math
+import sys
+
+# Arguments which do not change the problem being timed
+IGNORED_ARGUMENTS = {
+    'name', 'category', 'known_bug_platforms', 'iters', 'cold_iters',
+    'norm_check', 'unit_check', 'res_check', 'timing', 'weight'
+}
+
+
+def read_records(path):
+    """Read the JSON-lines or CSV records of a file, as nested dictionaries"""
+    with open(path, newline='') as f:
+        text = f.read()
+
+    records = []
+    lines = [line for line in text.splitlines() if line.strip()]
+    if lines and lines[0].lstrip().startswith('{'):
+        for line in lines:
+            records.append(json.loads(line))
+        return records
+
+    for row in csv.DictReader(lines):
+        record = {}
+        for column, value in row.items():
+            section, _, name = column.rpartition('.')
+            record.setdefault(section, {})[name] = parse_csv_value(value)
+        records.append(record)
+    return records
+
+
+def parse_csv_value(value):
+    if value is None or value == '':
+        return None
+    if value.startswith('['):
+        return json.loads(value)
+    if value in ('true', 'false'):
+        return value == 'true'
+    try:
+        return float(value)
+    except ValueError:
+        return value
+
+
+def key_value(value):
+    """Numbers read from JSON and CSV compare equal after conversion to float"""
+    if isinstance(value, bool) or not isinstance(value, (int, float)):
+        return value
+    return float(value)
+
+
+def problem_key(record, ignored):
+    arguments = record.get('arguments', {})
+    return tuple(sorted((name, key_value(value)) for name, value in arguments.items()
+                        if name not in ignored))
+
+
+def record_samples(record):
+    timing = record.get('timing') or {}
+    values = timing.get('us_values')
+    if values:
+        return [float(x) for x in values]
+    gpu_us = (record.get('results') or {}).get('gpu_us')
+    return [float(gpu_us)] if gpu_us is not None else []
+
+
+def group_samples(records, ignored):
+    """Pool the samples of the records of each problem, keeping the first record"""
+    groups = {}
+    for record in records:
+        samples = record_samples(record)
+        if not samples:
+            continue
+        key = problem_key(record, ignored)
+        if key in groups:
+            groups[key][1].extend(samples)
+        else:
+            groups[key] = (record, samples)
+    return groups
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    return s[n // 2] if n % 2 else (s[n // 2 - 1] + s[n // 2]) / 2
+
+
+def mann_whitney(x, y):
+    """Two-sided Mann-Whitney U test, returning (U of x, p value).
+
+    The exact distribution of U is used for small samples without ties, otherwise the
+    normal approximation with tie and continuity corrections."""
+    n1, n2 = len(x), len(y)
+    pooled = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+
+    # Average ranks of tied values, and the tie correction term
+    rank_sum_x = 0.0
+    ties = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j < len(pooled) and pooled[j][0] == pooled[i][0]:
+            j += 1
+        rank = (i + j + 1) / 2
+        rank_sum_x += rank * sum(1 for k in range(i, j) if pooled[k][1] == 0)
+        t = j - i
+        ties += t * t * t - t
+        i = j
+
+    u = rank_sum_x - n1 * (n1 + 1) / 2
+    mean = n1 * n2 / 2
+
+    if ties == 0 and n1 * n2 <= 2500:
+        counts = exact_u_counts(n1, n2)
+        total = sum(counts)
+        lo = min(u, n1 * n2 - u)
+        p = 2 * sum(counts[:int(lo) + 1]) / total
+        return u, min(p, 1.0)
+
+    n = n1 + n2
+    var = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)))
+    if var <= 0:
+        return u, 1.0
+    z = max(abs(u - mean) - 0.5, 0) / math.sqrt(var)
+    return u, min(math.erfc(z / math.sqrt(2)), 1.0)
+
+
+def min_p_value(n1, n2):
+    """Smallest two-sided p value of the Mann-Whitney U test for samples of sizes n1 and n2,
+    reached when all the values of one sample are below those of the other"""
+    return min(2 / math.comb(n1 + n2, n1), 1.0)
+
+
+def exact_u_counts(n1, n2):
+    """Number of orderings of n1 and n2 values giving each U, from 0 to n1 * n2"""
+    # counts[j][u] for the samples of sizes (i, j) built up one row i at a time
+    prev = [[1] for _ in range(n2 + 1)]
+    for i in range(1, n1 + 1):
+        row = [[1]]
+        for j in range(1, n2 + 1):
+            # the largest value is from x, adding j to U, or from y
+            a, b = prev[j], row[j - 1]
+            size = i * j + 1
+            counts = [0] * size
+            for u, c in enumerate(a):
+                counts[u + j] += c
+            for u, c in enumerate(b):
+                counts[u] += c
+            row.append(counts)
+        prev = row
+    return prev[n2]
+
+
+def describe(record):
+    a = record.get('arguments', {})
+
+    def value(name):
+        v = a.get(name)
+        return int(v) if isinstance(v, float) and v.is_integer() else v
+
+    problem = '{}{} {}x{}x{}'.format(value('transA') or '', value('transB') or '',
+                                     value('M'), value('N'), value('K'))
+    batch = value('batch_count')
+    if batch and batch > 1:
+        problem += ' batch {}'.format(batch)
+    precision = value('compute_type') if 'ex' in str(value('function')) else value('a_type')
+    return [str(value('function')), str(precision), problem.strip()]
+
+
+def print_table(header, rows):
+    widths = [max(len(str(row[c])) for row in [header] + rows) for c in range(len(header))]
+    for row in [header] + rows:
+        print('  '.join(str(v).ljust(w) if c < 3 else str(v).rjust(w)
+                        for c, (v, w) in enumerate(zip(row, widths))).rstrip())
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two sets of rocblas-bench json or csv results')
+    parser.add_argument('baseline', help='results of the reference build')
+    parser.add_argument('candidate', help='results of the build under test')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='relative change of the median time below which a problem is '
+                        'unchanged (default 0.05)')
+    parser.add_argument('--alpha', type=float, default=0.01,
+                        help='significance level of the Mann-Whitney U test (default 0.01)')
+    parser.add_argument('--ignore', action='append', default=[], metavar='ARGUMENT',
+                        help='argument not used to match problems, may be repeated')
+    parser.add_argument('--changes-only', action='store_true',
+                        help='only list regressions and improvements')
+    args = parser.parse_args()
+
+    ignored = IGNORED_ARGUMENTS | set(args.ignore)
+    base = group_samples(read_records(args.baseline), ignored)
+    cand = group_samples(read_records(args.candidate), ignored)
+
+    rows = []
+    counts = {'regression': 0, 'improvement': 0, 'same': 0, 'insufficient': 0}
+    for key, (record, new) in cand.items():
+        if key not in base:
+            continue
+        old = base[key][1]
+        old_median, new_median = median(old), median(new)
+        change = new_median / old_median - 1 if old_median > 0 else 0.0
+        _, p = mann_whitney(old, new)
+
+        verdict = 'same'
+        if min_p_value(len(old), len(new)) >= args.alpha:
+            verdict = 'insufficient'
+        elif p < args.alpha and change > args.threshold:
+            verdict = 'regression'
+        elif p < args.alpha and change < -args.threshold:
+            verdict = 'improvement'
+        counts[verdict] += 1
+
+        if verdict != 'same' or not args.changes_only:
+            rows.append(describe(record) + [
+                len(old), len(new), '{:.3f}'.format(old_median), '{:.3f}'.format(new_median),
+                '{:+.2f}'.format(change * 100), '{:.2g}'.format(p), verdict
+            ])
+
+    # Largest slowdowns first
+    rows.sort(key=lambda row: -float(row[7]))
+    header = ['function', 'precision', 'problem', 'n_base', 'n_new', 'base_us', 'new_us',
+              'change_%', 'p', 'verdict']
+    if rows:
+        print_table(header, rows)
+        print()
+
+    matched = sum(counts.values())
+    print('{} matched, {} regressions, {} improvements, {} unchanged, {} insufficient samples; '
+          '{} only in baseline, {} only in candidate'.format(
+              matched, counts['regression'], counts['improvement'], counts['same'],
+              counts['insufficient'], len(base.keys() - cand.keys()),
+              len(cand.keys() - base.keys())))
+
+    if counts['insufficient']:
+        print('warning: {} problems have too few samples to be significant at alpha {}; write '
+              'the results with --iteration_timing --timing_samples or repeat the runs'.format(
+                  counts['insufficient'], args.alpha), file=sys.stderr)
+
+    arch = {r.get('device', {}).get('arch') for r, _ in list(base.values()) + list(cand.values())}
+    if len(arch) > 1:
+        print('warning: results from different devices: ' + ', '.join(sorted(map(str, arch))),
+              file=sys.stderr)
+
+    if counts['regression']:
+        return 1
+    return 2 if counts['insufficient'] else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
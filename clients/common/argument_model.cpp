@@ -47,3 +47,15 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static rocblas_client_output_format output_format = rocblas_client_output_format::table;
+
+void ArgumentModel_set_output_format(rocblas_client_output_format fmt)
+{
+    output_format = fmt;
+}
+
+rocblas_client_output_format ArgumentModel_get_output_format()
+{
+    return output_format;
+}
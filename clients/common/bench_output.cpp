@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bench_output.hpp"
+#include "argument_model.hpp"
+#include "utility.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+bool rocblas_client_output_format_parse(const std::string& str, rocblas_client_output_format& fmt)
+{
+    if(str == "table")
+        fmt = rocblas_client_output_format::table;
+    else if(str == "json")
+        fmt = rocblas_client_output_format::json;
+    else if(str == "csv")
+        fmt = rocblas_client_output_format::csv;
+    else
+        return false;
+    return true;
+}
+
+rocblas_int* rocblas_bench_solution_index_slot()
+{
+    static thread_local rocblas_int index = 0;
+    return &index;
+}
+
+namespace
+{
+    struct library_info
+    {
+        std::string version;
+        std::string commit;
+    };
+
+    struct device_info
+    {
+        int         id = 0;
+        std::string name;
+        std::string arch;
+        int         compute_units = 0;
+        int         clock_khz     = 0;
+        size_t      memory_bytes  = 0;
+    };
+
+    const library_info& get_library_info()
+    {
+        static const library_info info = [] {
+            library_info info;
+            size_t       size = 0;
+            if(rocblas_get_version_string_size(&size) == rocblas_status_success && size)
+            {
+                info.version.resize(size - 1);
+                rocblas_get_version_string(info.version.data(), size);
+            }
+            // The tweak component of the version is the commit id in release builds
+            auto dot    = info.version.rfind('.');
+            info.commit = dot == std::string::npos ? "" : info.version.substr(dot + 1);
+            return info;
+        }();
+        return info;
+    }
+
+    // Device properties of the current device, queried once per device
+    const device_info& get_device_info()
+    {
+        static std::mutex                mutex;
+        static std::map<int, device_info> devices;
+
+        int id = 0;
+        (void)hipGetDevice(&id);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = devices.find(id);
+        if(it == devices.end())
+        {
+            device_info     info;
+            hipDeviceProp_t props;
+            info.id = id;
+            if(hipGetDeviceProperties(&props, id) == hipSuccess)
+            {
+                info.name          = props.name;
+                info.arch          = props.gcnArchName;
+                info.compute_units = props.multiProcessorCount;
+                info.clock_khz     = props.clockRate;
+                info.memory_bytes  = props.totalGlobalMem;
+            }
+            it = devices.emplace(id, std::move(info)).first;
+        }
+        return it->second;
+    }
+
+    // Shortest decimal representation which reads back as the same double
+    std::string format_double(double x)
+    {
+        char s[32];
+        snprintf(s, sizeof(s), "%.15g", x);
+        if(strtod(s, nullptr) != x)
+            snprintf(s, sizeof(s), "%.17g", x);
+        return s;
+    }
+
+    // Values of Arguments fields and results as JSON or CSV text. Strings are returned
+    // quoted, with quoted set so that CSV can use its own quoting. Arrays are JSON text,
+    // which CSV writes as a quoted string.
+    struct field_value
+    {
+        std::string text;
+        bool        quoted = false;
+        bool        array  = false;
+    };
+
+    field_value to_field(const std::string& s)
+    {
+        return {s, true};
+    }
+
+    template <size_t N>
+    field_value to_field(const char (&s)[N])
+    {
+        return to_field(std::string(s, strnlen(s, N)));
+    }
+
+    field_value to_field(bool b)
+    {
+        return {b ? "true" : "false"};
+    }
+
+    field_value to_field(char c)
+    {
+        return to_field(std::string(1, c));
+    }
+
+    field_value to_field(double x)
+    {
+        // JSON has no NaN or infinity
+        return {std::isfinite(x) ? format_double(x) : "null"};
+    }
+
+    field_value to_field(const std::vector<double>& values)
+    {
+        std::string text = "[";
+        for(size_t i = 0; i < values.size(); i++)
+            text += (i ? "," : "") + to_field(values[i]).text;
+        return {text + "]", false, true};
+    }
+
+    // NA_value marks a result which was not measured
+    field_value result_field(double x)
+    {
+        return x == ArgumentLogging::NA_value ? field_value{"null"} : to_field(x);
+    }
+
+    template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+    field_value to_field(T x)
+    {
+        return {std::to_string(int64_t(x))};
+    }
+
+    // Enumerations use the same names as the YAML test data where they have them
+    template <typename T, std::enable_if_t<std::is_enum<T>{}, int> = 0>
+    field_value to_field(T x)
+    {
+        rocblas_internal_ostream os;
+        os << x;
+        std::string s = os.str();
+        char*       end;
+        (void)strtoll(s.c_str(), &end, 10);
+        return {s, s.empty() || *end};
+    }
+
+    void write_json_string(std::ostream& os, const std::string& s)
+    {
+        os << '"';
+        for(unsigned char c : s)
+        {
+            if(c == '"' || c == '\\')
+                os << '\\' << c;
+            else if(c < 0x20)
+            {
+                char esc[8];
+                snprintf(esc, sizeof(esc), "\\u%04x", c);
+                os << esc;
+            }
+            else
+                os << c;
+        }
+        os << '"';
+    }
+
+    void write_csv_value(std::ostream& os, const field_value& v)
+    {
+        if(!v.quoted && !v.array)
+            os << (v.text == "null" ? "" : v.text);
+        else if(v.text.find_first_of(",\"\n") == std::string::npos)
+            os << v.text;
+        else
+        {
+            os << '"';
+            for(char c : v.text)
+                os << (c == '"' ? "\"\"" : std::string(1, c));
+            os << '"';
+        }
+    }
+
+    // Calls f(section, name, value) for every field of a record, in schema order
+    template <typename F>
+    void for_each_field(const Arguments& arg, const rocblas_bench_result& result, F&& f)
+    {
+        const auto& lib = get_library_info();
+        const auto& dev = get_device_info();
+
+        f("", "schema_version", to_field(rocblas_bench_schema_version));
+
+        f("library", "version", to_field(lib.version));
+        f("library", "commit", to_field(lib.commit));
+
+        f("device", "id", to_field(dev.id));
+        f("device", "name", to_field(dev.name));
+        f("device", "arch", to_field(dev.arch));
+        f("device", "compute_units", to_field(dev.compute_units));
+        f("device", "clock_khz", to_field(dev.clock_khz));
+        f("device", "memory_bytes", to_field(dev.memory_bytes));
+
+#define ARGUMENT_FIELD(NAME) f("arguments", #NAME, to_field(arg.NAME))
+        FOR_EACH_ARGUMENT(ARGUMENT_FIELD, ;);
+#undef ARGUMENT_FIELD
+
+        rocblas_int solution = *rocblas_bench_solution_index_slot();
+        f("results", "solution_index", solution > 0 ? to_field(solution) : field_value{"null"});
+        f("results", "gpu_us", result_field(result.gpu_us));
+        f("results", "gflops", result_field(result.gflops));
+        f("results", "gbytes_per_s", result_field(result.gbytes_per_s));
+        f("results", "cpu_us", result_field(result.cpu_us));
+        f("results", "cpu_gflops", result_field(result.cpu_gflops));
+        f("results", "norm_error_1", result_field(result.norm_error[0]));
+        f("results", "norm_error_2", result_field(result.norm_error[1]));
+        f("results", "norm_error_3", result_field(result.norm_error[2]));
+        f("results", "norm_error_4", result_field(result.norm_error[3]));
+
+        const rocblas_timing_statistics* t  = result.timing;
+        double                           na = ArgumentLogging::NA_value;
+        f("timing", "samples", t ? to_field(t->samples) : field_value{"null"});
+        f("timing", "us_min", result_field(t ? t->min : na));
+        f("timing", "us_median", result_field(t ? t->median : na));
+        f("timing", "us_p90", result_field(t ? t->p90 : na));
+        f("timing", "us_p99", result_field(t ? t->p99 : na));
+        f("timing", "us_max", result_field(t ? t->max : na));
+        f("timing", "us_stddev", result_field(t ? t->stddev : na));
+        f("timing", "us_ci_low", result_field(t ? t->ci_low : na));
+        f("timing", "us_ci_high", result_field(t ? t->ci_high : na));
+        f("timing",
+          "us_values",
+          t && !t->values.empty() ? to_field(t->values) : field_value{"null"});
+
+        size_t copies = result.rotating_copies;
+        f("rotating", "copies", copies ? to_field(copies) : field_value{"null"});
+        f("rotating", "hot_us", result_field(copies ? result.hot_us : na));
+        f("rotating", "hot_gflops", result_field(copies ? result.hot_gflops : na));
+        f("rotating", "hot_gbytes_per_s", result_field(copies ? result.hot_gbytes_per_s : na));
+
+        f("graph", "us", result_field(result.graph_us));
+        f("graph", "gflops", result_field(result.graph_gflops));
+        f("graph", "gbytes_per_s", result_field(result.graph_gbytes_per_s));
+        f("graph", "launch_us", result_field(result.graph_launch_us));
+
+        size_t calls = result.breakdown_calls;
+        f("breakdown", "calls", calls ? to_field(calls) : field_value{"null"});
+        f("breakdown", "host_us", result_field(calls ? result.breakdown_host_us : na));
+        f("breakdown", "queue_us", result_field(calls ? result.breakdown_queue_us : na));
+        f("breakdown", "device_us", result_field(calls ? result.breakdown_device_us : na));
+        f("breakdown", "host_share", result_field(calls ? result.breakdown_host_share : na));
+        f("breakdown",
+          "host_bound_calls",
+          calls ? to_field(result.breakdown_host_bound_calls) : field_value{"null"});
+    }
+} // namespace
+
+void rocblas_bench_write_record(rocblas_internal_ostream&    os,
+                                rocblas_client_output_format fmt,
+                                const Arguments&             arg,
+                                const rocblas_bench_result&  result)
+{
+    std::ostringstream line;
+
+    if(fmt == rocblas_client_output_format::json)
+    {
+        // Fields of a section are contiguous, and become a nested object
+        std::string section;
+        bool        first_top = true, first_in_section = true;
+
+        auto write_value = [&](const char* name, const field_value& v) {
+            write_json_string(line, name);
+            line << ": ";
+            if(v.quoted)
+                write_json_string(line, v.text);
+            else
+                line << v.text;
+        };
+
+        line << "{";
+        for_each_field(arg, result, [&](const char* sect, const char* name, const field_value& v) {
+            if(!*sect)
+            {
+                line << (first_top ? "" : ", ");
+                first_top = false;
+                write_value(name, v);
+                return;
+            }
+
+            if(section != sect)
+            {
+                line << (section.empty() ? "" : "}") << (first_top ? "" : ", ");
+                first_top = false;
+                write_json_string(line, sect);
+                line << ": {";
+                section          = sect;
+                first_in_section = true;
+            }
+
+            line << (first_in_section ? "" : ", ");
+            first_in_section = false;
+            write_value(name, v);
+        });
+        line << (section.empty() ? "" : "}") << "}";
+    }
+    else
+    {
+        // The header is written once, before the first record
+        static std::atomic_flag header_written = ATOMIC_FLAG_INIT;
+        if(!header_written.test_and_set())
+        {
+            std::ostringstream header;
+            const char*        delim = "";
+            for_each_field(arg, result, [&](const char* sect, const char* name, const field_value&) {
+                header << delim << (*sect ? sect + std::string(".") : "") << name;
+                delim = ",";
+            });
+            os << header.str() << "\n";
+        }
+
+        const char* delim = "";
+        for_each_field(arg, result, [&](const char*, const char*, const field_value& v) {
+            line << delim;
+            write_csv_value(line, v);
+            delim = ",";
+        });
+    }
+
+    os << line.str() << std::endl;
+}
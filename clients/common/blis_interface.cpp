@@ -21,6 +21,7 @@
  * ************************************************************************ */
 
 #include "blis.h"
+#include <string>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -33,3 +34,20 @@ void setup_blis()
 }
 
 static int initialize_blis = (setup_blis(), 0);
+
+// Sets the number of BLIS threads for cblas_set_num_threads, returning the previous number,
+// which is -1 when BLIS chooses it
+int rocblas_blis_set_num_threads(int num_threads)
+{
+    int previous = int(bli_thread_get_num_threads());
+    if(num_threads != 0)
+        bli_thread_set_num_threads(num_threads);
+    return previous;
+}
+
+// Identifies BLIS and the architecture of its kernels for cblas_library_identity
+std::string rocblas_blis_identity()
+{
+    return std::string("BLIS ") + bli_info_get_version_str() + " "
+           + bli_arch_string(bli_arch_query_id());
+}
@@ -20,6 +20,7 @@
  *
  * ************************************************************************/
 #include "cblas_interface.hpp"
+#include "rocblas_convert.hpp"
 #include "rocblas_vector.hpp"
 #include "utility.hpp"
 #include <bitset>
@@ -27,6 +28,71 @@
 #include <omp.h>
 #endif
 
+/*
+ * ===========================================================================
+ *    batched references
+ * ===========================================================================
+ */
+
+#ifndef WIN32
+// Thread controls and configuration of the host BLAS, which are null when the library linked
+// does not have them. blis_interface.cpp defines the BLIS ones when linking BLIS.
+extern "C" {
+void  openblas_set_num_threads(int num_threads) __attribute__((weak));
+int   openblas_get_num_threads() __attribute__((weak));
+char* openblas_get_config() __attribute__((weak));
+char* openblas_get_corename() __attribute__((weak));
+}
+int         rocblas_blis_set_num_threads(int num_threads) __attribute__((weak));
+std::string rocblas_blis_identity() __attribute__((weak));
+#endif
+
+int cblas_set_num_threads(int num_threads)
+{
+#ifndef WIN32
+    if(rocblas_blis_set_num_threads)
+        return rocblas_blis_set_num_threads(num_threads);
+
+    if(openblas_set_num_threads && openblas_get_num_threads)
+    {
+        int previous = openblas_get_num_threads();
+        if(num_threads > 0)
+            openblas_set_num_threads(num_threads);
+        return previous;
+    }
+#endif
+    return 0;
+}
+
+std::string cblas_library_identity()
+{
+#ifndef WIN32
+    if(rocblas_blis_identity)
+        return rocblas_blis_identity();
+
+    if(openblas_get_config)
+        return std::string("OpenBLAS ") + openblas_get_config()
+               + (openblas_get_corename ? std::string(" ") + openblas_get_corename() : "");
+#endif
+    return "cblas";
+}
+
+int cblas_batched_threads(int64_t batch_count, double batch_gflops)
+{
+#ifdef _OPENMP
+    if(batch_count < 2 || omp_in_parallel())
+        return 1;
+
+    int64_t threads = omp_get_max_threads();
+    if(threads < 2 || (batch_count < threads && batch_gflops >= cblas_batched_large_gflops))
+        return 1;
+
+    return int(std::min(threads, batch_count));
+#else
+    return 1;
+#endif
+}
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -404,8 +470,7 @@ void cblas_gemv(rocblas_operation transA,
 
         host_vector<float> A_float(size_t(lda) * n), X_float(dim_x * abs_incx);
 
-        for(size_t i = 0; i < size_t(lda) * n; i++)
-            A_float[i] = static_cast<float>(A[i]);
+        rocblas_convert_n(A, A_float.data(), size_t(lda) * n);
 
         for(int64_t i = 0; i < dim_x; i++)
             X_float[i * abs_incx] = static_cast<float>(x[i * abs_incx]);
@@ -718,6 +783,8 @@ void cblas_geam(rocblas_operation       transa,
 }
 
 // gemm
+// cblas does not support rocblas_bfloat16 or rocblas_half, so compute in higher precision float
+// This will give more precise result which is acceptable for testing
 template <>
 void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation                    transA,
                                                 rocblas_operation                    transB,
@@ -734,35 +801,10 @@ void cblas_gemm<rocblas_bfloat16, float, float>(rocblas_operation
                                                 int64_t                              ldc,
                                                 rocblas_bfloat16::rocblas_truncate_t round)
 {
-    // cblas does not support rocblas_bfloat16, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C,
-                ldc);
+    auto load   = [](rocblas_bfloat16 x) { return static_cast<float>(x); };
+    auto load_c = [](float x) { return x; };
+    cblas_gemm_blocked(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load, load, load_c);
 }
 
 template <>
@@ -782,41 +824,9 @@ void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(
     int64_t                              ldc,
     rocblas_bfloat16::rocblas_truncate_t round)
 {
-    // cblas does not support rocblas_bfloat16, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = static_cast<float>(C[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<rocblas_bfloat16>(C_float[i]);
+    auto load = [](rocblas_bfloat16 x) { return static_cast<float>(x); };
+    cblas_gemm_blocked(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load, load, load);
 }
 
 template <>
@@ -835,35 +845,10 @@ void cblas_gemm<rocblas_half, float, float>(rocblas_operation
                                             int64_t                              ldc,
                                             rocblas_bfloat16::rocblas_truncate_t round)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C,
-                ldc);
+    auto load   = [](rocblas_half x) { return float(x); };
+    auto load_c = [](float x) { return x; };
+    cblas_gemm_blocked(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load, load, load_c);
 }
 
 template <>
@@ -882,53 +867,19 @@ void cblas_gemm<rocblas_half, rocblas_half, float>(rocblas_operation
                                                    int64_t                              ldc,
                                                    rocblas_bfloat16::rocblas_truncate_t round)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
     if(round != rocblas_bfloat16::rocblas_truncate_t::rocblas_round_near_even)
     {
-        for(size_t i = 0; i < sizeA; i++)
-            A_float[i] = rocblas_bfloat16(float(A[i]), round);
-        for(size_t i = 0; i < sizeB; i++)
-            B_float[i] = rocblas_bfloat16(float(B[i]), round);
-        for(size_t i = 0; i < sizeC; i++)
-            C_float[i] = rocblas_bfloat16(float(C[i]), round);
+        // The inputs are rounded to bfloat16 with the requested rounding
+        auto load = [round](rocblas_half x) { return float(rocblas_bfloat16(float(x), round)); };
+        cblas_gemm_blocked(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load, load, load);
     }
     else
     {
-        for(size_t i = 0; i < sizeA; i++)
-            A_float[i] = A[i];
-        for(size_t i = 0; i < sizeB; i++)
-            B_float[i] = B[i];
-        for(size_t i = 0; i < sizeC; i++)
-            C_float[i] = C[i];
+        auto load = [](rocblas_half x) { return float(x); };
+        cblas_gemm_blocked(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load, load, load);
     }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
 }
 
 template <>
@@ -948,43 +899,23 @@ void cblas_gemm<rocblas_half, rocblas_half, rocblas_half>(
     int64_t                              ldc,
     rocblas_bfloat16::rocblas_truncate_t round)
 {
-    // cblas does not support rocblas_half, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-    float alpha_float = alpha;
-    float beta_float  = beta;
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = A[i];
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = B[i];
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = C[i];
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha_float,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta_float,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = rocblas_half(C_float[i]);
+    auto load = [](rocblas_half x) { return float(x); };
+    cblas_gemm_blocked(transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       float(alpha),
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       float(beta),
+                       C,
+                       ldc,
+                       load,
+                       load,
+                       load);
 }
 
 template <>
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "graph_timing.hpp"
+#include "../../library/src/include/handle.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    rocblas_graph_timing_options graph_timing_options;
+
+    thread_local bool                        graph_timing_has_result = false;
+    thread_local rocblas_graph_timing_result graph_timing_result;
+}
+
+void rocblas_set_graph_timing(const rocblas_graph_timing_options& opt)
+{
+    graph_timing_options = opt;
+}
+
+const rocblas_graph_timing_options& rocblas_get_graph_timing()
+{
+    return graph_timing_options;
+}
+
+void rocblas_graph_timing_set_result(const rocblas_graph_timing_result& result)
+{
+    graph_timing_result     = result;
+    graph_timing_has_result = true;
+}
+
+void rocblas_graph_timing_clear_result()
+{
+    graph_timing_has_result = false;
+}
+
+bool rocblas_graph_timing_take_result(rocblas_graph_timing_result& result)
+{
+    if(!graph_timing_has_result)
+        return false;
+    result                  = graph_timing_result;
+    graph_timing_has_result = false;
+    return true;
+}
+
+rocblas_graph_capture::rocblas_graph_capture(rocblas_handle handle)
+    : m_handle(handle)
+{
+    m_handle->set_stream_order_memory_allocation(true);
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&m_stream, hipStreamNonBlocking));
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &m_old_stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(m_handle, m_stream));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(m_stream, hipStreamCaptureModeGlobal));
+    m_capturing = true;
+}
+
+rocblas_graph_capture::~rocblas_graph_capture()
+{
+    if(m_capturing)
+    {
+        hipGraph_t graph;
+        end_capture(&graph);
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    }
+    if(m_stream)
+        CHECK_HIP_ERROR(hipStreamDestroy(m_stream));
+}
+
+void rocblas_graph_capture::end_capture(hipGraph_t* graph)
+{
+    m_capturing = false;
+    CHECK_HIP_ERROR(hipStreamEndCapture(m_stream, graph));
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(m_handle, m_old_stream));
+    m_handle->set_stream_order_memory_allocation(false);
+}
+
+void rocblas_graph_capture::replay(rocblas_graph_timing_result& result)
+{
+    hipGraph_t     graph;
+    hipGraphExec_t instance;
+    end_capture(&graph);
+    CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, NULL, NULL, 0));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+    // The first launch uploads the graph to the device
+    CHECK_HIP_ERROR(hipGraphLaunch(instance, m_stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(m_stream));
+
+    hipEvent_t start, stop;
+    CHECK_HIP_ERROR(hipEventCreate(&start));
+    CHECK_HIP_ERROR(hipEventCreate(&stop));
+
+    CHECK_HIP_ERROR(hipEventRecord(start, m_stream));
+    double launch_us = get_time_us_no_sync();
+    CHECK_HIP_ERROR(hipGraphLaunch(instance, m_stream));
+    result.launch_us = get_time_us_no_sync() - launch_us;
+    CHECK_HIP_ERROR(hipEventRecord(stop, m_stream));
+    CHECK_HIP_ERROR(hipEventSynchronize(stop));
+
+    float ms = 0;
+    CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start, stop));
+    result.replay_us = ms * 1000.0;
+
+    CHECK_HIP_ERROR(hipEventDestroy(start));
+    CHECK_HIP_ERROR(hipEventDestroy(stop));
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "launch_breakdown.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <algorithm>
+
+namespace
+{
+    rocblas_launch_breakdown_options launch_breakdown_options;
+
+    thread_local bool                            launch_breakdown_has_result = false;
+    thread_local rocblas_launch_breakdown_result launch_breakdown_result;
+}
+
+void rocblas_set_launch_breakdown(const rocblas_launch_breakdown_options& opt)
+{
+    launch_breakdown_options = opt;
+}
+
+const rocblas_launch_breakdown_options& rocblas_get_launch_breakdown()
+{
+    return launch_breakdown_options;
+}
+
+void rocblas_launch_breakdown_set_result(const rocblas_launch_breakdown_result& result)
+{
+    launch_breakdown_result     = result;
+    launch_breakdown_has_result = true;
+}
+
+void rocblas_launch_breakdown_clear_result()
+{
+    launch_breakdown_has_result = false;
+}
+
+bool rocblas_launch_breakdown_take_result(rocblas_launch_breakdown_result& result)
+{
+    if(!launch_breakdown_has_result)
+        return false;
+    result                      = launch_breakdown_result;
+    launch_breakdown_has_result = false;
+    return true;
+}
+
+rocblas_launch_breakdown_timer::rocblas_launch_breakdown_timer(rocblas_handle handle)
+    : m_handle(handle)
+{
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(m_handle, &m_stream));
+    CHECK_HIP_ERROR(hipEventCreate(&m_entry));
+    CHECK_HIP_ERROR(hipEventCreate(&m_done));
+    CHECK_HIP_ERROR(hipEventCreate(&m_kernel_start));
+    CHECK_HIP_ERROR(hipEventCreate(&m_kernel_stop));
+}
+
+rocblas_launch_breakdown_timer::~rocblas_launch_breakdown_timer()
+{
+    rocblas_set_start_stop_events(m_handle, (hipEvent_t)0, (hipEvent_t)0);
+    for(hipEvent_t event : {m_entry, m_done, m_kernel_start, m_kernel_stop})
+        if(event)
+            CHECK_HIP_ERROR(hipEventDestroy(event));
+}
+
+void rocblas_launch_breakdown_timer::start()
+{
+    CHECK_HIP_ERROR(hipStreamSynchronize(m_stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_start_stop_events(m_handle, m_kernel_start, m_kernel_stop));
+
+    // On the idle stream the entry event completes as soon as it is recorded
+    CHECK_HIP_ERROR(hipEventRecord(m_entry, m_stream));
+    m_entry_us = get_time_us_no_sync();
+}
+
+void rocblas_launch_breakdown_timer::stop()
+{
+    double host_us = get_time_us_no_sync() - m_entry_us;
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_start_stop_events(m_handle, (hipEvent_t)0, (hipEvent_t)0));
+    CHECK_HIP_ERROR(hipEventRecord(m_done, m_stream));
+    CHECK_HIP_ERROR(hipEventSynchronize(m_done));
+
+    float span_ms = 0;
+    CHECK_HIP_ERROR(hipEventElapsedTime(&span_ms, m_entry, m_done));
+
+    // The kernel events are only recorded by functions launching Tensile kernels, and are
+    // left over from an earlier call when they precede the entry event
+    float queue_ms = -1, kernel_ms = 0;
+    bool  kernel   = hipEventElapsedTime(&queue_ms, m_entry, m_kernel_start) == hipSuccess
+                  && queue_ms >= 0
+                  && hipEventElapsedTime(&kernel_ms, m_kernel_start, m_kernel_stop)
+                         == hipSuccess;
+    if(!kernel)
+        (void)hipGetLastError();
+
+    double device_us = kernel ? kernel_ms * 1000.0 : std::max(span_ms * 1000.0 - host_us, 0.0);
+    double total_us  = host_us + device_us;
+
+    m_calls++;
+    m_host_us += host_us;
+    m_device_us += device_us;
+    if(kernel)
+    {
+        m_kernel_calls++;
+        m_queue_us += queue_ms * 1000.0;
+    }
+    if(total_us > 0 && host_us / total_us > rocblas_get_launch_breakdown().host_threshold)
+        m_host_bound_calls++;
+}
+
+void rocblas_launch_breakdown_timer::finish(rocblas_launch_breakdown_result& result) const
+{
+    result       = rocblas_launch_breakdown_result{};
+    result.calls = m_calls;
+    if(!m_calls)
+        return;
+
+    result.host_us          = m_host_us / m_calls;
+    result.device_us        = m_device_us / m_calls;
+    result.host_bound_calls = m_host_bound_calls;
+
+    // Functions either always or never record the kernel events
+    result.kernel_events = m_kernel_calls == m_calls;
+    result.queue_us      = result.kernel_events ? m_queue_us / m_calls : 0;
+
+    double total_us   = result.host_us + result.device_us;
+    result.host_share = total_us > 0 ? result.host_us / total_us : 0;
+}
@@ -65,6 +65,8 @@ void Arguments::init()
     beta   = 0.0;
     betai  = 0.0;
 
+    weight = 1.0;
+
     stride_a = 0;
     stride_b = 0;
     stride_c = 0;
@@ -0,0 +1,293 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_convert.hpp"
+#include <array>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define ROCBLAS_CONVERT_X86 1
+#endif
+
+namespace
+{
+    constexpr size_t block = size_t(1) << 14;
+
+    // Call convert(first, count) on blocks of the n elements, in parallel for large n
+    template <typename F>
+    void for_each_block(size_t n, F convert)
+    {
+#pragma omp parallel for schedule(static) if(n >= rocblas_convert_parallel_min)
+        for(size_t i = 0; i < n; i += block)
+            convert(i, std::min(block, n - i));
+    }
+
+#ifdef ROCBLAS_CONVERT_X86
+    const bool has_f16c = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    const bool has_avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+    void half_to_float(const rocblas_half* src, float* dst, size_t n)
+    {
+        for(size_t i = 0; i < n; i++)
+            dst[i] = float(src[i]);
+    }
+
+    void float_to_half(const float* src, rocblas_half* dst, size_t n)
+    {
+        for(size_t i = 0; i < n; i++)
+            dst[i] = rocblas_half(src[i]);
+    }
+
+#ifdef ROCBLAS_CONVERT_X86
+    // vcvtph2ps and vcvtps2ph round to nearest even as the scalar conversions do, but the
+    // quieting of signaling NaN depends on the runtime library, so groups with NaN are
+    // converted by the scalar conversions
+    __attribute__((target("avx,f16c"))) void
+        half_to_float_f16c(const rocblas_half* src, float* dst, size_t n)
+    {
+        const __m128i abs_mask = _mm_set1_epi16(0x7fff);
+        const __m128i inf      = _mm_set1_epi16(0x7c00);
+
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+        {
+            __m128i h = _mm_loadu_si128((const __m128i*)(src + i));
+            if(_mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(h, abs_mask), inf)))
+                half_to_float(src + i, dst + i, 8);
+            else
+                _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+        }
+        half_to_float(src + i, dst + i, n - i);
+    }
+
+    __attribute__((target("avx,f16c"))) void
+        float_to_half_f16c(const float* src, rocblas_half* dst, size_t n)
+    {
+        size_t i = 0;
+        for(; i + 8 <= n; i += 8)
+        {
+            __m256 f = _mm256_loadu_ps(src + i);
+            if(_mm256_movemask_ps(_mm256_cmp_ps(f, f, _CMP_UNORD_Q)))
+                float_to_half(src + i, dst + i, 8);
+            else
+                _mm_storeu_si128((__m128i*)(dst + i),
+                                 _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+        }
+        float_to_half(src + i, dst + i, n - i);
+    }
+#endif
+
+    // The bfloat16 conversions on the bits, without branches so that they vectorize
+    __attribute__((always_inline)) inline void
+        bfloat16_to_float_bits(const rocblas_bfloat16* src, float* dst, size_t n)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            uint32_t x = uint32_t(src[i].data) << 16;
+            memcpy(dst + i, &x, sizeof(x));
+        }
+    }
+
+    template <rocblas_bfloat16::rocblas_truncate_t round>
+    __attribute__((always_inline)) inline void
+        float_to_bfloat16_bits(const float* src, rocblas_bfloat16* dst, size_t n)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            uint32_t x;
+            memcpy(&x, src + i, sizeof(x));
+
+            // Inf and NaN are not rounded, and NaN keeps a mantissa bit set, as in
+            // rocblas_bfloat16::float_to_bfloat16()
+            uint32_t inf_nan = (~x & 0x7f800000) == 0;
+            uint32_t add     = 0;
+            if constexpr(round == rocblas_bfloat16::rocblas_round_near_even)
+                add = 0x7fff + ((x >> 16) & 1);
+            else if constexpr(round == rocblas_bfloat16::rocblas_round_near_zero)
+                add = 0x7fff;
+
+            uint32_t nan = inf_nan & ((x & 0xffff) != 0);
+            uint32_t y   = inf_nan ? x | (nan << 16) : x + add;
+            dst[i].data  = uint16_t(y >> 16);
+        }
+    }
+
+    void bfloat16_to_float(const rocblas_bfloat16* src, float* dst, size_t n)
+    {
+        bfloat16_to_float_bits(src, dst, n);
+    }
+
+    template <rocblas_bfloat16::rocblas_truncate_t round>
+    void float_to_bfloat16(const float* src, rocblas_bfloat16* dst, size_t n)
+    {
+        float_to_bfloat16_bits<round>(src, dst, n);
+    }
+
+#ifdef ROCBLAS_CONVERT_X86
+    __attribute__((target("avx2"))) void
+        bfloat16_to_float_avx2(const rocblas_bfloat16* src, float* dst, size_t n)
+    {
+        bfloat16_to_float_bits(src, dst, n);
+    }
+
+    template <rocblas_bfloat16::rocblas_truncate_t round>
+    __attribute__((target("avx2"))) void
+        float_to_bfloat16_avx2(const float* src, rocblas_bfloat16* dst, size_t n)
+    {
+        float_to_bfloat16_bits<round>(src, dst, n);
+    }
+#endif
+
+    template <rocblas_bfloat16::rocblas_truncate_t round>
+    void float_to_bfloat16_n(const float* src, rocblas_bfloat16* dst, size_t n)
+    {
+        for_each_block(n, [=](size_t i, size_t count) {
+#ifdef ROCBLAS_CONVERT_X86
+            if(has_avx2)
+                return float_to_bfloat16_avx2<round>(src + i, dst + i, count);
+#endif
+            float_to_bfloat16<round>(src + i, dst + i, count);
+        });
+    }
+
+    // The float values of the 256 float8 bit patterns
+    template <typename T>
+    const std::array<float, 256>& float8_values()
+    {
+        static const std::array<float, 256> values = [] {
+            std::array<float, 256> values;
+            for(int i = 0; i < 256; i++)
+            {
+                T x;
+                x.data    = uint8_t(i);
+                values[i] = float(x);
+            }
+            return values;
+        }();
+        return values;
+    }
+
+    template <typename T>
+    void float8_to_float_n(const T* src, float* dst, size_t n)
+    {
+        const float* values = float8_values<T>().data();
+        for_each_block(n, [=](size_t i, size_t count) {
+            for(size_t j = i; j < i + count; j++)
+                dst[j] = values[src[j].data];
+        });
+    }
+
+    template <typename T>
+    void float_to_float8_n(const float*                             src,
+                           T*                                       dst,
+                           size_t                                   n,
+                           typename T::rocblas_hip_f8_rounding_mode rm,
+                           const uint32_t*                          rng)
+    {
+        for_each_block(n, [=](size_t i, size_t count) {
+            if(rm == T::rocblas_hip_f8_rounding_mode::stochastic)
+                for(size_t j = i; j < i + count; j++)
+                    dst[j] = T(src[j], rm, rng[j]);
+            else
+                for(size_t j = i; j < i + count; j++)
+                    dst[j] = T(src[j], rm);
+        });
+    }
+}
+
+void rocblas_convert_n(const rocblas_half* src, float* dst, size_t n)
+{
+    for_each_block(n, [=](size_t i, size_t count) {
+#ifdef ROCBLAS_CONVERT_X86
+        if(has_f16c)
+            return half_to_float_f16c(src + i, dst + i, count);
+#endif
+        half_to_float(src + i, dst + i, count);
+    });
+}
+
+void rocblas_convert_n(const float* src, rocblas_half* dst, size_t n)
+{
+    for_each_block(n, [=](size_t i, size_t count) {
+#ifdef ROCBLAS_CONVERT_X86
+        if(has_f16c)
+            return float_to_half_f16c(src + i, dst + i, count);
+#endif
+        float_to_half(src + i, dst + i, count);
+    });
+}
+
+void rocblas_convert_n(const rocblas_bfloat16* src, float* dst, size_t n)
+{
+    for_each_block(n, [=](size_t i, size_t count) {
+#ifdef ROCBLAS_CONVERT_X86
+        if(has_avx2)
+            return bfloat16_to_float_avx2(src + i, dst + i, count);
+#endif
+        bfloat16_to_float(src + i, dst + i, count);
+    });
+}
+
+void rocblas_convert_n(const float*                         src,
+                       rocblas_bfloat16*                    dst,
+                       size_t                               n,
+                       rocblas_bfloat16::rocblas_truncate_t round)
+{
+    switch(round)
+    {
+    case rocblas_bfloat16::rocblas_round_near_even:
+        return float_to_bfloat16_n<rocblas_bfloat16::rocblas_round_near_even>(src, dst, n);
+    case rocblas_bfloat16::rocblas_round_near_zero:
+        return float_to_bfloat16_n<rocblas_bfloat16::rocblas_round_near_zero>(src, dst, n);
+    case rocblas_bfloat16::rocblas_truncate:
+        return float_to_bfloat16_n<rocblas_bfloat16::rocblas_truncate>(src, dst, n);
+    }
+}
+
+void rocblas_convert_n(const rocblas_f8* src, float* dst, size_t n)
+{
+    float8_to_float_n(src, dst, n);
+}
+
+void rocblas_convert_n(const rocblas_bf8* src, float* dst, size_t n)
+{
+    float8_to_float_n(src, dst, n);
+}
+
+void rocblas_convert_n(const float*                             src,
+                       rocblas_f8*                              dst,
+                       size_t                                   n,
+                       rocblas_f8::rocblas_hip_f8_rounding_mode rm,
+                       const uint32_t*                          rng)
+{
+    float_to_float8_n(src, dst, n, rm, rng);
+}
+
+void rocblas_convert_n(const float*                              src,
+                       rocblas_bf8*                              dst,
+                       size_t                                    n,
+                       rocblas_bf8::rocblas_hip_f8_rounding_mode rm,
+                       const uint32_t*                           rng)
+{
+    float_to_float8_n(src, dst, n, rm, rng);
+}
@@ -0,0 +1,211 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocblas_data.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <sstream>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(RocBLAS_TestData_File::index_function) == sizeof(Arguments::function) + 16
+                  && sizeof(RocBLAS_TestData_File::index_footer) == 16,
+              "Index layout must match rocblas_gentest.py");
+
+RocBLAS_TestData_File::RocBLAS_TestData_File(const std::string& path)
+{
+    map(path);
+    if(!m_data)
+    {
+        std::ifstream ifs(path, std::ifstream::in | std::ifstream::binary);
+        if(!ifs)
+        {
+            rocblas_cerr << "Cannot open " << path << ": " << strerror(errno) << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        m_buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+
+    // Validate the data file format
+    std::istringstream signature(std::string(m_data, std::min(m_size, signature_size)));
+    Arguments::validate(signature);
+
+    if(!read_index())
+        build_index();
+}
+
+RocBLAS_TestData_File::~RocBLAS_TestData_File()
+{
+    unmap();
+}
+
+std::vector<size_t> RocBLAS_TestData_File::select(bool function_filter(const Arguments&)) const
+{
+    std::vector<size_t> selected;
+    for(const auto& function : m_functions)
+        if(!function_filter || function_filter((*this)[function.first]))
+            selected.insert(selected.end(), function.records.begin(), function.records.end());
+
+    // Restore the order of the tests in the file
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+bool RocBLAS_TestData_File::read_index()
+{
+    index_footer footer;
+    if(m_size < signature_size + sizeof(footer))
+        return false;
+    memcpy(&footer, m_data + m_size - sizeof(footer), sizeof(footer));
+
+    size_t end = m_size - sizeof(footer);
+    if(memcmp(footer.magic, "RBTDIDX", 8) || footer.offset < signature_size
+       || (footer.offset - signature_size) % sizeof(Arguments)
+       || footer.offset + sizeof(uint64_t) > end)
+        return false;
+
+    size_t      records = (footer.offset - signature_size) / sizeof(Arguments);
+    const char* p       = m_data + footer.offset;
+    uint64_t    count;
+    memcpy(&count, p, sizeof(count));
+    p += sizeof(count);
+    if(count > (end - footer.offset - sizeof(count)) / sizeof(index_function))
+        return false;
+
+    const char* numbers = p + count * sizeof(index_function);
+    size_t      total   = (m_data + end - numbers) / sizeof(uint64_t);
+    if(numbers + total * sizeof(uint64_t) != m_data + end)
+        return false;
+
+    std::vector<function_records> functions(count);
+    for(auto& function : functions)
+    {
+        index_function entry;
+        memcpy(&entry, p, sizeof(entry));
+        p += sizeof(entry);
+        if(!entry.count || entry.first > total || entry.count > total - entry.first)
+            return false;
+
+        function.records.resize(entry.count);
+        for(size_t i = 0; i < entry.count; i++)
+        {
+            uint64_t number;
+            memcpy(&number, numbers + (entry.first + i) * sizeof(uint64_t), sizeof(number));
+            if(number >= records)
+                return false;
+            function.records[i] = number;
+        }
+        function.first = function.records[0];
+    }
+
+    m_records   = records;
+    m_functions = std::move(functions);
+    m_indexed   = true;
+    return true;
+}
+
+void RocBLAS_TestData_File::build_index()
+{
+    // Without an index, all of the file after the signature holds records
+    m_records = (m_size - signature_size) / sizeof(Arguments);
+
+    std::map<std::string, size_t> position;
+    for(size_t i = 0; i < m_records; i++)
+    {
+        const char* function = m_data + signature_size + i * sizeof(Arguments)
+                               + offsetof(Arguments, function);
+        std::string name(function, strnlen(function, sizeof(Arguments::function)));
+
+        auto it = position.emplace(name, m_functions.size());
+        if(it.second)
+            m_functions.push_back({i, {}});
+        m_functions[it.first->second].records.push_back(i);
+    }
+}
+
+void RocBLAS_TestData_File::map(const std::string& path)
+{
+#ifdef WIN32
+    HANDLE file = CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return;
+    LARGE_INTEGER size;
+    if(GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping)
+        {
+            m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            m_size = m_data ? size_t(size.QuadPart) : 0;
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return;
+    struct stat st;
+    if(!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            m_data = static_cast<const char*>(data);
+            m_size = st.st_size;
+        }
+    }
+    close(fd);
+#endif
+    m_mapped = m_data != nullptr;
+}
+
+void RocBLAS_TestData_File::unmap()
+{
+    if(m_mapped)
+    {
+#ifdef WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+    }
+    m_data   = nullptr;
+    m_size   = 0;
+    m_mapped = false;
+}
@@ -0,0 +1,2801 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Expansion of YAML test data, following rocblas_gentest.py step by step. Where the script
+// relies on Python semantics, such as "x in 'string'" being a substring test, the same
+// semantics are implemented here, so that both write the same records.
+
+#include "rocblas_gentest.hpp"
+#include "rocblas_hash.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#error no filesystem found
+#endif
+
+#ifndef WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    [[noreturn]] void fail(const std::string& message)
+    {
+        throw std::runtime_error(message);
+    }
+
+    /**********************************************************************
+     * YAML source, with include: lines replaced by the included files    *
+     **********************************************************************/
+    class yaml_source
+    {
+        struct line_info
+        {
+            size_t offset; // of the line in text
+            size_t file;
+            size_t line_no;
+        };
+
+        std::vector<line_info>   m_lines;
+        std::vector<std::string> m_files;
+
+        // Matches include\s*:\s*([-.\w/]+) at the start of the line
+        static bool match_include(std::string_view line, std::string& name, size_t& column)
+        {
+            if(line.compare(0, 7, "include"))
+                return false;
+            size_t i = 7;
+            while(i < line.size() && isspace(line[i]))
+                ++i;
+            if(i == line.size() || line[i++] != ':')
+                return false;
+            while(i < line.size() && isspace(line[i]))
+                ++i;
+            column = i;
+            while(i < line.size()
+                  && (isalnum(line[i]) || strchr("-._/", line[i]) || (line[i] & 0x80)))
+                ++i;
+            name = line.substr(column, i - column);
+            return !name.empty();
+        }
+
+    public:
+        std::string text;
+
+        void read(const std::string& path, const std::vector<std::string>& includes)
+        {
+            std::ifstream is(path, std::ios::binary);
+            if(!is)
+                fail("Cannot open " + path);
+            std::string raw{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+            // Universal newlines, as Python reads text files
+            std::string contents;
+            contents.reserve(raw.size());
+            for(size_t i = 0; i < raw.size(); ++i)
+            {
+                if(raw[i] != '\r')
+                    contents += raw[i];
+                else
+                {
+                    contents += '\n';
+                    if(i + 1 < raw.size() && raw[i + 1] == '\n')
+                        ++i;
+                }
+            }
+
+            std::string file_dir = fs::path(path).parent_path().string();
+            if(file_dir.empty())
+                file_dir = fs::current_path().string();
+
+            size_t file = m_files.size();
+            m_files.push_back(path);
+
+            size_t line_no = 0;
+            for(size_t begin = 0; begin < contents.size();)
+            {
+                size_t end = contents.find('\n', begin);
+                end        = end == std::string::npos ? contents.size() : end + 1;
+                std::string_view line(contents.data() + begin, end - begin);
+                begin = end;
+                ++line_no;
+
+                std::string include_file;
+                size_t      column;
+                if(!match_include(line, include_file, column))
+                {
+                    m_lines.push_back({text.size(), file, line_no});
+                    text.append(line);
+                    continue;
+                }
+
+                std::vector<std::string> include_dirs{file_dir};
+                include_dirs.insert(include_dirs.end(), includes.begin(), includes.end());
+
+                bool found = false;
+                for(const auto& dir : include_dirs)
+                {
+                    auto include_path = fs::path(dir) / include_file;
+                    if(fs::exists(include_path))
+                    {
+                        read(include_path.string(), includes);
+                        found = true;
+                        break;
+                    }
+                }
+
+                if(!found)
+                {
+                    std::string message = "In file " + path + ", line " + std::to_string(line_no)
+                                          + ", column " + std::to_string(column + 1) + ":\n";
+                    message += std::string(line.substr(0, line.find_last_not_of(" \t\n") + 1))
+                               + "\n" + std::string(column, ' ') + "^\nCannot open "
+                               + include_file + "\n\nInclude paths:";
+                    for(const auto& dir : include_dirs)
+                        message += "\n" + dir;
+                    fail(message);
+                }
+            }
+        }
+
+        // Location of a position in the text, for diagnostics
+        std::string mark(size_t pos) const
+        {
+            auto it = std::upper_bound(
+                m_lines.begin(), m_lines.end(), pos, [](size_t p, const line_info& line) {
+                    return p < line.offset;
+                });
+            if(it == m_lines.begin())
+                return "";
+            --it;
+            size_t end = text.find('\n', it->offset);
+            if(end == std::string::npos)
+                end = text.size();
+            while(end > it->offset && isspace(text[end - 1]))
+                --end;
+            size_t column = pos - it->offset;
+            return "In file " + m_files[it->file] + ", line " + std::to_string(it->line_no)
+                   + ", column " + std::to_string(column + 1) + ":\n"
+                   + text.substr(it->offset, end - it->offset) + "\n" + std::string(column, ' ')
+                   + "^\n";
+        }
+    };
+
+    /**********************************************************************
+     * YAML nodes, which are also the values of the test arguments        *
+     **********************************************************************/
+    struct yaml_node
+    {
+        enum kind_t
+        {
+            null_k,
+            bool_k,
+            int_k,
+            float_k,
+            str_k,
+            seq_k,
+            map_k,
+            merge_k, // the << key
+        };
+
+        kind_t                                                     kind = null_k;
+        bool                                                       b    = false;
+        int64_t                                                    i    = 0;
+        double                                                     f    = 0;
+        std::string                                                s;
+        std::vector<const yaml_node*>                              seq;
+        std::vector<std::pair<const yaml_node*, const yaml_node*>> map;
+        std::unordered_map<std::string_view, size_t>               str_keys; // positions in map
+
+        explicit yaml_node(kind_t kind)
+            : kind(kind)
+        {
+        }
+
+        bool is_number() const
+        {
+            return kind == bool_k || kind == int_k || kind == float_k;
+        }
+
+        double number() const
+        {
+            return kind == float_k ? f : kind == bool_k ? double(b) : double(i);
+        }
+
+        const yaml_node* get(std::string_view key) const
+        {
+            auto it = str_keys.find(key);
+            return it == str_keys.end() ? nullptr : map[it->second].second;
+        }
+    };
+
+    // Python == of two values
+    bool py_equal(const yaml_node* a, const yaml_node* b)
+    {
+        if(a == b)
+            return true;
+        if(a->is_number() && b->is_number())
+        {
+            if(a->kind != yaml_node::float_k && b->kind != yaml_node::float_k)
+                return (a->kind == yaml_node::bool_k ? a->b : a->i)
+                       == (b->kind == yaml_node::bool_k ? b->b : b->i);
+            return a->number() == b->number();
+        }
+        auto kind = [](const yaml_node* n) {
+            return n->kind == yaml_node::merge_k ? yaml_node::str_k : n->kind;
+        };
+        if(kind(a) != kind(b))
+            return false;
+        switch(kind(a))
+        {
+        case yaml_node::null_k:
+            return true;
+        case yaml_node::str_k:
+            return a->s == b->s;
+        case yaml_node::seq_k:
+            return a->seq.size() == b->seq.size()
+                   && std::equal(a->seq.begin(), a->seq.end(), b->seq.begin(), py_equal);
+        case yaml_node::map_k:
+            if(a->map.size() != b->map.size())
+                return false;
+            for(const auto& item : a->map)
+            {
+                auto it = std::find_if(b->map.begin(), b->map.end(), [&](const auto& other) {
+                    return py_equal(item.first, other.first);
+                });
+                if(it == b->map.end() || !py_equal(item.second, it->second))
+                    return false;
+            }
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Python truth value
+    bool py_truth(const yaml_node* n)
+    {
+        switch(n->kind)
+        {
+        case yaml_node::null_k:
+            return false;
+        case yaml_node::bool_k:
+            return n->b;
+        case yaml_node::int_k:
+            return n->i != 0;
+        case yaml_node::float_k:
+            return n->f != 0;
+        case yaml_node::seq_k:
+            return !n->seq.empty();
+        case yaml_node::map_k:
+            return !n->map.empty();
+        default:
+            return !n->s.empty();
+        }
+    }
+
+    const char* py_type(const yaml_node* n)
+    {
+        static const char* const names[]
+            = {"NoneType", "bool", "int", "float", "str", "list", "dict", "str"};
+        return names[n->kind];
+    }
+
+    // Python repr(), for diagnostics
+    std::string py_repr(const yaml_node* n)
+    {
+        switch(n->kind)
+        {
+        case yaml_node::null_k:
+            return "None";
+        case yaml_node::bool_k:
+            return n->b ? "True" : "False";
+        case yaml_node::int_k:
+            return std::to_string(n->i);
+        case yaml_node::float_k:
+        {
+            if(std::isnan(n->f))
+                return "nan";
+            if(std::isinf(n->f))
+                return n->f < 0 ? "-inf" : "inf";
+            char buf[32];
+            for(int precision = 1; precision <= 17; ++precision)
+            {
+                snprintf(buf, sizeof(buf), "%.*g", precision, n->f);
+                if(strtod(buf, nullptr) == n->f)
+                    break;
+            }
+            std::string s = buf;
+            if(s.find_first_of(".en") == std::string::npos)
+                s += ".0";
+            return s;
+        }
+        case yaml_node::seq_k:
+        {
+            std::string s = "[";
+            for(size_t i = 0; i < n->seq.size(); ++i)
+                s += (i ? ", " : "") + py_repr(n->seq[i]);
+            return s + "]";
+        }
+        case yaml_node::map_k:
+        {
+            std::string s = "{";
+            for(size_t i = 0; i < n->map.size(); ++i)
+                s += (i ? ", " : "") + py_repr(n->map[i].first) + ": "
+                     + py_repr(n->map[i].second);
+            return s + "}";
+        }
+        default:
+        {
+            char quote = n->s.find('\'') != std::string::npos && n->s.find('"') == std::string::npos
+                             ? '"'
+                             : '\'';
+            std::string s(1, quote);
+            for(char c : n->s)
+            {
+                if(c == quote || c == '\\')
+                    s += '\\';
+                if(c == '\n')
+                    s += "\\n";
+                else if(c == '\r')
+                    s += "\\r";
+                else if(c == '\t')
+                    s += "\\t";
+                else if(c >= 0 && c < ' ')
+                {
+                    char buf[8];
+                    snprintf(buf, sizeof(buf), "\\x%02x", c);
+                    s += buf;
+                }
+                else
+                    s += c;
+            }
+            return s + quote;
+        }
+        }
+    }
+
+    // Owns the nodes of all documents, and the values computed during the expansion
+    class yaml_store
+    {
+        std::deque<yaml_node>                          m_nodes;
+        std::unordered_map<int64_t, const yaml_node*>  m_ints;
+        std::unordered_map<uint64_t, const yaml_node*> m_floats;
+        std::unordered_map<std::string, const yaml_node*> m_strings;
+
+    public:
+        yaml_node& make(yaml_node::kind_t kind)
+        {
+            return m_nodes.emplace_back(kind);
+        }
+
+        const yaml_node* null()
+        {
+            static const yaml_node none(yaml_node::null_k);
+            return &none;
+        }
+
+        const yaml_node* boolean(bool b)
+        {
+            static const yaml_node values[2] = {yaml_node(yaml_node::bool_k), [] {
+                                                    yaml_node n(yaml_node::bool_k);
+                                                    n.b = true;
+                                                    return n;
+                                                }()};
+            return &values[b];
+        }
+
+        const yaml_node* integer(int64_t i)
+        {
+            auto& n = m_ints[i];
+            if(!n)
+            {
+                auto& node = make(yaml_node::int_k);
+                node.i     = i;
+                n          = &node;
+            }
+            return n;
+        }
+
+        const yaml_node* floating(double f)
+        {
+            uint64_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            auto& n = m_floats[bits];
+            if(!n)
+            {
+                auto& node = make(yaml_node::float_k);
+                node.f     = f;
+                n          = &node;
+            }
+            return n;
+        }
+
+        const yaml_node* string(const std::string& s)
+        {
+            auto& n = m_strings[s];
+            if(!n)
+            {
+                auto& node = make(yaml_node::str_k);
+                node.s     = s;
+                n          = &node;
+            }
+            return n;
+        }
+    };
+
+    /**********************************************************************
+     * YAML parser, resolving plain scalars as PyYAML does                *
+     **********************************************************************/
+    class yaml_parser
+    {
+        using pairs_t = std::vector<std::pair<const yaml_node*, const yaml_node*>>;
+
+        const yaml_source&                                m_source;
+        const std::string&                                m_text;
+        yaml_store&                                       m_store;
+        size_t                                            m_pos  = 0;
+        int                                               m_flow = 0;
+        std::unordered_map<std::string, const yaml_node*> m_anchors;
+
+        char peek(size_t k = 0) const
+        {
+            return m_pos + k < m_text.size() ? m_text[m_pos + k] : '\0';
+        }
+
+        static bool blank(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\0';
+        }
+
+        static bool flow_indicator(char c)
+        {
+            return c == ',' || c == '[' || c == ']' || c == '{' || c == '}';
+        }
+
+        size_t line_begin() const
+        {
+            size_t p = m_pos;
+            while(p && m_text[p - 1] != '\n')
+                --p;
+            return p;
+        }
+
+        int column() const
+        {
+            return int(m_pos - line_begin());
+        }
+
+        bool first_on_line() const
+        {
+            for(size_t p = line_begin(); p < m_pos; ++p)
+                if(m_text[p] != ' ' && m_text[p] != '\t')
+                    return false;
+            return true;
+        }
+
+        bool document_marker(const char* marker) const
+        {
+            return !m_text.compare(m_pos, 3, marker) && blank(peek(3)) && !column();
+        }
+
+        bool end_of_document() const
+        {
+            return !peek() || document_marker("---") || document_marker("...");
+        }
+
+        bool sequence_entry() const
+        {
+            return peek() == '-' && blank(peek(1));
+        }
+
+        [[noreturn]] void error(const std::string& problem, size_t pos) const
+        {
+            fail(m_source.mark(pos) + problem + "\n");
+        }
+
+        [[noreturn]] void error(const std::string& problem) const
+        {
+            error(problem, m_pos);
+        }
+
+        // Skips whitespace, comments and line breaks
+        void skip()
+        {
+            for(;;)
+            {
+                char c = peek();
+                if(c == ' ' || c == '\t' || c == '\n')
+                    ++m_pos;
+                else if(c == '#')
+                    while(peek() && peek() != '\n')
+                        ++m_pos;
+                else
+                    break;
+            }
+        }
+
+        std::string scan_name()
+        {
+            size_t start = ++m_pos;
+            while(!blank(peek()) && !flow_indicator(peek()))
+                ++m_pos;
+            if(m_pos == start)
+                error("expected alphabetic or numeric character", start);
+            return m_text.substr(start, m_pos - start);
+        }
+
+        void check_anchor(const std::string& name, size_t pos) const
+        {
+            if(m_anchors.count(name))
+                error("second occurrence", pos);
+        }
+
+        const yaml_node* alias()
+        {
+            size_t start = m_pos;
+            auto   it    = m_anchors.find(scan_name());
+            if(it == m_anchors.end())
+                error("found undefined alias", start);
+            return it->second;
+        }
+
+        static void append_utf8(std::string& s, uint32_t c)
+        {
+            if(c < 0x80)
+                s += char(c);
+            else if(c < 0x800)
+                s += {char(0xC0 | c >> 6), char(0x80 | (c & 0x3F))};
+            else if(c < 0x10000)
+                s += {char(0xE0 | c >> 12), char(0x80 | (c >> 6 & 0x3F)), char(0x80 | (c & 0x3F))};
+            else
+                s += {char(0xF0 | c >> 18),
+                      char(0x80 | (c >> 12 & 0x3F)),
+                      char(0x80 | (c >> 6 & 0x3F)),
+                      char(0x80 | (c & 0x3F))};
+        }
+
+        std::string scan_quoted()
+        {
+            size_t      start = m_pos;
+            char        quote = peek();
+            std::string s;
+            ++m_pos;
+            for(;;)
+            {
+                char c = peek();
+                if(!c)
+                    error("while scanning a quoted scalar, found unexpected end of stream", start);
+                if(c == quote)
+                {
+                    if(quote == '\'' && peek(1) == '\'')
+                    {
+                        s += '\'';
+                        m_pos += 2;
+                        continue;
+                    }
+                    ++m_pos;
+                    return s;
+                }
+                if(c == ' ' || c == '\t' || c == '\n')
+                {
+                    // Whitespace before a line break is dropped, and line breaks are folded
+                    size_t ws = m_pos;
+                    while(peek() == ' ' || peek() == '\t')
+                        ++m_pos;
+                    if(peek() != '\n')
+                    {
+                        s.append(m_text, ws, m_pos - ws);
+                        continue;
+                    }
+                    size_t breaks = 0;
+                    while(peek() == '\n')
+                    {
+                        ++m_pos;
+                        ++breaks;
+                        while(peek() == ' ' || peek() == '\t')
+                            ++m_pos;
+                    }
+                    s += breaks == 1 ? std::string(" ") : std::string(breaks - 1, '\n');
+                    continue;
+                }
+                ++m_pos;
+                if(quote == '\'' || c != '\\')
+                {
+                    s += c;
+                    continue;
+                }
+
+                // Escape sequences of double-quoted scalars
+                char e = peek();
+                ++m_pos;
+                static const char simple[] = "0\0a\ab\bt\t\t\tn\nv\vf\fr\re\x1b  \"\"//\\\\";
+                const char*       found    = nullptr;
+                for(size_t i = 0; i + 1 < sizeof(simple); i += 2)
+                    if(simple[i] == e && e)
+                        found = &simple[i + 1];
+                if(e == '0')
+                    s += '\0';
+                else if(found)
+                    s += *found;
+                else if(e == 'N')
+                    append_utf8(s, 0x85);
+                else if(e == '_')
+                    append_utf8(s, 0xA0);
+                else if(e == 'L')
+                    append_utf8(s, 0x2028);
+                else if(e == 'P')
+                    append_utf8(s, 0x2029);
+                else if(e == 'x' || e == 'u' || e == 'U')
+                {
+                    size_t   digits = e == 'x' ? 2 : e == 'u' ? 4 : 8;
+                    uint32_t code   = 0;
+                    for(size_t i = 0; i < digits; ++i, ++m_pos)
+                    {
+                        if(!isxdigit(peek()))
+                            error("while scanning a double-quoted scalar, expected escape "
+                                  "sequence of hexadecimal numbers");
+                        code = code * 16
+                               + (isdigit(peek()) ? peek() - '0' : tolower(peek()) - 'a' + 10);
+                    }
+                    append_utf8(s, code);
+                }
+                else if(e == '\n')
+                {
+                    // Escaped line break
+                    while(peek() == ' ' || peek() == '\t')
+                        ++m_pos;
+                    while(peek() == '\n')
+                    {
+                        s += '\n';
+                        ++m_pos;
+                        while(peek() == ' ' || peek() == '\t')
+                            ++m_pos;
+                    }
+                }
+                else
+                    error("while scanning a double-quoted scalar, found unknown escape character",
+                          m_pos - 1);
+            }
+        }
+
+        // Whitespace and line breaks inside a plain scalar, folded, or "" at its end
+        std::string scan_plain_spaces()
+        {
+            size_t start = m_pos;
+            while(peek() == ' ' || peek() == '\t')
+                ++m_pos;
+            if(peek() != '\n')
+                return m_text.substr(start, m_pos - start);
+
+            std::string breaks;
+            ++m_pos;
+            for(;;)
+            {
+                if(document_marker("---") || document_marker("..."))
+                    return "";
+                while(peek() == ' ')
+                    ++m_pos;
+                if(peek() != '\n')
+                    break;
+                breaks += '\n';
+                ++m_pos;
+            }
+            return breaks.empty() ? " " : breaks;
+        }
+
+        // A plain scalar, continued on the lines indented more than indent, or on any line
+        // inside flow collections
+        std::string scan_plain(int indent, bool multiline)
+        {
+            std::string chunks, spaces;
+            for(;;)
+            {
+                if(peek() == '#')
+                    break;
+                size_t length = 0;
+                for(;; ++length)
+                {
+                    char c = peek(length);
+                    if(blank(c))
+                        break;
+                    char next = peek(length + 1);
+                    if(c == ':'
+                       && (blank(next) || (m_flow && (flow_indicator(next) || next == '?'))))
+                        break;
+                    if(m_flow && (flow_indicator(c) || c == '?'))
+                        break;
+                }
+                if(!length)
+                    break;
+                chunks += spaces;
+                chunks.append(m_text, m_pos, length);
+                m_pos += length;
+
+                size_t end = m_pos;
+                spaces     = scan_plain_spaces();
+                if(spaces.empty() || peek() == '#' || (!m_flow && column() <= indent)
+                   || (!multiline && m_text.find('\n', end) < m_pos))
+                    break;
+            }
+            return chunks;
+        }
+
+        static bool digits(std::string_view s, const char* set, bool underscore = true)
+        {
+            return !s.empty() && std::all_of(s.begin(), s.end(), [&](char c) {
+                return (c && strchr(set, c)) || (underscore && c == '_');
+            });
+        }
+
+        // [-+]?[0-9][0-9_]*(?::[0-5]?[0-9])+, with the part after the sign
+        static bool sexagesimal(std::string_view s)
+        {
+            size_t colon = s.find(':');
+            if(colon == std::string_view::npos || !colon || !isdigit(s[0])
+               || !digits(s.substr(0, colon), "0123456789"))
+                return false;
+            for(size_t begin = colon + 1;; begin = colon + 1)
+            {
+                colon                 = s.find(':', begin);
+                std::string_view part = s.substr(begin, colon - begin);
+                if(part.empty() || part.size() > 2 || !digits(part, "0123456789", false)
+                   || (part.size() == 2 && part[0] > '5'))
+                    return false;
+                if(colon == std::string_view::npos)
+                    return true;
+            }
+        }
+
+        static bool float_exponent(std::string_view e)
+        {
+            return e.empty()
+                   || (e.size() > 2 && (e[0] == 'e' || e[0] == 'E') && (e[1] == '-' || e[1] == '+')
+                       && digits(e.substr(2), "0123456789", false));
+        }
+
+        static std::string remove_underscores(std::string_view s)
+        {
+            std::string r;
+            for(char c : s)
+                if(c != '_')
+                    r += c;
+            return r;
+        }
+
+        static double sexagesimal_value(const std::string& s)
+        {
+            double value = 0;
+            size_t begin = 0;
+            for(;;)
+            {
+                size_t colon = s.find(':', begin);
+                value        = value * 60 + strtod(s.substr(begin, colon - begin).c_str(), nullptr);
+                if(colon == std::string::npos)
+                    return value;
+                begin = colon + 1;
+            }
+        }
+
+        // The implicit tags of plain scalars of YAML 1.1, with the regular expressions of the
+        // PyYAML resolver
+        const yaml_node* resolve(const std::string& s, size_t pos)
+        {
+            static const char* const bools[]
+                = {"yes", "Yes", "YES", "no", "No", "NO", "true", "True", "TRUE",
+                   "false", "False", "FALSE", "on", "On", "ON", "off", "Off", "OFF"};
+            for(size_t i = 0; i < std::size(bools); ++i)
+                if(s == bools[i])
+                    return m_store.boolean(i < 3 || (i >= 6 && i < 9) || (i >= 12 && i < 15));
+
+            if(s.empty() || s == "~" || s == "null" || s == "Null" || s == "NULL")
+                return m_store.null();
+            if(s == "<<")
+            {
+                auto& node = m_store.make(yaml_node::merge_k);
+                node.s     = s;
+                return &node;
+            }
+
+            std::string_view body = s;
+            int              sign = 1;
+            if(body[0] == '-' || body[0] == '+')
+            {
+                sign = body[0] == '-' ? -1 : 1;
+                body.remove_prefix(1);
+            }
+            bool signed_ = body.size() != s.size();
+
+            // Floats
+            size_t dot = body.find('.');
+            if(dot != std::string_view::npos)
+            {
+                std::string_view mantissa = body.substr(0, body.find_first_of("eE"));
+                std::string_view exponent = body.substr(mantissa.size());
+                bool             is_float = false;
+
+                if(dot && isdigit(body[0]) && digits(body.substr(0, dot), "0123456789")
+                   && (mantissa.size() == dot + 1
+                       || digits(mantissa.substr(dot + 1), "0123456789"))
+                   && float_exponent(exponent))
+                    is_float = true;
+                else if(!dot && !signed_ && body.size() > 1 && isdigit(body[1])
+                        && digits(mantissa.substr(1), "0123456789") && float_exponent(exponent))
+                    is_float = true;
+                else if(isdigit(body[0]) && sexagesimal(body.substr(0, dot))
+                        && (body.size() == dot + 1 || digits(body.substr(dot + 1), "0123456789")))
+                {
+                    auto value = remove_underscores(body);
+                    return m_store.floating(sign * sexagesimal_value(value));
+                }
+                else if(body == ".inf" || body == ".Inf" || body == ".INF")
+                    return m_store.floating(sign * HUGE_VAL);
+                else if(!signed_ && (body == ".nan" || body == ".NaN" || body == ".NAN"))
+                {
+                    // The NaN PyYAML computes as -inf / inf
+                    volatile double inf = HUGE_VAL;
+                    return m_store.floating(-inf / inf);
+                }
+
+                if(is_float)
+                    return m_store.floating(sign
+                                            * strtod(remove_underscores(body).c_str(), nullptr));
+            }
+
+            // Integers
+            auto integer = [&](std::string_view digits_, int base) {
+                auto     value = remove_underscores(digits_);
+                uint64_t x     = 0;
+                for(char c : value)
+                {
+                    uint64_t d = isdigit(c) ? c - '0' : tolower(c) - 'a' + 10;
+                    if(x > (uint64_t(INT64_MAX) - d) / base)
+                        error("integer " + s + " is out of range", pos);
+                    x = x * base + d;
+                }
+                return m_store.integer(sign * int64_t(x));
+            };
+            if(body.size() > 2 && !body.compare(0, 2, "0b") && digits(body.substr(2), "01"))
+                return integer(body.substr(2), 2);
+            if(body.size() > 2 && !body.compare(0, 2, "0x")
+               && digits(body.substr(2), "0123456789abcdefABCDEF"))
+                return integer(body.substr(2), 16);
+            if(body == "0")
+                return m_store.integer(0);
+            if(body.size() > 1 && body[0] == '0' && digits(body.substr(1), "01234567"))
+                return integer(body.substr(1), 8);
+            if(!body.empty() && body[0] >= '1' && body[0] <= '9'
+               && digits(body, "0123456789"))
+                return integer(body, 10);
+            if(!body.empty() && body[0] >= '1' && body[0] <= '9' && sexagesimal(body))
+            {
+                int64_t value = 0;
+                auto    parts = remove_underscores(body);
+                for(size_t begin = 0;;)
+                {
+                    size_t colon = parts.find(':', begin);
+                    value        = value * 60 + atoll(parts.substr(begin, colon - begin).c_str());
+                    if(colon == std::string::npos)
+                        break;
+                    begin = colon + 1;
+                }
+                return m_store.integer(sign * value);
+            }
+
+            // Timestamps cannot be test arguments
+            if(s.size() >= 10 && isdigit(s[0]) && isdigit(s[1]) && isdigit(s[2]) && isdigit(s[3])
+               && s[4] == '-' && (isdigit(s[5]) && (s[6] == '-' || isdigit(s[6]))))
+            {
+                size_t dash = s.find('-', 6);
+                if(dash != std::string::npos && dash <= 7 && dash + 1 < s.size()
+                   && isdigit(s[dash + 1]))
+                    error("timestamps are not supported", pos);
+            }
+
+            return m_store.string(s);
+        }
+
+        // A mapping, with << merge keys applied and later duplicate keys replacing earlier ones
+        const yaml_node* make_map(const pairs_t& pairs, size_t pos)
+        {
+            pairs_t merge, own;
+            for(const auto& p : pairs)
+            {
+                if(p.first->kind != yaml_node::merge_k)
+                    own.push_back(p);
+                else if(p.second->kind == yaml_node::map_k)
+                    merge.insert(merge.end(), p.second->map.begin(), p.second->map.end());
+                else if(p.second->kind == yaml_node::seq_k)
+                {
+                    for(auto it = p.second->seq.rbegin(); it != p.second->seq.rend(); ++it)
+                    {
+                        if((*it)->kind != yaml_node::map_k)
+                            error("while constructing a mapping, expected a mapping for merging",
+                                  pos);
+                        merge.insert(merge.end(), (*it)->map.begin(), (*it)->map.end());
+                    }
+                }
+                else
+                    error("while constructing a mapping, expected a mapping or list of mappings "
+                          "for merging",
+                          pos);
+            }
+            merge.insert(merge.end(), own.begin(), own.end());
+
+            auto& node = m_store.make(yaml_node::map_k);
+            for(const auto& p : merge)
+            {
+                const yaml_node* key = p.first;
+                if(key->kind == yaml_node::seq_k || key->kind == yaml_node::map_k)
+                    error("while constructing a mapping, found unhashable key", pos);
+
+                size_t index = node.map.size();
+                if(key->kind == yaml_node::str_k)
+                {
+                    auto it = node.str_keys.find(key->s);
+                    if(it != node.str_keys.end())
+                        index = it->second;
+                    else
+                        node.str_keys.emplace(key->s, index);
+                }
+                else
+                {
+                    for(size_t i = 0; i < node.map.size(); ++i)
+                        if(py_equal(node.map[i].first, key))
+                            index = i;
+                }
+
+                if(index == node.map.size())
+                    node.map.emplace_back(key, p.second);
+                else
+                    node.map[index].second = p.second;
+            }
+            return &node;
+        }
+
+        const yaml_node* make_seq(std::vector<const yaml_node*> items)
+        {
+            auto& node = m_store.make(yaml_node::seq_k);
+            node.seq   = std::move(items);
+            return &node;
+        }
+
+        /******************************************************************
+         * Flow collections                                               *
+         ******************************************************************/
+        const yaml_node* parse_flow_node()
+        {
+            skip();
+            size_t start = m_pos;
+            switch(peek())
+            {
+            case '\0':
+                error("while parsing a flow node, found unexpected end of stream");
+            case '&':
+            {
+                std::string      name = scan_name();
+                check_anchor(name, start);
+                const yaml_node* node = m_store.null();
+                skip();
+                if(!flow_indicator(peek()) && peek() != ':')
+                    node = parse_flow_node();
+                return m_anchors[name] = node;
+            }
+            case '*':
+                return alias();
+            case '[':
+                return parse_flow_sequence();
+            case '{':
+                return parse_flow_mapping();
+            case '\'':
+            case '"':
+                return m_store.string(scan_quoted());
+            case '!':
+                error("tags are not supported");
+            case '|':
+            case '>':
+                error("block scalars are not supported");
+            }
+            std::string s = scan_plain(-1, true);
+            if(s.empty())
+                error("while parsing a flow node, found character that cannot start any token",
+                      start);
+            return resolve(s, start);
+        }
+
+        const yaml_node* parse_flow_sequence()
+        {
+            size_t start = m_pos++;
+            ++m_flow;
+            std::vector<const yaml_node*> items;
+            for(;;)
+            {
+                skip();
+                if(peek() == ']')
+                    break;
+                const yaml_node* item = parse_flow_node();
+                skip();
+                if(peek() == ':')
+                {
+                    // A single pair mapping
+                    size_t pair = m_pos++;
+                    skip();
+                    const yaml_node* value = m_store.null();
+                    if(peek() != ',' && peek() != ']')
+                        value = parse_flow_node();
+                    item = make_map({{item, value}}, pair);
+                    skip();
+                }
+                items.push_back(item);
+                if(peek() == ',')
+                    ++m_pos;
+                else if(peek() != ']')
+                    error("while parsing a flow sequence, did not find expected ',' or ']'",
+                          peek() ? m_pos : start);
+            }
+            ++m_pos;
+            --m_flow;
+            return make_seq(std::move(items));
+        }
+
+        const yaml_node* parse_flow_mapping()
+        {
+            size_t start = m_pos++;
+            ++m_flow;
+            pairs_t pairs;
+            for(;;)
+            {
+                skip();
+                if(peek() == '}')
+                    break;
+                const yaml_node* key = peek() == ':' ? m_store.null() : parse_flow_node();
+                const yaml_node* value = m_store.null();
+                skip();
+                if(peek() == ':')
+                {
+                    ++m_pos;
+                    skip();
+                    if(peek() != ',' && peek() != '}')
+                        value = parse_flow_node();
+                    skip();
+                }
+                pairs.emplace_back(key, value);
+                if(peek() == ',')
+                    ++m_pos;
+                else if(peek() != '}')
+                    error("while parsing a flow mapping, did not find expected ',' or '}'",
+                          peek() ? m_pos : start);
+            }
+            ++m_pos;
+            --m_flow;
+            return make_map(pairs, start);
+        }
+
+        /******************************************************************
+         * Block collections                                              *
+         ******************************************************************/
+
+        // Whether a simple key followed by ':' starts at the current position
+        bool mapping_key_follows()
+        {
+            size_t save = m_pos;
+            if(peek() == '\'' || peek() == '"')
+                scan_quoted();
+            else if(peek() == '*')
+                scan_name();
+            else
+                scan_plain(-1, false);
+            while(peek() == ' ' || peek() == '\t')
+                ++m_pos;
+            bool key = peek() == ':' && blank(peek(1));
+            m_pos    = save;
+            return key;
+        }
+
+        const yaml_node* parse_block_mapping(int indent)
+        {
+            size_t  start = m_pos;
+            pairs_t pairs;
+            for(;;)
+            {
+                size_t           key_pos = m_pos;
+                const yaml_node* key;
+                if(peek() == '\'' || peek() == '"')
+                    key = m_store.string(scan_quoted());
+                else if(peek() == '*')
+                    key = alias();
+                else
+                    key = resolve(scan_plain(-1, false), key_pos);
+                while(peek() == ' ' || peek() == '\t')
+                    ++m_pos;
+                if(peek() != ':')
+                    error("while scanning a simple key, could not find expected ':'", key_pos);
+                ++m_pos;
+
+                pairs.emplace_back(key, parse_block_node(indent, true, false));
+
+                skip();
+                if(end_of_document() || column() < indent)
+                    break;
+                if(column() > indent || !first_on_line() || sequence_entry())
+                    error("while parsing a block mapping, expected <block end>, but found "
+                          "another node");
+                if(!mapping_key_follows())
+                    error("while scanning a simple key, could not find expected ':'");
+            }
+            return make_map(pairs, start);
+        }
+
+        const yaml_node* parse_block_sequence(int indent)
+        {
+            std::vector<const yaml_node*> items;
+            for(;;)
+            {
+                ++m_pos; // -
+                items.push_back(parse_block_node(indent, false, true));
+
+                skip();
+                if(end_of_document() || column() < indent
+                   || (column() == indent && !sequence_entry()))
+                    break;
+                if(column() > indent || !first_on_line())
+                    error("while parsing a block collection, expected <block end>, but found "
+                          "another node");
+            }
+            return make_seq(std::move(items));
+        }
+
+        // A node in block context, more indented than its parent at indent. The value of a
+        // mapping may be a sequence at the same indentation, and entries of sequences may be
+        // compact collections on the same line.
+        const yaml_node* parse_block_node(int indent, bool sequence_at_indent, bool compact)
+        {
+            skip();
+            if(end_of_document())
+                return m_store.null();
+
+            bool first = first_on_line();
+            int  col   = column();
+            if(first
+               && (col < indent || (col == indent && !(sequence_at_indent && sequence_entry()))))
+                return m_store.null();
+
+            size_t start = m_pos;
+            switch(peek())
+            {
+            case '&':
+            {
+                std::string      name = scan_name();
+                check_anchor(name, start);
+                const yaml_node* node = parse_block_node(indent, sequence_at_indent, compact);
+                return m_anchors[name] = node;
+            }
+            case '*':
+                if(!(first || compact) || !mapping_key_follows())
+                    return alias();
+                break;
+            case '[':
+                return parse_flow_sequence();
+            case '{':
+                return parse_flow_mapping();
+            case '!':
+                error("tags are not supported");
+            case '|':
+            case '>':
+                error("block scalars are not supported");
+            }
+
+            if(sequence_entry())
+            {
+                if(!first && !compact)
+                    error("block sequence entries are not allowed here");
+                return parse_block_sequence(col);
+            }
+
+            if((first || compact) && mapping_key_follows())
+                return parse_block_mapping(col);
+
+            if(peek() == '\'' || peek() == '"')
+                return m_store.string(scan_quoted());
+
+            std::string s = scan_plain(indent, true);
+            if(s.empty())
+                error("while scanning for the next token, found character that cannot start any "
+                      "token",
+                      start);
+            return resolve(s, start);
+        }
+
+    public:
+        yaml_parser(const yaml_source& source, yaml_store& store)
+            : m_source(source)
+            , m_text(source.text)
+            , m_store(store)
+        {
+        }
+
+        std::vector<const yaml_node*> documents()
+        {
+            std::vector<const yaml_node*> docs;
+            for(;;)
+            {
+                skip();
+                while(peek() == '%' && !column())
+                {
+                    // Directives
+                    while(peek() && peek() != '\n')
+                        ++m_pos;
+                    skip();
+                }
+                if(!peek())
+                    break;
+                if(document_marker("..."))
+                {
+                    m_pos += 3;
+                    continue;
+                }
+
+                bool explicit_start = document_marker("---");
+                if(explicit_start)
+                    m_pos += 3;
+                else if(!docs.empty())
+                    error("expected '<document start>', but found another node");
+
+                m_anchors.clear();
+                docs.push_back(parse_block_node(-1, false, true));
+
+                skip();
+                if(peek() && !document_marker("---") && !document_marker("..."))
+                    error("expected '<document start>', but found another node");
+            }
+            return docs;
+        }
+    };
+
+    /**********************************************************************
+     * ctypes layout of the Arguments structure                           *
+     **********************************************************************/
+    struct ctype
+    {
+        enum kind_t
+        {
+            int_k,
+            uint_k,
+            float_k,
+            bool_k,
+            char_k,
+        };
+
+        kind_t kind;
+        size_t size;
+    };
+
+    const std::map<std::string, ctype>& ctypes_types()
+    {
+        static const std::map<std::string, ctype> types = {
+            {"c_bool", {ctype::bool_k, 1}},
+            {"c_char", {ctype::char_k, 1}},
+            {"c_byte", {ctype::int_k, 1}},
+            {"c_ubyte", {ctype::uint_k, 1}},
+            {"c_short", {ctype::int_k, sizeof(short)}},
+            {"c_ushort", {ctype::uint_k, sizeof(short)}},
+            {"c_int", {ctype::int_k, sizeof(int)}},
+            {"c_uint", {ctype::uint_k, sizeof(int)}},
+            {"c_long", {ctype::int_k, sizeof(long)}},
+            {"c_ulong", {ctype::uint_k, sizeof(long)}},
+            {"c_longlong", {ctype::int_k, sizeof(long long)}},
+            {"c_ulonglong", {ctype::uint_k, sizeof(long long)}},
+            {"c_size_t", {ctype::uint_k, sizeof(size_t)}},
+            {"c_ssize_t", {ctype::int_k, sizeof(ptrdiff_t)}},
+            {"c_int8", {ctype::int_k, 1}},
+            {"c_uint8", {ctype::uint_k, 1}},
+            {"c_int16", {ctype::int_k, 2}},
+            {"c_uint16", {ctype::uint_k, 2}},
+            {"c_int32", {ctype::int_k, 4}},
+            {"c_uint32", {ctype::uint_k, 4}},
+            {"c_int64", {ctype::int_k, 8}},
+            {"c_uint64", {ctype::uint_k, 8}},
+            {"c_float", {ctype::float_k, 4}},
+            {"c_double", {ctype::float_k, 8}},
+        };
+        return types;
+    }
+
+    // A name of Datatypes: a ctypes type, an enum class derived from one, or a constant
+    struct datatype
+    {
+        enum kind_t
+        {
+            type_k,
+            enum_k,
+            constant_k,
+        };
+
+        kind_t           kind;
+        ctype            type{};
+        const yaml_node* constant = nullptr;
+    };
+
+    // Matches TYPE_RE, [a-z_A-Z]\w*(:?\s*\*\s*\d+)?$, splitting the name and array length
+    bool parse_type(const std::string& decl, std::string& name, size_t& count)
+    {
+        size_t i = 0;
+        if(decl.empty() || !(isalpha(decl[0]) || decl[0] == '_'))
+            return false;
+        while(i < decl.size() && (isalnum(decl[i]) || decl[i] == '_'))
+            ++i;
+        name  = decl.substr(0, i);
+        count = 0;
+        if(i < decl.size() && decl[i] == ':')
+            ++i;
+        while(i < decl.size() && isspace(decl[i]))
+            ++i;
+        if(i == decl.size())
+            return i == name.size();
+        if(decl[i++] != '*')
+            return false;
+        while(i < decl.size() && isspace(decl[i]))
+            ++i;
+        if(i == decl.size() || !isdigit(decl[i]))
+            return false;
+        for(; i < decl.size() && isdigit(decl[i]); ++i)
+            count = count * 10 + (decl[i] - '0');
+        return i == decl.size();
+    }
+
+    struct field
+    {
+        std::string name;
+        ctype       type;
+        size_t      count; // of an array, or 0
+        bool        is_enum;
+        size_t      offset;
+
+        size_t size() const
+        {
+            return type.size * std::max<size_t>(count, 1);
+        }
+    };
+
+    /**********************************************************************
+     * Test arguments, as a dictionary sorted by name, which also keeps   *
+     * the insertion order of a Python dict for diagnostics               *
+     **********************************************************************/
+    struct test_arg
+    {
+        std::string_view name;
+        const yaml_node* value;
+        size_t           order;
+    };
+
+    struct test_case
+    {
+        std::vector<test_arg> args;
+        size_t                next_order = 0;
+    };
+
+    struct key_error
+    {
+        std::string key;
+    };
+
+    auto lower_bound(const test_case& test, std::string_view key)
+    {
+        return std::lower_bound(
+            test.args.begin(), test.args.end(), key, [](const test_arg& arg, std::string_view k) {
+                return arg.name < k;
+            });
+    }
+
+    const yaml_node* find(const test_case& test, std::string_view key)
+    {
+        auto it = lower_bound(test, key);
+        return it != test.args.end() && it->name == key ? it->value : nullptr;
+    }
+
+    const yaml_node* get(const test_case& test, std::string_view key)
+    {
+        auto value = find(test, key);
+        if(!value)
+            throw key_error{std::string(key)};
+        return value;
+    }
+
+    void set(test_case& test, std::string_view key, const yaml_node* value)
+    {
+        auto it = test.args.begin() + (lower_bound(test, key) - test.args.cbegin());
+        if(it != test.args.end() && it->name == key)
+            it->value = value;
+        else
+            test.args.insert(it, {key, value, test.next_order++});
+    }
+
+    void erase(test_case& test, std::string_view key)
+    {
+        auto it = test.args.begin() + (lower_bound(test, key) - test.args.cbegin());
+        if(it != test.args.end() && it->name == key)
+            test.args.erase(it);
+    }
+
+    std::string_view key_name(const yaml_node* key)
+    {
+        if(key->kind != yaml_node::str_k)
+            fail("TypeError: test argument name " + py_repr(key) + " is not a string");
+        return key->s;
+    }
+
+    // dict.update() with a mapping
+    void update(test_case& test, const yaml_node* item)
+    {
+        for(const auto& p : item->map)
+            set(test, key_name(p.first), p.second);
+    }
+
+    // str() of the dict
+    std::string repr(const test_case& test)
+    {
+        std::vector<const test_arg*> args;
+        for(const auto& arg : test.args)
+            args.push_back(&arg);
+        std::sort(args.begin(), args.end(), [](const test_arg* a, const test_arg* b) {
+            return a->order < b->order;
+        });
+
+        std::string s = "{";
+        for(const test_arg* arg : args)
+            s += (s.size() > 1 ? ", '" : "'") + std::string(arg->name) + "': "
+                 + py_repr(arg->value);
+        return s + "}";
+    }
+
+    // fnmatch.fnmatchcase()
+    bool fnmatchcase(const char* s, const char* p)
+    {
+        for(; *p; ++p)
+        {
+            if(*p == '*')
+            {
+                for(const char* t = s;; ++t)
+                {
+                    if(fnmatchcase(t, p + 1))
+                        return true;
+                    if(!*t)
+                        return false;
+                }
+            }
+            if(!*s)
+                return false;
+            if(*p == '[')
+            {
+                const char* q = p + 1;
+                if(*q == '!')
+                    ++q;
+                if(*q == ']')
+                    ++q;
+                while(*q && *q != ']')
+                    ++q;
+                if(*q)
+                {
+                    // A set of characters
+                    const char* c      = p + 1;
+                    bool        negate = *c == '!';
+                    bool        match  = false;
+                    if(negate)
+                        ++c;
+                    for(bool first = true; c < q; first = false)
+                    {
+                        if(c + 2 < q && c[1] == '-')
+                        {
+                            match = match || (*s >= c[0] && *s <= c[2]);
+                            c += 3;
+                        }
+                        else
+                        {
+                            match = match || *s == *c || (first && *c == ']' && *s == ']');
+                            ++c;
+                        }
+                    }
+                    if(match == negate)
+                        return false;
+                    p = q;
+                    ++s;
+                    continue;
+                }
+            }
+            if(*p != '?' && *p != *s)
+                return false;
+            ++s;
+        }
+        return !*s;
+    }
+
+    /**********************************************************************
+     * Expansion of the tests of each document                            *
+     **********************************************************************/
+    class gentest
+    {
+        yaml_store&    m_store;
+        std::ofstream& m_out;
+
+        // Parameters of the current document
+        std::unordered_map<std::string, datatype> m_datatypes;
+        std::vector<field>                        m_fields;
+        size_t                                    m_size                = 0;
+        const yaml_node*                          m_dict_lists          = nullptr;
+        const yaml_node*                          m_lists_to_not_expand = nullptr;
+        const yaml_node*                          m_known_bugs          = nullptr;
+        const yaml_node*                          m_functions           = nullptr;
+
+        // Records written to the file
+        std::unordered_set<rocblas_hash128, rocblas_hash128_hasher> m_testcases;
+        std::vector<std::pair<std::string, std::vector<uint64_t>>>  m_function_records;
+        std::unordered_map<std::string, size_t>                     m_function_index;
+        bool                                                        m_signature_written = false;
+        std::string                                                 m_record;
+
+        // Python operators on the values of arguments
+        const yaml_node* number_op(const yaml_node* a, const yaml_node* b, char op) const
+        {
+            if(!a->is_number() || !b->is_number())
+                fail(std::string("TypeError: unsupported operand type(s) for ") + op + ": '"
+                     + py_type(a) + "' and '" + py_type(b) + "'");
+            if(op == '/' || a->kind == yaml_node::float_k || b->kind == yaml_node::float_k)
+            {
+                double x = a->number(), y = b->number();
+                return m_store.floating(op == '*' ? x * y : op == '+' ? x + y : x / y);
+            }
+            int64_t x = a->kind == yaml_node::bool_k ? a->b : a->i;
+            int64_t y = b->kind == yaml_node::bool_k ? b->b : b->i;
+            int64_t r;
+            if(op == '*' ? __builtin_mul_overflow(x, y, &r) : __builtin_add_overflow(x, y, &r))
+                fail("OverflowError: integer result out of range");
+            return m_store.integer(r);
+        }
+
+        const yaml_node* py_mul(const yaml_node* a, const yaml_node* b) const
+        {
+            return number_op(a, b, '*');
+        }
+
+        const yaml_node* py_abs(const yaml_node* a) const
+        {
+            if(!a->is_number())
+                fail(std::string("TypeError: bad operand type for abs(): '") + py_type(a) + "'");
+            return a->kind == yaml_node::float_k ? m_store.floating(std::fabs(a->f))
+                                                 : m_store.integer(std::abs(
+                                                     a->kind == yaml_node::bool_k ? a->b : a->i));
+        }
+
+        // int()
+        const yaml_node* py_int(const yaml_node* a) const
+        {
+            switch(a->kind)
+            {
+            case yaml_node::bool_k:
+                return m_store.integer(a->b);
+            case yaml_node::int_k:
+                return a;
+            case yaml_node::float_k:
+                if(!std::isfinite(a->f) || std::fabs(a->f) >= 0x1p63)
+                    fail("ValueError: cannot convert float " + py_repr(a) + " to integer");
+                return m_store.integer(int64_t(std::trunc(a->f)));
+            case yaml_node::str_k:
+            {
+                char* end;
+                auto  value = strtoll(a->s.c_str(), &end, 10);
+                while(isspace(*end))
+                    ++end;
+                if(a->s.empty() || *end || isspace(a->s[0]) == 0 ? *end != 0 : false)
+                    fail("ValueError: invalid literal for int() with base 10: " + py_repr(a));
+                return m_store.integer(value);
+            }
+            default:
+                fail(std::string("TypeError: int() argument must be a string, a bytes-like "
+                                 "object or a real number, not '")
+                     + py_type(a) + "'");
+            }
+        }
+
+        const std::string& str(const yaml_node* a, const char* what) const
+        {
+            if(a->kind != yaml_node::str_k)
+                fail(std::string("TypeError: ") + what + " must be a str, not "
+                     + py_type(a));
+            return a->s;
+        }
+
+        std::string upper(const yaml_node* a) const
+        {
+            std::string s = str(a, "the transpose or side argument");
+            for(auto& c : s)
+                c = toupper(c);
+            return s;
+        }
+
+        /******************************************************************
+         * Datatypes and Arguments                                        *
+         ******************************************************************/
+        const datatype& lookup_type(const std::string& name) const
+        {
+            auto it = m_datatypes.find(name);
+            if(it == m_datatypes.end())
+                fail("NameError: name '" + name + "' is not defined");
+            return it->second;
+        }
+
+        void get_datatypes(const yaml_node* doc)
+        {
+            m_datatypes.clear();
+            for(const auto& type : ctypes_types())
+                m_datatypes[type.first] = {datatype::type_k, type.second};
+
+            const yaml_node* decls = doc->get("Datatypes");
+            if(!decls || !py_truth(decls))
+                return;
+            if(decls->kind != yaml_node::seq_k)
+                fail("Datatypes must be a list");
+
+            for(const yaml_node* declaration : decls->seq)
+            {
+                if(declaration->kind != yaml_node::map_k)
+                    fail("AttributeError: Datatypes entry " + py_repr(declaration)
+                         + " is not a dictionary");
+                for(const auto& item : declaration->map)
+                {
+                    const std::string& name = str(item.first, "a datatype name");
+                    const yaml_node*   decl = item.second;
+                    std::string        type_name;
+                    size_t             count;
+
+                    if(decl->kind == yaml_node::map_k)
+                    {
+                        // Enum class derived from its bases, with its attr as constants
+                        datatype dt{datatype::enum_k};
+                        bool     has_base = false;
+                        if(auto bases = decl->get("bases"); bases && py_truth(bases))
+                        {
+                            if(bases->kind != yaml_node::seq_k)
+                                fail("bases of datatype " + name + " must be a list");
+                            for(const yaml_node* base : bases->seq)
+                            {
+                                if(!parse_type(str(base, "a base"), type_name, count))
+                                    continue;
+                                const datatype& b = lookup_type(type_name);
+                                if(b.kind == datatype::constant_k || count)
+                                    fail("TypeError: unsupported base " + base->s
+                                         + " of datatype " + name);
+                                if(!has_base)
+                                    dt.type = b.type;
+                                has_base = true;
+                            }
+                        }
+                        if(!has_base)
+                            fail("TypeError: datatype " + name + " has no ctypes base");
+                        m_datatypes[name] = dt;
+
+                        if(auto attr = decl->get("attr"); attr && py_truth(attr))
+                        {
+                            if(attr->kind != yaml_node::map_k)
+                                fail("attr of datatype " + name + " must be a dictionary");
+                            for(const auto& a : attr->map)
+                            {
+                                const std::string& subtype = str(a.first, "an attr name");
+                                if(parse_type(subtype, type_name, count) && !count)
+                                    m_datatypes[subtype] = {datatype::constant_k, {}, a.second};
+                            }
+                        }
+                    }
+                    else if(decl->kind == yaml_node::str_k && parse_type(decl->s, type_name, count))
+                    {
+                        auto it = m_datatypes.find(decl->s);
+                        if(it == m_datatypes.end())
+                            fail("KeyError: '" + decl->s + "'");
+                        datatype alias    = it->second;
+                        m_datatypes[name] = alias;
+                    }
+                    else
+                        fail("Unrecognized data type " + name + ": " + py_repr(decl));
+                }
+            }
+        }
+
+        void get_arguments(const yaml_node* doc)
+        {
+            m_fields.clear();
+            size_t offset = 0, align = 1;
+
+            const yaml_node* decls = doc->get("Arguments");
+            if(decls && py_truth(decls))
+            {
+                if(decls->kind != yaml_node::seq_k)
+                    fail("Arguments must be a list");
+                for(const yaml_node* decl : decls->seq)
+                {
+                    if(decl->kind != yaml_node::map_k)
+                        fail("Arguments entry " + py_repr(decl) + " is not a dictionary");
+                    if(decl->map.size() != 1)
+                        continue;
+
+                    const std::string& name = str(decl->map[0].first, "an argument name");
+                    const std::string& type = str(decl->map[0].second, "an argument type");
+                    std::string        type_name;
+                    size_t             count;
+                    if(!parse_type(type, type_name, count))
+                        continue;
+
+                    const datatype& dt = lookup_type(type_name);
+                    if(dt.kind == datatype::constant_k)
+                        fail("TypeError: type of argument " + name + " must be a ctypes type");
+
+                    size_t size = dt.type.size;
+                    offset      = (offset + size - 1) / size * size;
+                    align       = std::max(align, size);
+                    m_fields.push_back(
+                        {name, dt.type, count, dt.kind == datatype::enum_k && !count, offset});
+                    offset += m_fields.back().size();
+                }
+            }
+            m_size = m_fields.empty() ? 0 : (offset + align - 1) / align * align;
+        }
+
+        /******************************************************************
+         * setdefaults() of rocblas_gentest.py                            *
+         ******************************************************************/
+        void setdefaults(test_case& test)
+        {
+            auto has = [&](std::string_view key) { return find(test, key) != nullptr; };
+            auto setdefault = [&](std::string_view key, const yaml_node* value) {
+                if(!has(key))
+                    set(test, key, value);
+            };
+            auto setkey_product = [&](std::string_view                   key,
+                                      std::initializer_list<const char*> vals) {
+                for(auto x : vals)
+                    if(!has(x))
+                        return;
+                const yaml_node* result = m_store.integer(1);
+                for(auto x : vals)
+                    result = py_mul(result, get(test, x));
+                set(test, key, py_int(py_abs(result)));
+            };
+            auto all = [&](std::initializer_list<const char*> keys) {
+                for(auto x : keys)
+                    if(!has(x))
+                        return false;
+                return true;
+            };
+
+            // "function in ('a', 'b')" is a membership test, but "function in ('a')" is a
+            // substring test of the string 'a'
+            const std::string& function = str(get(test, "function"), "function");
+            auto in_tuple = [&](std::initializer_list<const char*> names) {
+                for(auto name : names)
+                    if(function == name)
+                        return true;
+                return false;
+            };
+            auto in_str = [&](const char* name) {
+                return std::string_view(name).find(function) != std::string_view::npos;
+            };
+
+            auto ss = [&] { return get(test, "stride_scale"); };
+
+            if(in_tuple({"asum_strided_batched",    "nrm2_strided_batched",
+                         "scal_strided_batched",    "swap_strided_batched",
+                         "copy_strided_batched",    "dot_strided_batched",
+                         "dotc_strided_batched",    "dot_strided_batched_ex",
+                         "dotc_strided_batched_ex", "rot_strided_batched",
+                         "rot_strided_batched_ex",  "rotm_strided_batched",
+                         "iamax_strided_batched",   "iamin_strided_batched",
+                         "axpy_strided_batched",    "axpy_strided_batched_ex",
+                         "nrm2_strided_batched_ex", "scal_strided_batched_ex"}))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                // all(x in test for x in ('stride_scale')) tests each character
+                bool all_chars = true;
+                for(char c : std::string_view("stride_scale"))
+                    all_chars = all_chars && has(std::string_view(&c, 1));
+                if(all_chars)
+                    setdefault("stride_c", py_mul(py_int(ss()), m_store.integer(5)));
+            }
+            else if(in_str("tpmv_strided_batched"))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_a", {"N", "N", "stride_scale"});
+            }
+            else if(in_str("trmv_strided_batched"))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in_str("trsv_strided_batched"))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_a", {"lda", "N", "stride_scale"});
+            }
+            else if(in_tuple({"gemv_strided_batched",
+                              "gbmv_strided_batched",
+                              "ger_strided_batched",
+                              "geru_strided_batched",
+                              "gerc_strided_batched"}))
+            {
+                if(in_tuple({"ger_strided_batched", "geru_strided_batched", "gerc_strided_batched"})
+                   || py_equal(get(test, "transA"), m_store.string("T"))
+                   || py_equal(get(test, "transA"), m_store.string("C")))
+                {
+                    setkey_product("stride_x", {"M", "incx", "stride_scale"});
+                    setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                }
+                else
+                {
+                    setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product("stride_y", {"M", "incy", "stride_scale"});
+                }
+                if(in_str("gbmv_strided_batched"))
+                    setkey_product("stride_a", {"lda", "N", "stride_scale"});
+            }
+            else if(in_tuple(
+                        {"hemv_strided_batched", "hbmv_strided_batched", "sbmv_strided_batched"}))
+            {
+                if(all({"N", "incx", "incy", "stride_scale"}))
+                {
+                    setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                    setkey_product("stride_a", {"N", "lda", "stride_scale"});
+                }
+            }
+            else if(in_str("hpmv_strided_batched"))
+            {
+                if(all({"N", "incx", "incy", "stride_scale"}))
+                {
+                    setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                    setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                    auto N   = get(test, "N");
+                    auto ldN = py_int(number_op(
+                        py_mul(py_mul(N, number_op(N, m_store.integer(1), '+')), ss()),
+                        m_store.integer(2),
+                        '/'));
+                    setdefault("stride_a", ldN);
+                }
+            }
+            else if(in_tuple({"spr_strided_batched",
+                              "spr2_strided_batched",
+                              "hpr_strided_batched",
+                              "hpr2_strided_batched",
+                              "tpsv_strided_batched"}))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                setkey_product("stride_a", {"N", "N", "stride_scale"});
+            }
+            else if(in_tuple(
+                        {"her_strided_batched", "her2_strided_batched", "syr2_strided_batched"}))
+            {
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+                setkey_product("stride_y", {"N", "incy", "stride_scale"});
+                setkey_product("stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in_str("rotg_strided_batched"))
+            {
+                if(has("stride_scale"))
+                {
+                    setdefault("stride_a", py_int(ss()));
+                    setdefault("stride_b", py_int(ss()));
+                    setdefault("stride_c", py_int(ss()));
+                    setdefault("stride_d", py_int(ss()));
+                }
+            }
+            else if(in_str("rotmg_strided_batched"))
+            {
+                if(has("stride_scale"))
+                {
+                    setdefault("stride_a", py_int(ss()));
+                    setdefault("stride_b", py_int(ss()));
+                    setdefault("stride_c", py_mul(py_int(ss()), m_store.integer(5)));
+                    setdefault("stride_x", py_int(ss()));
+                    setdefault("stride_y", py_int(ss()));
+                }
+            }
+            else if(in_str("dgmm_strided_batched"))
+            {
+                setkey_product("stride_c", {"N", "ldc", "stride_scale"});
+                setkey_product("stride_a", {"N", "lda", "stride_scale"});
+                if(upper(get(test, "side")) == "L")
+                    setkey_product("stride_x", {"M", "incx", "stride_scale"});
+                else
+                    setkey_product("stride_x", {"N", "incx", "stride_scale"});
+            }
+            else if(in_str("geam_strided_batched"))
+            {
+                setkey_product("stride_c", {"N", "ldc", "stride_scale"});
+
+                if(upper(get(test, "transA")) == "N")
+                    setkey_product("stride_a", {"N", "lda", "stride_scale"});
+                else
+                    setkey_product("stride_a", {"M", "lda", "stride_scale"});
+
+                if(upper(get(test, "transB")) == "N")
+                    setkey_product("stride_b", {"N", "ldb", "stride_scale"});
+                else
+                    setkey_product("stride_b", {"M", "ldb", "stride_scale"});
+            }
+            else if(in_str("trmm_strided_batched"))
+            {
+                setkey_product("stride_b", {"N", "ldb", "stride_scale"});
+                setkey_product("stride_c", {"N", "ldc", "stride_scale"});
+
+                if(upper(get(test, "side")) == "L")
+                    setkey_product("stride_a", {"M", "lda", "stride_scale"});
+                else
+                    setkey_product("stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in_tuple({"trsm_strided_batched", "trsm_strided_batched_ex"}))
+            {
+                setkey_product("stride_b", {"N", "ldb", "stride_scale"});
+
+                if(upper(get(test, "side")) == "L")
+                    setkey_product("stride_a", {"M", "lda", "stride_scale"});
+                else
+                    setkey_product("stride_a", {"N", "lda", "stride_scale"});
+            }
+            else if(in_str("tbmv_strided_batched"))
+            {
+                if(all({"N", "lda", "stride_scale"}))
+                    setdefault("stride_a",
+                               py_int(py_mul(py_mul(get(test, "N"), get(test, "lda")), ss())));
+                if(all({"N", "incx", "stride_scale"}))
+                    setdefault("stride_x",
+                               py_int(py_mul(py_mul(get(test, "N"), py_abs(get(test, "incx"))),
+                                             ss())));
+            }
+            else if(in_str("tbsv_strided_batched"))
+            {
+                setkey_product("stride_a", {"N", "lda", "stride_scale"});
+                setkey_product("stride_x", {"N", "incx", "stride_scale"});
+            }
+
+            const yaml_node* zero = m_store.integer(0);
+            setdefault("stride_x", zero);
+            setdefault("stride_y", zero);
+
+            const yaml_node* star = m_store.string("*");
+            if(py_equal(get(test, "transA"), star) || py_equal(get(test, "transB"), star))
+            {
+                setdefault("lda", zero);
+                setdefault("ldb", zero);
+                setdefault("ldc", zero);
+                setdefault("ldd", zero);
+            }
+            else
+            {
+                // test[x] if test[x] != 0 else 1
+                auto nonzero = [&](const char* x) {
+                    auto v = get(test, x);
+                    return py_equal(v, zero) ? m_store.integer(1) : v;
+                };
+                setdefault("lda", upper(get(test, "transA")) == "N" ? nonzero("M") : nonzero("K"));
+                setdefault("ldb", upper(get(test, "transB")) == "N" ? nonzero("K") : nonzero("N"));
+                setdefault("ldc", nonzero("M"));
+                setdefault("ldd", nonzero("M"));
+
+                auto batch_count = get(test, "batch_count");
+                if(!batch_count->is_number())
+                    fail(std::string("TypeError: '>' not supported between instances of '")
+                         + py_type(batch_count) + "' and 'int'");
+                if(batch_count->number() > 0)
+                {
+                    setdefault("stride_a",
+                               py_mul(get(test, "lda"),
+                                      get(test, upper(get(test, "transA")) == "N" ? "K" : "M")));
+                    setdefault("stride_b",
+                               py_mul(get(test, "ldb"),
+                                      get(test, upper(get(test, "transB")) == "N" ? "N" : "K")));
+                    setdefault("stride_c", py_mul(get(test, "ldc"), get(test, "N")));
+                    setdefault("stride_d", py_mul(get(test, "ldd"), get(test, "N")));
+                    return;
+                }
+            }
+
+            setdefault("stride_a", zero);
+            setdefault("stride_b", zero);
+            setdefault("stride_c", zero);
+            setdefault("stride_d", zero);
+        }
+
+        /******************************************************************
+         * Records                                                        *
+         ******************************************************************/
+        [[noreturn]] void type_error(const std::string&  message,
+                                     const field&        f,
+                                     const yaml_node*    value) const
+        {
+            fail("TypeError: " + message + " for " + f.name + ", which has type <class '"
+                 + py_type(value) + "'>\n");
+        }
+
+        void store_scalar(const field& f, const yaml_node* value, char* p) const
+        {
+            switch(f.type.kind)
+            {
+            case ctype::bool_k:
+                *p = py_truth(value);
+                return;
+            case ctype::float_k:
+                if(!value->is_number())
+                    type_error(std::string("must be real number, not ") + py_type(value), f, value);
+                if(f.type.size == sizeof(float))
+                {
+                    float x = float(value->number());
+                    memcpy(p, &x, sizeof(x));
+                }
+                else
+                {
+                    double x = value->number();
+                    memcpy(p, &x, sizeof(x));
+                }
+                return;
+            case ctype::char_k:
+                if(value->kind != yaml_node::str_k)
+                    type_error("encoding without a string argument", f, value);
+                if(value->s.size() != 1)
+                    fail("TypeError: one character bytes, bytearray or integer expected for "
+                         + f.name);
+                *p = value->s[0];
+                return;
+            default:
+                if(value->kind != yaml_node::int_k && value->kind != yaml_node::bool_k)
+                    type_error(std::string("int expected instead of ") + py_type(value), f, value);
+                // ctypes integers wrap around
+                uint64_t x = value->kind == yaml_node::bool_k ? value->b : uint64_t(value->i);
+                switch(f.type.size)
+                {
+                case 1:
+                {
+                    uint8_t v = uint8_t(x);
+                    memcpy(p, &v, 1);
+                    return;
+                }
+                case 2:
+                {
+                    uint16_t v = uint16_t(x);
+                    memcpy(p, &v, 2);
+                    return;
+                }
+                case 4:
+                {
+                    uint32_t v = uint32_t(x);
+                    memcpy(p, &v, 4);
+                    return;
+                }
+                default:
+                    memcpy(p, &x, 8);
+                    return;
+                }
+            }
+        }
+
+        void write_signature()
+        {
+            if(m_signature_written)
+                return;
+            std::string byt("rocBLAS", 8);
+            std::string body(m_size, '\0');
+            unsigned    sig = 0;
+            for(const auto& f : m_fields)
+            {
+                for(size_t i = 0; i < f.size(); ++i)
+                    body[f.offset + i] = char(sig ^ i);
+                sig = (sig + 89) % 256;
+            }
+            byt += body;
+            byt.append("ROCblas", 8);
+            m_out.write(byt.data(), byt.size());
+            m_signature_written = true;
+        }
+
+        void write_test(const test_case& test)
+        {
+            m_record.assign(m_size, '\0');
+            for(const auto& f : m_fields)
+            {
+                const yaml_node* value = get(test, f.name);
+                char*            p     = &m_record[f.offset];
+                if(f.count && f.type.kind == ctype::char_k)
+                {
+                    if(value->kind != yaml_node::str_k)
+                        type_error("encoding without a string argument", f, value);
+                    if(value->s.size() > f.count)
+                        fail("ValueError: bytes too long (" + std::to_string(value->s.size())
+                             + ", maximum length " + std::to_string(f.count) + ") for " + f.name);
+                    memcpy(p, value->s.data(), value->s.size());
+                }
+                else if(f.count)
+                {
+                    if(value->kind != yaml_node::seq_k)
+                        type_error("argument after * must be an iterable", f, value);
+                    if(value->seq.size() > f.count)
+                        fail("IndexError: invalid index for " + f.name);
+                    for(size_t i = 0; i < value->seq.size(); ++i)
+                        store_scalar(f, value->seq[i], p + i * f.type.size);
+                }
+                else
+                    store_scalar(f, value, p);
+            }
+
+            auto hash = rocblas_hash_bytes(m_record);
+            if(!m_testcases.insert(hash).second)
+                return;
+
+            const std::string& function = str(get(test, "function"), "function");
+            auto               it       = m_function_index.find(function);
+            if(it == m_function_index.end())
+            {
+                it = m_function_index.emplace(function, m_function_records.size()).first;
+                m_function_records.emplace_back(function, std::vector<uint64_t>{});
+            }
+            m_function_records[it->second].second.push_back(m_testcases.size() - 1);
+
+            write_signature();
+            m_out.write(m_record.data(), m_record.size());
+        }
+
+        /******************************************************************
+         * instantiate() and generate() of rocblas_gentest.py             *
+         ******************************************************************/
+        bool is_enum_field(std::string_view name) const
+        {
+            for(const auto& f : m_fields)
+                if(f.name == name)
+                    return f.is_enum;
+            return false;
+        }
+
+        void instantiate(test_case test)
+        {
+            try
+            {
+                setdefaults(test);
+
+                // For enum arguments, replace name with value
+                for(const auto& f : m_fields)
+                {
+                    if(!f.is_enum)
+                        continue;
+                    const yaml_node* value = get(test, f.name);
+                    if(value->kind == yaml_node::seq_k || value->kind == yaml_node::map_k)
+                        fail("TypeError: unhashable type: '" + std::string(py_type(value)) + "'");
+                    if(value->kind != yaml_node::str_k)
+                        continue;
+                    auto it = m_datatypes.find(value->s);
+                    if(it == m_datatypes.end())
+                        continue;
+                    if(it->second.kind != datatype::constant_k)
+                        fail("TypeError: " + value->s + " is not a value of " + f.name);
+                    set(test, f.name, it->second.constant);
+                }
+
+                // Platforms of the known bugs, in the order they are found. Python joins the
+                // elements of a set, in an order which changes between runs.
+                std::vector<std::string> known_bug_platforms;
+                auto known_bug = [&] {
+                    return std::string_view("known_bug").find(
+                               str(get(test, "category"), "category"))
+                           != std::string_view::npos;
+                };
+
+                // Match known bugs
+                if(!known_bug() && m_known_bugs)
+                {
+                    for(const yaml_node* bug : m_known_bugs->seq)
+                    {
+                        if(bug->kind != yaml_node::map_k)
+                            fail("AttributeError: known bug " + py_repr(bug)
+                                 + " is not a dictionary");
+                        bool match = true;
+                        for(const auto& item : bug->map)
+                        {
+                            if(item.first->kind != yaml_node::str_k)
+                            {
+                                match = false;
+                                break;
+                            }
+                            const std::string& key = item.first->s;
+                            if(key == "known_bug_platforms" || key == "category")
+                                continue;
+                            const yaml_node* value = find(test, key);
+                            if(!value)
+                            {
+                                match = false;
+                                break;
+                            }
+                            if(key == "function")
+                            {
+                                if(!fnmatchcase(str(value, "function").c_str(),
+                                                str(item.second, "function").c_str()))
+                                {
+                                    match = false;
+                                    break;
+                                }
+                                continue;
+                            }
+
+                            // For keys declared as enums, compare resulting values
+                            const yaml_node* expected = item.second;
+                            if(is_enum_field(key) && expected->kind == yaml_node::str_k)
+                            {
+                                auto it = m_datatypes.find(expected->s);
+                                if(it != m_datatypes.end())
+                                {
+                                    if(it->second.kind != datatype::constant_k)
+                                    {
+                                        match = false;
+                                        break;
+                                    }
+                                    expected = it->second.constant;
+                                }
+                            }
+                            if(!py_equal(value, expected))
+                            {
+                                match = false;
+                                break;
+                            }
+                        }
+                        if(!match)
+                            continue;
+
+                        // All values specified in known bug match the test case
+                        const yaml_node* platforms = bug->get("known_bug_platforms");
+                        std::string      list = platforms ? str(platforms, "known_bug_platforms")
+                                                          : std::string();
+                        static const char separators[] = " :,\f\n\r\t\v";
+                        if(list.find_first_not_of(separators) != std::string::npos)
+                        {
+                            // re.split('[ :,\f\n\r\t\v]+', platforms)
+                            for(size_t begin = 0;;)
+                            {
+                                size_t end = list.find_first_of(separators, begin);
+                                auto   platform = list.substr(begin, end - begin);
+                                if(std::find(known_bug_platforms.begin(),
+                                             known_bug_platforms.end(),
+                                             platform)
+                                   == known_bug_platforms.end())
+                                    known_bug_platforms.push_back(platform);
+                                if(end == std::string::npos)
+                                    break;
+                                begin = list.find_first_not_of(separators, end);
+                                if(begin == std::string::npos)
+                                    begin = list.size();
+                            }
+                        }
+                        else
+                            set(test, "category", m_store.string("known_bug"));
+                        break;
+                    }
+                }
+
+                // Unless category is already set to known_bug or disabled, set
+                // known_bug_platforms to a space-separated list of platforms
+                std::string platforms;
+                if(!known_bug())
+                    for(const auto& platform : known_bug_platforms)
+                        platforms += (&platform == &known_bug_platforms[0] ? "" : " ") + platform;
+                set(test, "known_bug_platforms", m_store.string(platforms));
+
+                write_test(test);
+            }
+            catch(const key_error& err)
+            {
+                fail("Undefined value '" + err.key + "'\n" + repr(test));
+            }
+        }
+
+        bool not_expanded(std::string_view key) const
+        {
+            const yaml_node* lists = m_lists_to_not_expand;
+            if(!lists || !py_truth(lists))
+                return false;
+            switch(lists->kind)
+            {
+            case yaml_node::seq_k:
+                return std::any_of(lists->seq.begin(), lists->seq.end(), [&](const yaml_node* n) {
+                    return n->kind == yaml_node::str_k && n->s == key;
+                });
+            case yaml_node::map_k:
+                return lists->get(key) != nullptr;
+            case yaml_node::str_k:
+                return lists->s.find(key) != std::string::npos;
+            default:
+                fail("TypeError: Lists to not expand must be a list");
+            }
+        }
+
+        void generate(test_case test)
+        {
+            // For specially named lists, they are expanded and merged into the test
+            // argument list. When the list name is a dictionary of length 1, its pairs
+            // indicate that the argument named by its key takes on values paired with
+            // the argument named by its value, which is another dictionary list. We
+            // process the value dictionaries' keys in alphabetic order, to ensure
+            // deterministic test ordering.
+            if(m_dict_lists)
+            {
+                for(const yaml_node* argname : m_dict_lists->seq)
+                {
+                    if(argname->kind == yaml_node::map_k)
+                    {
+                        if(argname->map.size() != 1)
+                            continue;
+                        const yaml_node* arg    = argname->map[0].first;
+                        const yaml_node* target = argname->map[0].second;
+                        if(arg->kind != yaml_node::str_k)
+                            continue;
+                        const yaml_node* value = find(test, arg->s);
+                        if(!value || value->kind != yaml_node::map_k)
+                            continue;
+
+                        auto pairs = value->map;
+                        auto by_key = [](const auto& a, const auto& b) {
+                            const yaml_node *x = a.first, *y = b.first;
+                            if(x->kind == yaml_node::str_k && y->kind == yaml_node::str_k)
+                                return x->s < y->s;
+                            if(x->is_number() && y->is_number())
+                                return x->number() < y->number();
+                            fail(std::string("TypeError: '<' not supported between instances of '")
+                                 + py_type(x) + "' and '" + py_type(y) + "'");
+                        };
+                        std::stable_sort(pairs.begin(), pairs.end(), by_key);
+                        for(const auto& pair : pairs)
+                        {
+                            set(test, arg->s, pair.first);
+                            set(test, key_name(target), pair.second);
+                            generate(test);
+                        }
+                        return;
+                    }
+                    if(argname->kind != yaml_node::str_k)
+                        continue;
+                    const yaml_node* ilist = find(test, argname->s);
+                    if(!ilist
+                       || (ilist->kind != yaml_node::seq_k && ilist->kind != yaml_node::map_k))
+                        continue;
+
+                    // Pop the list and iterate across it. A bare dictionary is applied once.
+                    erase(test, argname->s);
+                    std::vector<const yaml_node*> items{ilist};
+                    if(ilist->kind == yaml_node::seq_k)
+                        items = ilist->seq;
+                    for(const yaml_node* item : items)
+                    {
+                        if(item->kind != yaml_node::map_k)
+                            fail("TypeError: cannot convert dictionary update sequence element "
+                                 "for "
+                                 + argname->s + ", which has type <class '" + py_type(item)
+                                 + "'>\nA name listed in \"Dictionary lists to expand\" must be "
+                                   "a defined as a dictionary.\n");
+                        test_case item_case = test;
+                        update(item_case, item);
+                        generate(std::move(item_case));
+                    }
+                    return;
+                }
+            }
+
+            for(size_t k = 0; k < test.args.size(); ++k)
+            {
+                std::string_view key   = test.args[k].name;
+                const yaml_node* value = test.args[k].value;
+
+                // Integer arguments which are ranges (A..B[..C]) are expanded
+                if(value->kind == yaml_node::str_k)
+                {
+                    int64_t range[3];
+                    if(!parse_range(value->s, range))
+                        continue;
+                    if(!range[2])
+                        fail("ValueError: range() arg 3 must not be zero");
+                    for(int64_t i = range[0]; range[2] > 0 ? i <= range[1] : i >= range[1];
+                        i += range[2])
+                    {
+                        test.args[k].value = m_store.integer(i);
+                        generate(test);
+                    }
+                    return;
+                }
+
+                // For sequence arguments, they are expanded into scalars
+                if(value->kind == yaml_node::seq_k && !not_expanded(key))
+                {
+                    for(const yaml_node* item : value->seq)
+                    {
+                        test.args[k].value = item;
+                        generate(test);
+                    }
+                    return;
+                }
+            }
+
+            // Replace typed function names with generic functions and types
+            if(const yaml_node* func = find(test, "rocblas_function"))
+            {
+                erase(test, "rocblas_function");
+                const yaml_node* replacement = nullptr;
+                if(m_functions && func->kind != yaml_node::seq_k && func->kind != yaml_node::map_k)
+                {
+                    for(const auto& item : m_functions->map)
+                        if(py_equal(item.first, func))
+                            replacement = item.second;
+                }
+                if(replacement)
+                {
+                    if(replacement->kind != yaml_node::map_k)
+                        fail("TypeError: Functions entry " + py_repr(func)
+                             + " is not a dictionary");
+                    update(test, replacement);
+                }
+                else
+                {
+                    const std::string& name = str(func, "rocblas_function");
+                    size_t             pos  = name.rfind("rocblas_");
+                    set(test,
+                        "function",
+                        m_store.string(pos == std::string::npos ? name : name.substr(pos + 8)));
+                }
+                generate(std::move(test));
+                return;
+            }
+
+            instantiate(std::move(test));
+        }
+
+        // INT_RANGE_RE, \s*(-?\d+)\s*\.\.\s*(-?\d+)\s*(?:\.\.\s*(-?\d+)\s*)?$
+        static bool parse_range(const std::string& s, int64_t range[3])
+        {
+            const char* p = s.c_str();
+            auto        space = [&] {
+                while(isspace(*p))
+                    ++p;
+            };
+            auto number = [&](int64_t& x) {
+                const char* begin = p;
+                if(*p == '-')
+                    ++p;
+                if(!isdigit(*p))
+                    return false;
+                while(isdigit(*p))
+                    ++p;
+                x = strtoll(begin, nullptr, 10);
+                return true;
+            };
+            auto dots = [&] {
+                if(p[0] != '.' || p[1] != '.')
+                    return false;
+                p += 2;
+                return true;
+            };
+
+            range[2] = 1;
+            space();
+            if(!number(range[0]))
+                return false;
+            space();
+            if(!dots())
+                return false;
+            space();
+            if(!number(range[1]))
+                return false;
+            space();
+            if(dots())
+            {
+                space();
+                if(!number(range[2]))
+                    return false;
+                space();
+            }
+            return !*p || (*p == '\n' && !p[1]);
+        }
+
+    public:
+        gentest(yaml_store& store, std::ofstream& out)
+            : m_store(store)
+            , m_out(out)
+        {
+        }
+
+        void process_doc(const yaml_node* doc)
+        {
+            // Ignore empty documents
+            if(!py_truth(doc))
+                return;
+            if(doc->kind != yaml_node::map_k)
+                fail("AttributeError: the document is not a dictionary");
+            const yaml_node* tests = doc->get("Tests");
+            if(!tests || !py_truth(tests))
+                return;
+            if(tests->kind != yaml_node::seq_k)
+                fail("Tests must be a list");
+
+            get_datatypes(doc);
+            get_arguments(doc);
+
+            auto param = [&](const char* name, yaml_node::kind_t kind) -> const yaml_node* {
+                const yaml_node* value = doc->get(name);
+                if(!value || !py_truth(value))
+                    return nullptr;
+                if(value->kind != kind && kind != yaml_node::null_k)
+                    fail(std::string(name) + " must be a "
+                         + (kind == yaml_node::seq_k ? "list" : "dictionary"));
+                return value;
+            };
+            m_dict_lists          = param("Dictionary lists to expand", yaml_node::seq_k);
+            m_lists_to_not_expand = param("Lists to not expand", yaml_node::null_k);
+            m_known_bugs          = param("Known bugs", yaml_node::seq_k);
+            m_functions           = param("Functions", yaml_node::map_k);
+            const yaml_node* defaults = param("Defaults", yaml_node::map_k);
+
+            // Instantiate all of the tests, starting with defaults
+            for(const yaml_node* test : tests->seq)
+            {
+                if(test->kind != yaml_node::map_k)
+                    fail("TypeError: test " + py_repr(test) + " is not a dictionary");
+                test_case c;
+                if(defaults)
+                    update(c, defaults);
+                update(c, test);
+                generate(std::move(c));
+            }
+        }
+
+        // The index of the record numbers of each function, in the format read by
+        // RocBLAS_TestData_File in rocblas_data.hpp
+        void write_index()
+        {
+            if(!m_signature_written)
+                return;
+
+            auto function = std::find_if(
+                m_fields.begin(), m_fields.end(), [](const field& f) {
+                    return f.name == "function";
+                });
+            if(function == m_fields.end())
+                fail("AttributeError: type object 'Arguments' has no attribute 'function'");
+
+            std::string byt;
+            auto        pack = [&](uint64_t x) {
+                byt.append(reinterpret_cast<char*>(&x), sizeof(x));
+            };
+
+            pack(m_function_records.size());
+            uint64_t first = 0;
+            for(const auto& records : m_function_records)
+            {
+                std::string name = records.first;
+                if(name.size() < function->size())
+                    name.resize(function->size(), '\0');
+                byt += name;
+                pack(first);
+                pack(records.second.size());
+                first += records.second.size();
+            }
+            for(const auto& records : m_function_records)
+                for(uint64_t record : records.second)
+                    pack(record);
+            pack(8 + m_size + 8 + m_testcases.size() * m_size);
+            byt.append("RBTDIDX", 8);
+            m_out.write(byt.data(), byt.size());
+        }
+    };
+}
+
+namespace
+{
+    // Failure to write the output file, rather than to expand the YAML
+    struct output_error : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+    // The template is read before the file, and both are read before any test is expanded
+    yaml_source read_sources(const std::string&              infile,
+                             const std::vector<std::string>& includes,
+                             const std::string&              template_file)
+    {
+        yaml_source source;
+        if(!template_file.empty())
+            source.read(template_file, includes);
+        source.read(infile, includes);
+        return source;
+    }
+
+    // Most expansions kept in a cache directory, beyond which the least recently used are removed
+    constexpr size_t cache_max_entries = 64;
+
+    // Create cache_dir if it does not exist, and check that its data files can be trusted: on
+    // POSIX systems it must be a directory, not a symbolic link, owned by the user and writable
+    // by no one else, since the default is a predictable name in the temporary directory
+    bool open_cache_dir(const std::string& cache_dir)
+    {
+        std::error_code ec;
+#ifdef WIN32
+        fs::create_directories(cache_dir, ec);
+        return fs::is_directory(cache_dir, ec);
+#else
+        std::string dir = cache_dir;
+        while(dir.size() > 1 && dir.back() == '/')
+            dir.pop_back();
+
+        auto parent = fs::path(dir).parent_path();
+        if(!parent.empty())
+            fs::create_directories(parent, ec);
+        if(mkdir(dir.c_str(), 0700) && errno != EEXIST)
+            return false;
+
+        struct stat st;
+        return !lstat(dir.c_str(), &st) && S_ISDIR(st.st_mode) && st.st_uid == geteuid()
+               && !(st.st_mode & (S_IWGRP | S_IWOTH));
+#endif
+    }
+
+    // Remove the least recently used expansions beyond cache_max_entries, and the temporary
+    // files of runs which did not finish
+    void evict_cache_entries(const std::string& cache_dir)
+    {
+        std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+        const auto now = fs::file_time_type::clock::now();
+
+        std::error_code ec, file_ec;
+        for(fs::directory_iterator it(cache_dir, ec), end; !ec && it != end; it.increment(ec))
+        {
+            const fs::path& path = it->path();
+            auto            time = fs::last_write_time(path, file_ec);
+            if(file_ec)
+                continue;
+            if(path.extension() == ".data")
+                entries.emplace_back(time, path);
+            else if(path.extension() == ".tmp" && now - time > std::chrono::hours(24))
+                fs::remove(path, file_ec);
+        }
+
+        if(entries.size() <= cache_max_entries)
+            return;
+
+        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+        for(size_t i = cache_max_entries; i < entries.size(); i++)
+            fs::remove(entries[i].second, file_ec);
+    }
+
+    void expand(const yaml_source& source, const std::string& outfile)
+    {
+        yaml_store store;
+        auto       docs = yaml_parser(source, store).documents();
+
+        std::ofstream out(outfile, std::ios::binary | std::ios::trunc);
+        if(!out)
+            throw output_error("Cannot open " + outfile);
+
+        gentest gen(store, out);
+        for(const yaml_node* doc : docs)
+            gen.process_doc(doc);
+        gen.write_index();
+
+        out.close();
+        if(!out)
+            throw output_error("Cannot write " + outfile);
+    }
+}
+
+void rocblas_gentest(const std::string&              infile,
+                     const std::string&              outfile,
+                     const std::vector<std::string>& includes,
+                     const std::string&              template_file)
+{
+    expand(read_sources(infile, includes, template_file), outfile);
+}
+
+std::string rocblas_gentest_cached(const std::string&              infile,
+                                   const std::string&              cache_dir,
+                                   const std::vector<std::string>& includes,
+                                   const std::string&              template_file)
+{
+    yaml_source source = read_sources(infile, includes, template_file);
+
+    // The key covers the text after include: lines are replaced, so it changes with the
+    // template and every included file, and with the version of the expansion
+    auto key = rocblas_hash_bytes("rocblas_gentest " + std::to_string(rocblas_gentest_version)
+                                  + "\n" + source.text);
+    char name[64];
+    snprintf(name, sizeof(name), "%016" PRIx64 "%016" PRIx64 ".data", key.hi, key.lo);
+
+    if(!open_cache_dir(cache_dir))
+        return "";
+
+    // The write time of an entry is the time it was last used. An empty entry is the
+    // expansion of a file without tests.
+    std::error_code ec;
+    fs::path        cached = fs::path(cache_dir) / name;
+    if(fs::is_regular_file(fs::symlink_status(cached, ec)))
+    {
+        fs::last_write_time(cached, fs::file_time_type::clock::now(), ec);
+        return cached.string();
+    }
+
+    // Written under a name unique to this process and renamed into place, so that concurrent
+    // runs never read a partial file. Runs expanding the same input at once write the same
+    // bytes, and the last rename wins.
+    std::random_device rd;
+    char               suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%08x%08x.tmp", rd(), rd());
+    fs::path tmp = cached;
+    tmp += suffix;
+
+    try
+    {
+        expand(source, tmp.string());
+    }
+    catch(const output_error&)
+    {
+        // A cache directory which cannot be written is not an error
+        fs::remove(tmp, ec);
+        return "";
+    }
+    catch(...)
+    {
+        fs::remove(tmp, ec);
+        throw;
+    }
+
+    fs::rename(tmp, cached, ec);
+    if(ec)
+    {
+        fs::remove(tmp, ec);
+        return "";
+    }
+
+    evict_cache_entries(cache_dir);
+    return cached.string();
+}
@@ -26,6 +26,7 @@ import sys
 import os
 import argparse
 import ctypes
+import struct
 from fnmatch import fnmatchcase
 try:  # Import either the C or pure-Python YAML parser
     from yaml import CLoader as Loader
@@ -45,6 +46,7 @@ INCLUDE_RE = re.compile(r'include\s*:\s*([-.\w/]+)')
 
 args = {}
 testcases = set()
+function_records = {}
 datatypes = {}
 param = {}
 
@@ -53,6 +55,7 @@ def main():
     args.update(parse_args().__dict__)
     for doc in get_yaml_docs():
         process_doc(doc)
+    write_index(args['outfile'])
 
 
 def process_doc(doc):
@@ -447,11 +450,34 @@ def write_test(test):
 
     byt = bytes(param['Arguments'](*arg))
     if byt not in testcases:
+        function_records.setdefault(test['function'], []).append(len(testcases))
         testcases.add(byt)
         write_signature(args['outfile'])
         args['outfile'].write(byt)
 
 
+def write_index(out):
+    """Write the index of the record numbers of each function after the records,
+    in the format read by RocBLAS_TestData_File in rocblas_data.hpp"""
+    if 'signature_written' not in args:
+        return
+    size = ctypes.sizeof(param['Arguments'])
+    name_size = param['Arguments'].function.size
+    offset = 8 + size + 8 + len(testcases) * size
+
+    byt = bytearray(struct.pack('=Q', len(function_records)))
+    first = 0
+    for function, records in function_records.items():
+        byt.extend(bytes(function, 'utf_8').ljust(name_size, b'\0'))
+        byt.extend(struct.pack('=QQ', first, len(records)))
+        first += len(records)
+    for records in function_records.values():
+        byt.extend(struct.pack('=%dQ' % len(records), *records))
+    byt.extend(struct.pack('=Q', offset))
+    byt.extend(b'RBTDIDX\0')
+    out.write(byt)
+
+
 def instantiate(test):
     """Instantiate a given test case"""
     test = test.copy()
@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*!\file
+ * \brief rocblas-gentest expands a YAML test data file with rocblas_gentest(), taking the
+ * infile, -o, -I and --template arguments of rocblas_gentest.py, so that the two expansions
+ * can be compared.
+ */
+
+#include "rocblas_gentest.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::string              infile, outfile, template_file;
+    std::vector<std::string> includes;
+
+    auto usage = [&] {
+        std::cerr << "Usage: " << argv[0] << " [-I <dir>]... [-t <template>] -o <outfile> <infile>"
+                  << std::endl;
+        return EXIT_FAILURE;
+    };
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if(!strcmp(arg, "-o") || !strcmp(arg, "--out") || !strcmp(arg, "-I")
+           || !strcmp(arg, "-t") || !strcmp(arg, "--template"))
+        {
+            if(++i == argc)
+                return usage();
+            if(arg[1] == 'I')
+                includes.push_back(argv[i]);
+            else if(arg[1] == 'o' || !strcmp(arg, "--out"))
+                outfile = argv[i];
+            else
+                template_file = argv[i];
+        }
+        else if(!strncmp(arg, "-I", 2))
+            includes.push_back(arg + 2);
+        else if(arg[0] == '-' || !infile.empty())
+            return usage();
+        else
+            infile = arg;
+    }
+
+    if(infile.empty() || outfile.empty())
+        return usage();
+
+    try
+    {
+        rocblas_gentest(infile, outfile, includes, template_file);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
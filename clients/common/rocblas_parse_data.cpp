@@ -22,35 +22,64 @@
 
 #include "rocblas_parse_data.hpp"
 #include "rocblas_data.hpp"
+#include "rocblas_gentest.hpp"
 #include "utility.hpp"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <fcntl.h>
 #include <iostream>
 #include <string>
 #include <sys/types.h>
+#include <tuple>
+#include <utility>
 
-// Parse YAML data
-static std::string rocblas_parse_yaml(const std::string& yaml)
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+// Directory of cached expansions of --yaml files, or "" if caching is disabled
+static std::string rocblas_yaml_cache_dir()
 {
-    std::string tmp     = rocblas_tempname();
-    auto        exepath = rocblas_exepath();
-    auto cmd = exepath + "rocblas_gentest.py --template " + exepath + "rocblas_template.yaml -o "
-               + tmp + " " + yaml;
-    rocblas_cerr << cmd << std::endl;
+    const char* env = getenv("ROCBLAS_CLIENT_YAML_CACHE");
+    if(env)
+        return strcmp(env, "0") ? env : "";
 
 #ifdef WIN32
-    int status = std::system(cmd.c_str());
-    if(status == -1)
-        exit(EXIT_FAILURE);
+    return (fs::temp_directory_path() / "rocblas-yaml-cache").string();
 #else
-    int status = system(cmd.c_str());
-    if(status == -1 || !WIFEXITED(status) || WEXITSTATUS(status))
-        exit(EXIT_FAILURE);
+    return (fs::temp_directory_path() / ("rocblas-yaml-cache-" + std::to_string(getuid())))
+        .string();
 #endif
+}
+
+// Parse YAML data, returning the data file and whether it is a temporary file
+static std::pair<std::string, bool> rocblas_parse_yaml(const std::string& yaml)
+{
+    auto exepath       = rocblas_exepath();
+    auto template_file = exepath + "rocblas_template.yaml";
 
-    return tmp;
+    // Expanded as rocblas_gentest.py --template rocblas_template.yaml would, without Python
+    try
+    {
+        auto cache_dir = rocblas_yaml_cache_dir();
+        if(cache_dir != "")
+        {
+            auto cached = rocblas_gentest_cached(yaml, cache_dir, {}, template_file);
+            if(cached != "")
+                return {cached, false};
+        }
+
+        std::string tmp = rocblas_tempname();
+        rocblas_gentest(yaml, tmp, {}, template_file);
+        return {tmp, true};
+    }
+    catch(const std::exception& e)
+    {
+        rocblas_cerr << e.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
 }
 
 // Parse --data and --yaml command-line arguments
@@ -106,12 +135,13 @@ bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
     else if(filename == "")
         filename = default_file;
 
+    bool temporary = false;
     if(yaml)
-        filename = rocblas_parse_yaml(filename);
+        std::tie(filename, temporary) = rocblas_parse_yaml(filename);
 
     if(filename != "")
     {
-        RocBLAS_TestData::set_filename(filename, yaml);
+        RocBLAS_TestData::set_filename(filename, temporary);
         return true;
     }
 
@@ -26,7 +26,8 @@
 // Note: We do not use random_device to initialize the RNG, because we want
 // repeatability in case of test failure. TODO: Add seed as an optional CLI
 // argument, and print the seed on output, to ensure repeatability.
-rocblas_rng_t g_rocblas_seed(69069); // A fixed seed to start at
+const uint64_t g_rocblas_seed_value = 69069; // A fixed seed to start at
+rocblas_rng_t  g_rocblas_seed(g_rocblas_seed_value);
 
 // This records the main thread ID at startup
 std::thread::id g_main_thread_id = std::this_thread::get_id();
@@ -37,13 +38,12 @@ thread_local rocblas_rng_t t_rocblas_rng = get_seed();
 
 thread_local int t_rocblas_rand_idx;
 
+thread_local uint32_t t_rocblas_rng_stream;
+
 // length to allow use as bitmask to wraparound
 #define RANDLEN 1024
-#define RANDWIN 256
-#define RANDBUF RANDLEN + RANDWIN
-static thread_local int    t_rand_init = 0;
-static thread_local float  t_rand_f_array[RANDBUF];
-static thread_local double t_rand_d_array[RANDBUF];
+static thread_local int   t_rand_init = 0;
+static thread_local float t_rand_f_array[RANDLEN];
 
 /* ============================================================================================ */
 
@@ -51,82 +51,78 @@ float rocblas_uniform_int_1_10()
 {
     if(!t_rand_init)
     {
-        for(int i = 0; i < RANDBUF; i++)
-        {
+        for(int i = 0; i < RANDLEN; i++)
             t_rand_f_array[i]
                 = (float)std::uniform_int_distribution<unsigned>(1, 10)(t_rocblas_rng);
-            t_rand_d_array[i] = (double)t_rand_f_array[i];
-        }
         t_rand_init = 1;
     }
     t_rocblas_rand_idx = (t_rocblas_rand_idx + 1) & (RANDLEN - 1);
     return t_rand_f_array[t_rocblas_rand_idx];
 }
 
-inline int pseudo_rand_ptr_offset()
-{
-    t_rocblas_rand_idx = (t_rocblas_rand_idx + 1) & (RANDWIN - 1);
-    return t_rocblas_rand_idx;
-}
+// The counter-based runs compute one Philox block per element, in a loop without branches
+// that vectorizes, and take one word of it for a real value and two for a complex value
 
-void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num)
+template <typename T>
+static void uniform_int_1_10_run(T* ptr, size_t num, const rocblas_rng_stream& s, uint64_t index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
-
-    for(size_t i = 0; i < num; i += RANDLEN)
+    const uint32_t k0 = uint32_t(s.seed), k1 = uint32_t(s.seed >> 32);
+    for(size_t i = 0; i < num; i++)
     {
-        float* rptr = t_rand_f_array + pseudo_rand_ptr_offset();
-        size_t n    = i + RANDLEN < num ? RANDLEN : num - i;
-        memcpy(ptr, rptr, sizeof(float) * n);
-        ptr += RANDLEN;
+        uint64_t idx    = index + i;
+        uint32_t ctr[4] = {uint32_t(idx), uint32_t(idx >> 32), s.stream, 0};
+        rocblas_philox4x32_10(ctr, k0, k1);
+        ptr[i] = T(rocblas_rng_int(ctr[0], 1, 10));
     }
 }
 
-void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num)
+template <typename T>
+static void uniform_int_1_10_run_complex(T*                        ptr,
+                                         size_t                    num,
+                                         const rocblas_rng_stream& s,
+                                         uint64_t                  index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
-
-    for(size_t i = 0; i < num; i += RANDLEN)
+    using R           = decltype(std::real(T{}));
+    const uint32_t k0 = uint32_t(s.seed), k1 = uint32_t(s.seed >> 32);
+    for(size_t i = 0; i < num; i++)
     {
-        double* rptr = t_rand_d_array + pseudo_rand_ptr_offset();
-        size_t  n    = i + RANDLEN < num ? RANDLEN : num - i;
-        memcpy(ptr, rptr, sizeof(double) * n);
-        ptr += RANDLEN;
+        uint64_t idx    = index + i;
+        uint32_t ctr[4] = {uint32_t(idx), uint32_t(idx >> 32), s.stream, 0};
+        rocblas_philox4x32_10(ctr, k0, k1);
+        ptr[i] = {R(rocblas_rng_int(ctr[0], 1, 10)), R(rocblas_rng_int(ctr[1], 1, 10))};
     }
 }
 
-void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr, size_t num)
+void rocblas_uniform_int_1_10_run_float(float*                    ptr,
+                                        size_t                    num,
+                                        const rocblas_rng_stream& s,
+                                        uint64_t                  index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
+    uniform_int_1_10_run(ptr, num, s, index);
+}
 
-    constexpr int rand_len = RANDLEN / 2;
-    for(size_t i = 0; i < num; i += rand_len)
-    {
-        float* rptr = t_rand_f_array + pseudo_rand_ptr_offset();
-        size_t n    = i + rand_len < num ? rand_len : num - i;
-        memcpy(ptr, rptr, sizeof(float) * 2 * n);
-        ptr += rand_len;
-    }
+void rocblas_uniform_int_1_10_run_double(double*                   ptr,
+                                         size_t                    num,
+                                         const rocblas_rng_stream& s,
+                                         uint64_t                  index)
+{
+    uniform_int_1_10_run(ptr, num, s, index);
 }
 
-void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr, size_t num)
+void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex*    ptr,
+                                                size_t                    num,
+                                                const rocblas_rng_stream& s,
+                                                uint64_t                  index)
 {
-    if(!t_rand_init)
-        rocblas_uniform_int_1_10();
+    uniform_int_1_10_run_complex(ptr, num, s, index);
+}
 
-    constexpr int rand_len = RANDLEN / 2;
-    for(size_t i = 0; i < num; i += rand_len)
-    {
-        double* rptr = t_rand_d_array + pseudo_rand_ptr_offset();
-        size_t  n    = i + rand_len < num ? rand_len : num - i;
-        memcpy(ptr, rptr, sizeof(double) * 2 * n);
-        ptr += rand_len;
-    }
+void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex*   ptr,
+                                                 size_t                    num,
+                                                 const rocblas_rng_stream& s,
+                                                 uint64_t                  index)
+{
+    uniform_int_1_10_run_complex(ptr, num, s, index);
 }
 
 #undef RANDLEN
-#undef RANDWIN
-#undef RANDBUF
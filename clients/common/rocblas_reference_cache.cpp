@@ -0,0 +1,277 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_reference_cache.hpp"
+#include "cblas_interface.hpp"
+#include "rocblas_hash.hpp"
+#include "rocblas_random.hpp"
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#error no filesystem found
+#endif
+
+namespace
+{
+    // Start of every cached result, followed by the size of the result and of its compression
+    constexpr char magic[8] = "rocBLAS";
+
+    std::atomic<uint64_t> hits{0}, misses{0}, bytes{0}, stored_bytes{0};
+
+    std::string version_string()
+    {
+        size_t size;
+        rocblas_get_version_string_size(&size);
+        std::string str(size - 1, '\0');
+        rocblas_get_version_string(str.data(), size);
+        return str;
+    }
+
+    // Path of the result of arg in blocks in the cache directory dir
+    fs::path cache_path(const std::string&                          dir,
+                        const Arguments&                            arg,
+                        const std::vector<rocblas_reference_block>& blocks)
+    {
+        // Everything else which the test data and the reference depend on
+        static const std::string identity
+            = "rocblas_reference_cache " + std::to_string(rocblas_reference_cache_version) + "\n"
+              + version_string() + "\n" + cblas_library_identity() + "\n"
+              + std::to_string(g_rocblas_seed_value) + "\n";
+
+        std::ostringstream key;
+        key << identity << arg.function << "\n" << arg;
+        for(const auto& block : blocks)
+            key << block.size << " " << block.elem_size << "\n";
+
+        auto hash = rocblas_hash_bytes(key.str());
+        char name[64];
+        snprintf(name, sizeof(name), "%016" PRIx64 "%016" PRIx64 ".gold", hash.hi, hash.lo);
+        return fs::path(dir) / name;
+    }
+
+    // The bytes of the elements of each block are grouped by their position in the element, so
+    // that bytes which vary little, such as exponents and the low bytes of the integer values of
+    // most test data, form long runs
+    std::vector<uint8_t> shuffle(const std::vector<rocblas_reference_block>& blocks)
+    {
+        std::vector<uint8_t> out;
+        for(const auto& block : blocks)
+        {
+            auto   src = static_cast<const uint8_t*>(block.data);
+            size_t w   = block.elem_size, n = block.size / w, start = out.size();
+            out.resize(start + block.size);
+            for(size_t j = 0; j < w; j++)
+                for(size_t i = 0; i < n; i++)
+                    out[start + j * n + i] = src[i * w + j];
+            memcpy(&out[start + n * w], src + n * w, block.size - n * w);
+        }
+        return out;
+    }
+
+    void unshuffle(const std::vector<uint8_t>&                 in,
+                   const std::vector<rocblas_reference_block>& blocks)
+    {
+        size_t start = 0;
+        for(const auto& block : blocks)
+        {
+            auto   dst = static_cast<uint8_t*>(block.data);
+            size_t w   = block.elem_size, n = block.size / w;
+            for(size_t j = 0; j < w; j++)
+                for(size_t i = 0; i < n; i++)
+                    dst[i * w + j] = in[start + j * n + i];
+            memcpy(dst + n * w, &in[start + n * w], block.size - n * w);
+            start += block.size;
+        }
+    }
+
+    // PackBits run-length encoding: a count byte c of 0 to 127 is followed by c + 1 literal
+    // bytes, and a count byte c of -127 to -2 is followed by a byte repeated 1 - c times
+    std::vector<uint8_t> pack(const std::vector<uint8_t>& in)
+    {
+        std::vector<uint8_t> out;
+        size_t               n    = in.size();
+        auto                 run3 = [&](size_t i) {
+            return i + 2 < n && in[i] == in[i + 1] && in[i] == in[i + 2];
+        };
+
+        for(size_t i = 0; i < n;)
+        {
+            if(run3(i))
+            {
+                size_t run = 3;
+                while(run < 128 && i + run < n && in[i + run] == in[i])
+                    run++;
+                out.push_back(uint8_t(int8_t(1 - int(run))));
+                out.push_back(in[i]);
+                i += run;
+            }
+            else
+            {
+                size_t end = i + 1;
+                while(end < n && end - i < 128 && !run3(end))
+                    end++;
+                out.push_back(uint8_t(end - i - 1));
+                out.insert(out.end(), in.begin() + i, in.begin() + end);
+                i = end;
+            }
+        }
+        return out;
+    }
+
+    // Returns whether in unpacks to exactly size bytes
+    bool unpack(const std::vector<uint8_t>& in, size_t size, std::vector<uint8_t>& out)
+    {
+        out.clear();
+        out.reserve(size);
+        for(size_t i = 0; i < in.size();)
+        {
+            int c = int8_t(in[i++]);
+            if(c >= 0)
+            {
+                if(in.size() - i < size_t(c) + 1 || size - out.size() < size_t(c) + 1)
+                    return false;
+                out.insert(out.end(), in.begin() + i, in.begin() + i + c + 1);
+                i += c + 1;
+            }
+            else
+            {
+                if(c == -128 || i == in.size() || size - out.size() < size_t(1 - c))
+                    return false;
+                out.insert(out.end(), size_t(1 - c), in[i++]);
+            }
+        }
+        return out.size() == size;
+    }
+}
+
+std::string rocblas_reference_cache_dir()
+{
+    const char* env = getenv("ROCBLAS_CLIENT_REFERENCE_CACHE");
+    return env && strcmp(env, "0") ? env : "";
+}
+
+bool rocblas_reference_cache_load(const Arguments&                            arg,
+                                  const std::vector<rocblas_reference_block>& blocks)
+{
+    auto dir = rocblas_reference_cache_dir();
+    if(arg.timing || dir.empty())
+        return false;
+
+    size_t size = 0;
+    for(const auto& block : blocks)
+        size += block.size;
+
+    std::ifstream in(cache_path(dir, arg, blocks).string(), std::ios::binary);
+    char          header[8];
+    uint64_t      raw_size = 0, packed_size = 0;
+    in.read(header, sizeof(header));
+    in.read(reinterpret_cast<char*>(&raw_size), sizeof(raw_size));
+    in.read(reinterpret_cast<char*>(&packed_size), sizeof(packed_size));
+
+    std::vector<uint8_t> packed, raw;
+    // The compression of size bytes is at most 1 byte longer for every 128 bytes
+    if(in && !memcmp(header, magic, sizeof(magic)) && raw_size == size
+       && packed_size <= size + size / 128 + 1)
+    {
+        packed.resize(packed_size);
+        in.read(reinterpret_cast<char*>(packed.data()), packed_size);
+    }
+
+    if(!in || packed.size() != packed_size || !unpack(packed, size, raw))
+    {
+        misses++;
+        return false;
+    }
+
+    unshuffle(raw, blocks);
+    hits++;
+    bytes += size;
+    stored_bytes += packed_size;
+    return true;
+}
+
+void rocblas_reference_cache_store(const Arguments&                            arg,
+                                   const std::vector<rocblas_reference_block>& blocks)
+{
+    auto dir = rocblas_reference_cache_dir();
+    if(arg.timing || dir.empty())
+        return;
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    auto     packed      = pack(shuffle(blocks));
+    uint64_t raw_size    = 0;
+    uint64_t packed_size = packed.size();
+    for(const auto& block : blocks)
+        raw_size += block.size;
+
+    // Written under a name unique to this process and renamed into place, so that concurrent
+    // runs never read a partial file. A cache which cannot be written is not an error.
+    fs::path           cached = cache_path(dir, arg, blocks);
+    std::random_device rd;
+    char               suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%08x%08x.tmp", rd(), rd());
+    fs::path tmp = cached;
+    tmp += suffix;
+
+    {
+        std::ofstream out(tmp.string(), std::ios::binary);
+        out.write(magic, sizeof(magic));
+        out.write(reinterpret_cast<const char*>(&raw_size), sizeof(raw_size));
+        out.write(reinterpret_cast<const char*>(&packed_size), sizeof(packed_size));
+        out.write(reinterpret_cast<const char*>(packed.data()), packed_size);
+        out.close();
+        if(!out)
+        {
+            fs::remove(tmp, ec);
+            return;
+        }
+    }
+
+    fs::rename(tmp, cached, ec);
+    if(ec)
+    {
+        fs::remove(tmp, ec);
+        return;
+    }
+    bytes += raw_size;
+    stored_bytes += packed_size;
+}
+
+rocblas_reference_cache_stats rocblas_reference_cache_statistics()
+{
+    return {hits, misses, bytes, stored_bytes};
+}
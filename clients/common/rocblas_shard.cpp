@@ -0,0 +1,442 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_shard.hpp"
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "type_dispatch.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <type_traits>
+
+namespace
+{
+    // Seconds of a test without work, such as creating its handle and checking its arguments,
+    // and of a billion floating point operations and bytes of the reference, the initialization
+    // and the checks of its results on the host
+    constexpr double test_seconds  = 2e-3;
+    constexpr double gflop_seconds = 1.0 / 20;
+    constexpr double gbyte_seconds = 1.0 / 0.5;
+
+    // Shard of --shard, the cost model corrected by --shard-timing, and the log of --timing-log
+    size_t shard_index = 0;
+    size_t shard_count = 1;
+
+    rocblas_test_cost_model& shard_model()
+    {
+        static rocblas_test_cost_model model;
+        return model;
+    }
+
+    std::ofstream timing_log;
+    std::mutex    timing_log_mutex;
+
+    bool ends_with(const std::string& str, const char* suffix)
+    {
+        size_t len = strlen(suffix);
+        return str.size() >= len && !str.compare(str.size() - len, len, suffix);
+    }
+
+    // Function of the variants of a function, and whether the variant is batched
+    std::pair<std::string, bool> base_function(const char* function)
+    {
+        std::string base = function;
+        for(const char* suffix : {"_ex3", "_ex"})
+            if(ends_with(base, suffix))
+            {
+                base.resize(base.size() - strlen(suffix));
+                break;
+            }
+
+        for(const char* suffix : {"_strided_batched", "_batched"})
+            if(ends_with(base, suffix))
+            {
+                base.resize(base.size() - strlen(suffix));
+                return {base, true};
+            }
+
+        return {base, false};
+    }
+
+    // Work of one batch of the test of arg, with the flops and bytes of T
+    template <typename T = void>
+    struct work_model
+    {
+        rocblas_test_work operator()(const Arguments& arg) const
+        {
+            // Types without a model of their own are counted as float
+            using U = std::conditional_t<std::is_void_v<T>, float, T>;
+
+            auto [f, batched] = base_function(arg.function);
+            int64_t M = arg.M, N = arg.N, K = arg.K;
+            auto    transA = char2rocblas_operation(arg.transA);
+            auto    side   = char2rocblas_side(arg.side);
+            int64_t k      = side == rocblas_side_left ? M : N;
+
+            // Bytes of elements of U
+            auto bytes = [](double elements) { return sizeof(U) * elements / 1e9; };
+
+            rocblas_test_work work{0, 0};
+
+            // Level 1
+            if(f == "asum")
+                work = {asum_gflop_count<U>(N), asum_gbyte_count<U>(N)};
+            else if(f == "axpy")
+                work = {axpy_gflop_count<U>(N), axpy_gbyte_count<U>(N)};
+            else if(f == "copy")
+                work = {0, copy_gbyte_count<U>(N)};
+            else if(f == "dot")
+                work = {dot_gflop_count<false, U>(N), dot_gbyte_count<U>(N)};
+            else if(f == "dotc")
+                work = {dot_gflop_count<true, U>(N), dot_gbyte_count<U>(N)};
+            else if(f == "iamax" || f == "iamin")
+                work = {0, iamax_iamin_gbyte_count<U>(N)};
+            else if(f == "nrm2")
+                work = {nrm2_gflop_count<U>(N), nrm2_gbyte_count<U>(N)};
+            else if(f == "scal")
+                work = {scal_gflop_count<U, U>(N), scal_gbyte_count<U>(N)};
+            else if(f == "swap")
+                work = {0, swap_gbyte_count<U>(N)};
+            else if(f == "rot" || f == "rotm")
+                work = {rot_gflop_count<U, U, U, U>(N), rot_gbyte_count<U>(N)};
+
+            // Level 2
+            else if(f == "gbmv")
+                work = {gbmv_gflop_count<U>(transA, M, N, arg.KL, arg.KU),
+                        gbmv_gbyte_count<U>(transA, M, N, arg.KL, arg.KU)};
+            else if(f == "gemv")
+                work = {gemv_gflop_count<U>(transA, M, N), gemv_gbyte_count<U>(transA, M, N)};
+            else if(f == "ger" || f == "geru" || f == "gerc")
+                work = {ger_gflop_count<U>(M, N), ger_gbyte_count<U>(M, N)};
+            else if(f == "hbmv")
+                work = {hbmv_gflop_count<U>(N, K), hbmv_gbyte_count<U>(N, K)};
+            else if(f == "hemv")
+                work = {hemv_gflop_count<U>(N), hemv_gbyte_count<U>(N)};
+            else if(f == "her")
+                work = {her_gflop_count<U>(N), her_gbyte_count<U>(N)};
+            else if(f == "her2")
+                work = {her2_gflop_count<U>(N), her2_gbyte_count<U>(N)};
+            else if(f == "hpmv")
+                work = {hpmv_gflop_count<U>(N), hpmv_gbyte_count<U>(N)};
+            else if(f == "hpr")
+                work = {hpr_gflop_count<U>(N), hpr_gbyte_count<U>(N)};
+            else if(f == "hpr2")
+                work = {hpr2_gflop_count<U>(N), hpr2_gbyte_count<U>(N)};
+            else if(f == "sbmv")
+                work = {sbmv_gflop_count<U>(N, K), sbmv_gbyte_count<U>(N, K)};
+            else if(f == "spmv")
+                work = {spmv_gflop_count<U>(N), spmv_gbyte_count<U>(N)};
+            else if(f == "spr")
+                work = {spr_gflop_count<U>(N), spr_gbyte_count<U>(N)};
+            else if(f == "spr2")
+                work = {spr2_gflop_count<U>(N), spr2_gbyte_count<U>(N)};
+            else if(f == "symv")
+                work = {symv_gflop_count<U>(N), symv_gbyte_count<U>(N)};
+            else if(f == "syr")
+                work = {syr_gflop_count<U>(N), syr_gbyte_count<U>(N)};
+            else if(f == "syr2")
+                work = {syr2_gflop_count<U>(N), syr2_gbyte_count<U>(N)};
+            else if(f == "tbmv")
+                work = {tbmv_gflop_count<U>(M, K), tbmv_gbyte_count<U>(M, K)};
+            else if(f == "tbsv")
+                work = {tbsv_gflop_count<U>(N, K), tbmv_gbyte_count<U>(N, K)};
+            else if(f == "tpmv")
+                work = {tpmv_gflop_count<U>(M), tpmv_gbyte_count<U>(M)};
+            else if(f == "tpsv")
+                work = {tpsv_gflop_count<U>(N), tpsv_gbyte_count<U>(N)};
+            else if(f == "trmv")
+                work = {trmv_gflop_count<U>(M), trmv_gbyte_count<U>(M)};
+            else if(f == "trsv")
+                work = {trsv_gflop_count<U>(M), trmv_gbyte_count<U>(M)};
+
+            // Level 3, and extensions
+            else if(f == "gemm" || f == "gemmt")
+                work = {gemm_gflop_count<U>(M, N, K), bytes(M * K + K * N + 2.0 * M * N)};
+            else if(f == "geam" && arg.geam_ex_op == rocblas_geam_ex_operation_min_plus)
+                work = {geam_min_plus_gflop_count<U>(M, N, K), bytes(M * K + K * N + 2.0 * M * N)};
+            else if(f == "geam")
+                work = {geam_gflop_count<U>(M, N), bytes(3.0 * M * N)};
+            else if(f == "dgmm")
+                work = {dgmm_gflop_count<U>(M, N), bytes(2.0 * M * N + k)};
+            else if(f == "hemm")
+                work = {hemm_gflop_count<U>(side, M, N), bytes(double(k) * k + 3.0 * M * N)};
+            else if(f == "symm")
+                work = {symm_gflop_count<U>(side, M, N), bytes(double(k) * k + 3.0 * M * N)};
+            else if(f == "herk")
+                work = {herk_gflop_count<U>(N, K), herk_gbyte_count<U>(N, K)};
+            else if(f == "syrk")
+                work = {syrk_gflop_count<U>(N, K), syrk_gbyte_count<U>(N, K)};
+            else if(f == "her2k")
+                work = {her2k_gflop_count<U>(N, K), bytes(2.0 * N * K + double(N) * N)};
+            else if(f == "herkx")
+                work = {herkx_gflop_count<U>(N, K), bytes(2.0 * N * K + double(N) * N)};
+            else if(f == "syr2k")
+                work = {syr2k_gflop_count<U>(N, K), bytes(2.0 * N * K + double(N) * N)};
+            else if(f == "syrkx")
+                work = {syrkx_gflop_count<U>(N, K), bytes(2.0 * N * K + double(N) * N)};
+            else if(f == "trmm")
+                work = {trmm_gflop_count<U>(M, N, side), bytes(double(k) * k + 2.0 * M * N)};
+            else if(f == "trsm")
+                work = {trsm_gflop_count<U>(M, N, k), bytes(double(k) * k + 2.0 * M * N)};
+            else if(f == "trtri")
+                work = {trtri_gflop_count<U>(N), bytes(2.0 * N * N)};
+
+            // Auxiliary
+            else if(f == "set_get_matrix")
+                work = {0, set_get_matrix_gbyte_count<U>(M, N)};
+            else if(f == "set_get_vector")
+                work = {0, set_get_vector_gbyte_count<U>(M)};
+
+            if(batched && arg.batch_count > 1)
+            {
+                work.gflops *= arg.batch_count;
+                work.gbytes *= arg.batch_count;
+            }
+            return work;
+        }
+    };
+}
+
+rocblas_test_work rocblas_test_work_estimate(const Arguments& arg)
+{
+    return rocblas_simple_dispatch<work_model>(arg);
+}
+
+double rocblas_test_model_seconds(const rocblas_test_work& work)
+{
+    return test_seconds + work.gflops * gflop_seconds + work.gbytes * gbyte_seconds;
+}
+
+bool rocblas_test_cost_model::learn(const std::string& log)
+{
+    std::ifstream in(log);
+    if(!in)
+        return false;
+
+    // Each line is the function, gflops, gbytes and seconds of a test
+    std::string line;
+    while(std::getline(in, line))
+    {
+        std::istringstream record(line);
+        std::string        function;
+        rocblas_test_work  work;
+        double             seconds;
+        if(record >> function >> work.gflops >> work.gbytes >> seconds)
+        {
+            double modeled = rocblas_test_model_seconds(work);
+            m_functions[function].first += seconds;
+            m_functions[function].second += modeled;
+            m_measured += seconds;
+            m_modeled += modeled;
+        }
+    }
+    return true;
+}
+
+double rocblas_test_cost_model::operator()(const Arguments& arg) const
+{
+    double seconds = rocblas_test_model_seconds(rocblas_test_work_estimate(arg));
+
+    // Functions are scaled by the ratio of their measured and modeled times, and functions
+    // which are not in the logs by the ratio of all the tests in the logs
+    if(m_modeled > 0)
+    {
+        auto it = m_functions.find(arg.function);
+        if(it != m_functions.end())
+            seconds *= it->second.first / it->second.second;
+        else
+            seconds *= m_measured / m_modeled;
+    }
+    return seconds;
+}
+
+std::vector<size_t> rocblas_lpt_schedule(const std::vector<double>& costs, size_t shards)
+{
+    // Costs in decreasing order, with ties in their original order
+    std::vector<size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+    // Each cost goes to the shard with the least cost so far, or the first of equal shards
+    using load = std::pair<double, size_t>;
+    std::priority_queue<load, std::vector<load>, std::greater<load>> loads;
+    for(size_t s = 0; s < shards; s++)
+        loads.push({0.0, s});
+
+    std::vector<size_t> shard(costs.size());
+    for(size_t i : order)
+    {
+        auto [cost, s] = loads.top();
+        loads.pop();
+        shard[i] = s;
+        loads.push({cost + costs[i], s});
+    }
+    return shard;
+}
+
+void rocblas_shard_select(const RocBLAS_TestData_File& file, std::vector<size_t>& records)
+{
+    if(shard_count <= 1)
+        return;
+
+    // Records of the shard, assigned once from all the records of the file. Each category is
+    // scheduled separately, so that runs of some of the categories are balanced too.
+    static const std::vector<bool> in_shard = [&] {
+        std::unordered_map<std::string, std::vector<size_t>> categories;
+        std::vector<double>                                  costs(file.size());
+        for(size_t i = 0; i < file.size(); i++)
+        {
+            Arguments arg = file[i];
+            costs[i]      = shard_model()(arg);
+            categories[arg.category].push_back(i);
+        }
+
+        std::vector<bool> selected(file.size());
+        double            total = 0, shard_total = 0;
+        size_t            count = 0;
+        for(const auto& category : categories)
+        {
+            const auto&         numbers = category.second;
+            std::vector<double> category_costs;
+            for(size_t i : numbers)
+                category_costs.push_back(costs[i]);
+
+            auto shards = rocblas_lpt_schedule(category_costs, shard_count);
+            for(size_t j = 0; j < numbers.size(); j++)
+            {
+                total += category_costs[j];
+                if(shards[j] == shard_index)
+                {
+                    selected[numbers[j]] = true;
+                    shard_total += category_costs[j];
+                    count++;
+                }
+            }
+        }
+
+        std::ostringstream msg;
+        msg << "rocblas-test INFO: shard " << shard_index << "/" << shard_count << ": " << count
+            << " of " << file.size() << " records, estimated " << std::fixed << std::setprecision(1)
+            << shard_total << " of " << total << " seconds";
+        rocblas_cout << msg.str() << std::endl;
+        return selected;
+    }();
+
+    records.erase(std::remove_if(records.begin(),
+                                 records.end(),
+                                 [](size_t i) { return !in_shard[i]; }),
+                  records.end());
+}
+
+void rocblas_parse_shard(int& argc, char** argv)
+{
+    char** argv_p = argv + 1;
+    bool   help   = false;
+
+    // Scan, process and remove any --shard, --shard-timing or --timing-log options
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--shard") || !strcmp(argv[i], "--shard-timing")
+           || !strcmp(argv[i], "--timing-log"))
+        {
+            if(!argv[i + 1] || !argv[i + 1][0])
+            {
+                rocblas_cerr << "The " << argv[i] << " option requires an argument" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+
+            const char* option = argv[i];
+            const char* value  = argv[++i];
+            if(!strcmp(option, "--shard"))
+            {
+                unsigned long long index, count;
+                char               end;
+                if(sscanf(value, "%llu/%llu%c", &index, &count, &end) != 2 || index >= count)
+                {
+                    rocblas_cerr << "The --shard option requires i/N, where 0 <= i < N"
+                                 << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                shard_index = index;
+                shard_count = count;
+            }
+            else if(!strcmp(option, "--shard-timing"))
+            {
+                if(!shard_model().learn(value))
+                {
+                    rocblas_cerr << "Cannot read the timing log " << value << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else
+            {
+                timing_log.open(value);
+                if(!timing_log)
+                {
+                    rocblas_cerr << "Cannot write the timing log " << value << std::endl;
+                    exit(EXIT_FAILURE);
+                }
+                timing_log << std::setprecision(9);
+            }
+        }
+        else
+        {
+            *argv_p++ = argv[i];
+            if(!help && (!strcmp(argv[i], "-h") || !strcmp(argv[i], "--help")))
+            {
+                help = true;
+                rocblas_cout << "--shard <i>/<N>        Run shard i of N shards of balanced cost\n"
+                             << "--shard-timing <path>  Correct the costs of the shards with a "
+                                "timing log\n"
+                             << "--timing-log <path>    Write the times of the tests to a log\n"
+                             << std::endl;
+            }
+        }
+    }
+
+    // argc and argv contain remaining options and non-option arguments
+    *argv_p = nullptr;
+    argc    = argv_p - argv;
+}
+
+void rocblas_log_test_time(const Arguments& arg, double seconds)
+{
+    std::lock_guard<std::mutex> lock(timing_log_mutex);
+    if(!timing_log.is_open())
+        return;
+
+    auto work = rocblas_test_work_estimate(arg);
+    timing_log << arg.function << " " << work.gflops << " " << work.gbytes << " " << seconds
+               << std::endl;
+}
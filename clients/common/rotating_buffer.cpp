@@ -0,0 +1,127 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rotating_buffer.hpp"
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace
+{
+    rocblas_rotating_buffer_options rotating_buffer_options;
+
+    thread_local bool                           rotating_buffer_has_result = false;
+    thread_local rocblas_rotating_buffer_result rotating_buffer_result;
+
+    // MALL (Infinity Cache) sizes, which are not reported by hipDeviceProp_t
+    size_t mall_bytes(const char* arch)
+    {
+        static const struct
+        {
+            const char* arch;
+            size_t      mib;
+        } mall[] = {{"gfx940", 256},
+                    {"gfx941", 256},
+                    {"gfx942", 256},
+                    {"gfx950", 256},
+                    {"gfx1030", 128},
+                    {"gfx1031", 96},
+                    {"gfx1032", 32},
+                    {"gfx1034", 16},
+                    {"gfx1100", 96},
+                    {"gfx1101", 64},
+                    {"gfx1102", 32},
+                    {"gfx1200", 32},
+                    {"gfx1201", 64}};
+
+        // gcnArchName may be followed by target features, e.g. gfx90a:sramecc+:xnack-
+        size_t len = strcspn(arch, ":");
+        for(const auto& m : mall)
+            if(strlen(m.arch) == len && !strncmp(arch, m.arch, len))
+                return m.mib << 20;
+        return 0;
+    }
+}
+
+void rocblas_set_rotating_buffer(const rocblas_rotating_buffer_options& opt)
+{
+    rotating_buffer_options = opt;
+}
+
+const rocblas_rotating_buffer_options& rocblas_get_rotating_buffer()
+{
+    return rotating_buffer_options;
+}
+
+size_t rocblas_device_cache_bytes()
+{
+    static std::mutex            mutex;
+    static std::map<int, size_t> cache_bytes;
+
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = cache_bytes.find(device);
+    if(it != cache_bytes.end())
+        return it->second;
+
+    size_t          bytes = 0;
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device) == hipSuccess)
+        bytes = size_t(std::max(props.l2CacheSize, 0)) + mall_bytes(props.gcnArchName);
+    return cache_bytes[device] = bytes;
+}
+
+size_t rocblas_rotating_buffer_copies(const Arguments& arg, size_t operand_bytes)
+{
+    if(!arg.timing || !operand_bytes)
+        return 1;
+
+    const auto& opt    = rocblas_get_rotating_buffer();
+    size_t      target = arg.flush_malloc_size;
+    if(opt.enabled)
+        target = opt.bytes ? opt.bytes : 2 * rocblas_device_cache_bytes();
+
+    return target ? 1 + (target - 1) / operand_bytes : 1;
+}
+
+void rocblas_rotating_buffer_set_result(const rocblas_rotating_buffer_result& result)
+{
+    rotating_buffer_result     = result;
+    rotating_buffer_has_result = true;
+}
+
+void rocblas_rotating_buffer_clear_result()
+{
+    rotating_buffer_has_result = false;
+}
+
+bool rocblas_rotating_buffer_take_result(rocblas_rotating_buffer_result& result)
+{
+    if(!rotating_buffer_has_result)
+        return false;
+    result                     = rotating_buffer_result;
+    rotating_buffer_has_result = false;
+    return true;
+}
@@ -21,6 +21,10 @@
  * ************************************************************************ */
 
 #include "singletons.hpp"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 
 // global for device memory padding see d_vector.hpp
 size_t g_DVEC_PAD = 4096;
@@ -29,3 +33,122 @@ void d_vector_set_pad_length(size_t pad)
 {
     g_DVEC_PAD = pad;
 }
+
+namespace
+{
+    struct d_vector_block
+    {
+        int    device;
+        size_t bytes;
+    };
+
+    // enabled and live_count are read without the mutex, so that allocations bypass the cache
+    // without locking while it is disabled and holds no live blocks
+    struct d_vector_cache
+    {
+        std::mutex                                  mutex;
+        std::atomic<bool>                           enabled{false};
+        std::atomic<size_t>                         live_count{0};
+        std::unordered_map<void*, d_vector_block>   live;
+        std::map<int, std::multimap<size_t, void*>> free_blocks;
+
+        // Record a live block; the caller holds the mutex
+        void add_live(void* ptr, d_vector_block block)
+        {
+            live[ptr]  = block;
+            live_count = live.size();
+        }
+
+        // Release all cached blocks; the caller holds the mutex
+        void release()
+        {
+            int saved_device = -1;
+            (void)hipGetDevice(&saved_device);
+            for(auto& dev : free_blocks)
+            {
+                (void)hipSetDevice(dev.first);
+                for(auto& block : dev.second)
+                    (void)(hipFree)(block.second);
+            }
+            free_blocks.clear();
+            if(saved_device >= 0)
+                (void)hipSetDevice(saved_device);
+        }
+    };
+
+    d_vector_cache& get_d_vector_cache()
+    {
+        static d_vector_cache cache;
+        return cache;
+    }
+}
+
+hipError_t d_vector_malloc(void** ptr, size_t bytes)
+{
+    auto& cache = get_d_vector_cache();
+    if(!cache.enabled)
+        return (hipMalloc)(ptr, bytes);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if(!cache.enabled)
+        return (hipMalloc)(ptr, bytes);
+
+    int        device = 0;
+    hipError_t status = hipGetDevice(&device);
+    if(status != hipSuccess)
+        return status;
+
+    // Best fit among the cached blocks of this device
+    auto& blocks = cache.free_blocks[device];
+    auto  it     = blocks.lower_bound(bytes);
+    if(it != blocks.end())
+    {
+        *ptr = it->second;
+        cache.add_live(*ptr, {device, it->first});
+        blocks.erase(it);
+        return hipSuccess;
+    }
+
+    status = (hipMalloc)(ptr, bytes);
+    if(status != hipSuccess && !cache.free_blocks.empty())
+    {
+        (void)hipGetLastError();
+        cache.release();
+        status = (hipMalloc)(ptr, bytes);
+    }
+    if(status == hipSuccess)
+        cache.add_live(*ptr, {device, bytes});
+    return status;
+}
+
+hipError_t d_vector_free(void* ptr)
+{
+    auto& cache = get_d_vector_cache();
+    if(!cache.enabled && !cache.live_count)
+        return (hipFree)(ptr);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+
+    // Blocks not allocated through the cache, such as managed memory, are freed directly
+    auto it = cache.live.find(ptr);
+    if(it == cache.live.end())
+        return (hipFree)(ptr);
+
+    d_vector_block block = it->second;
+    cache.live.erase(it);
+    cache.live_count = cache.live.size();
+    if(!cache.enabled)
+        return (hipFree)(ptr);
+
+    cache.free_blocks[block.device].emplace(block.bytes, ptr);
+    return hipSuccess;
+}
+
+void d_vector_set_cache(bool enable)
+{
+    auto&                       cache = get_d_vector_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.enabled = enable;
+    if(!enable)
+        cache.release();
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "timing_statistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+double rocblas_timing_percentile(const std::vector<double>& sorted, double p)
+{
+    if(sorted.empty())
+        return 0;
+
+    p        = std::min(std::max(p, 0.0), 1.0);
+    double h = p * (sorted.size() - 1);
+    size_t i = size_t(h);
+    if(i + 1 >= sorted.size())
+        return sorted.back();
+    return sorted[i] + (h - i) * (sorted[i + 1] - sorted[i]);
+}
+
+rocblas_timing_statistics rocblas_timing_summarize(std::vector<double> samples,
+                                                   double              confidence,
+                                                   int                 resamples,
+                                                   uint64_t            seed)
+{
+    rocblas_timing_statistics stats;
+    size_t                    n = samples.size();
+    if(!n)
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+
+    stats.samples = n;
+    stats.min     = samples.front();
+    stats.max     = samples.back();
+    stats.median  = rocblas_timing_percentile(samples, 0.5);
+    stats.p90     = rocblas_timing_percentile(samples, 0.9);
+    stats.p99     = rocblas_timing_percentile(samples, 0.99);
+    stats.mean    = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+
+    double sum_sq = 0;
+    for(double x : samples)
+        sum_sq += (x - stats.mean) * (x - stats.mean);
+    stats.stddev = n > 1 ? std::sqrt(sum_sq / (n - 1)) : 0;
+
+    stats.ci_low = stats.ci_high = stats.mean;
+    if(n < 2 || resamples < 1)
+        return stats;
+
+    // Percentile bootstrap of the mean. The modulo bias of the index draw is negligible
+    // compared to n, and unlike std::uniform_int_distribution it is the same on all platforms.
+    std::mt19937_64     rng(seed);
+    std::vector<double> means(resamples);
+    for(auto& m : means)
+    {
+        double sum = 0;
+        for(size_t i = 0; i < n; ++i)
+            sum += samples[rng() % n];
+        m = sum / n;
+    }
+    std::sort(means.begin(), means.end());
+
+    double alpha  = (1 - confidence) / 2;
+    stats.ci_low  = rocblas_timing_percentile(means, alpha);
+    stats.ci_high = rocblas_timing_percentile(means, 1 - alpha);
+    return stats;
+}
+
+// set once by rocblas-bench before any tests run
+static rocblas_iteration_timing_options iteration_timing;
+
+void rocblas_set_iteration_timing(const rocblas_iteration_timing_options& opt)
+{
+    iteration_timing = opt;
+}
+
+const rocblas_iteration_timing_options& rocblas_get_iteration_timing()
+{
+    return iteration_timing;
+}
+
+static thread_local bool                      iteration_timing_has_result = false;
+static thread_local rocblas_timing_statistics iteration_timing_result;
+
+void rocblas_iteration_timing_set_result(const rocblas_timing_statistics& stats)
+{
+    iteration_timing_result     = stats;
+    iteration_timing_has_result = true;
+}
+
+void rocblas_iteration_timing_clear_result()
+{
+    iteration_timing_has_result = false;
+}
+
+bool rocblas_iteration_timing_take_result(rocblas_timing_statistics& stats)
+{
+    if(!iteration_timing_has_result)
+        return false;
+    stats                       = iteration_timing_result;
+    iteration_timing_has_result = false;
+    return true;
+}
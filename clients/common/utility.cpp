@@ -26,6 +26,7 @@
 #include <random>
 #endif
 #include "../../library/src/include/handle.hpp"
+#include "argument_model.hpp"
 #include "d_vector.hpp"
 #include "utility.hpp"
 #include <chrono>
@@ -312,6 +313,12 @@ rocblas_local_handle::rocblas_local_handle(const Arguments& arg)
     status = rocblas_set_math_mode(m_handle, rocblas_math_mode(arg.math_mode));
     if(status != rocblas_status_success)
         throw std::runtime_error(rocblas_status_to_string(status));
+
+#ifdef ROCBLAS_BENCH
+    // Report the Tensile solution selected by gemm-based functions in structured output
+    if(ArgumentModel_get_output_format() != rocblas_client_output_format::table)
+        rocblas_set_solution_index_query(m_handle, rocblas_bench_solution_index_slot());
+#endif
 }
 
 rocblas_local_handle::~rocblas_local_handle()
@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include <atomic>
+#include <cstring>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <vector>
+
+namespace
+{
+    // Check that cblas_batched computes each batch once, with the threads it should use, and
+    // that it restores the threads of the host BLAS
+    void check_batches(int64_t batch_count, double batch_gflops, int expected_threads)
+    {
+        int                           blas_threads = cblas_set_num_threads(0);
+        std::vector<std::atomic<int>> calls(batch_count);
+        std::atomic<int>              threads{1};
+
+        EXPECT_EQ(cblas_batched_threads(batch_count, batch_gflops), expected_threads);
+
+        cblas_batched(batch_count, batch_gflops, [&](int64_t b) {
+            calls[b]++;
+#ifdef _OPENMP
+            if(omp_in_parallel())
+                threads = omp_get_num_threads();
+#endif
+        });
+
+        for(int64_t b = 0; b < batch_count; b++)
+            EXPECT_EQ(calls[b], 1) << "batch " << b << " of " << batch_count;
+        EXPECT_EQ(threads, expected_threads);
+        EXPECT_EQ(cblas_set_num_threads(0), blas_threads);
+    }
+
+    template <typename...>
+    struct testing_cblas_batched : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const double small = cblas_batched_large_gflops / 10;
+            const double large = cblas_batched_large_gflops * 10;
+
+#ifdef _OPENMP
+            const int threads   = omp_get_max_threads();
+            const int n_threads = 4;
+            omp_set_num_threads(n_threads);
+
+            // Many batches get all the threads, whatever their size, few small batches get a
+            // thread each, and few large batches are computed in order
+            check_batches(0, small, 1);
+            check_batches(1, small, 1);
+            check_batches(1, large, 1);
+            check_batches(2, small, 2);
+            check_batches(2, large, 1);
+            check_batches(n_threads, large, n_threads);
+            check_batches(100, small, n_threads);
+            check_batches(100, large, n_threads);
+
+            // Nested in a parallel region, batches are computed in order
+#pragma omp parallel num_threads(2)
+            {
+#pragma omp master
+                EXPECT_EQ(cblas_batched_threads(100, small), 1);
+            }
+
+            omp_set_num_threads(1);
+            check_batches(100, small, 1);
+            omp_set_num_threads(n_threads);
+#else
+            // Without OpenMP the batches are computed in order
+            const int n_threads = 4;
+            check_batches(0, small, 1);
+            check_batches(2, small, 1);
+            check_batches(100, small, 1);
+#endif
+
+            // Batches computed in parallel give the results of the serial loop
+            const int64_t M = arg.M, N = M + 3, K = M + 5, batch_count = 2 * n_threads + 1;
+
+            host_strided_batch_matrix<float> hA(M, K, M, M * K, batch_count);
+            host_strided_batch_matrix<float> hB(K, N, K, K * N, batch_count);
+            host_strided_batch_matrix<float> hC(M, N, M, M * N, batch_count);
+            host_strided_batch_matrix<float> hC_gold(M, N, M, M * N, batch_count);
+
+            // Small integers, so that the products are exact in any order
+            for(int64_t b = 0; b < batch_count; b++)
+            {
+                for(int64_t i = 0; i < M * K; i++)
+                    hA[b][i] = float((i * 7 + b) % 9) - 4;
+                for(int64_t i = 0; i < K * N; i++)
+                    hB[b][i] = float((i * 5 + b) % 7) - 3;
+                for(int64_t i = 0; i < M * N; i++)
+                    hC[b][i] = hC_gold[b][i] = float((i + b) % 5);
+            }
+
+            const float alpha = 2, beta = -1;
+            for(int64_t b = 0; b < batch_count; b++)
+                cblas_gemm<float>(rocblas_operation_none,
+                                  rocblas_operation_none,
+                                  M,
+                                  N,
+                                  K,
+                                  alpha,
+                                  hA[b],
+                                  M,
+                                  hB[b],
+                                  K,
+                                  beta,
+                                  hC_gold[b],
+                                  M);
+
+#ifdef _OPENMP
+            ASSERT_GT(cblas_batched_threads(batch_count, gemm_gflop_count<float>(M, N, K)), 1);
+#endif
+            cblas_batched(batch_count, gemm_gflop_count<float>(M, N, K), [&](int64_t b) {
+                cblas_gemm<float>(rocblas_operation_none,
+                                  rocblas_operation_none,
+                                  M,
+                                  N,
+                                  K,
+                                  alpha,
+                                  hA[b],
+                                  M,
+                                  hB[b],
+                                  K,
+                                  beta,
+                                  hC[b],
+                                  M);
+            });
+
+            for(int64_t b = 0; b < batch_count; b++)
+                EXPECT_EQ(memcmp(hC[b], hC_gold[b], sizeof(float) * M * N), 0) << "batch " << b;
+
+#ifdef _OPENMP
+            omp_set_num_threads(threads);
+#endif
+        }
+    };
+
+    struct cblas_batched_test : RocBLAS_Test<cblas_batched_test, testing_cblas_batched>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "cblas_batched");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<cblas_batched_test>(arg.name);
+        }
+    };
+
+    TEST_P(cblas_batched_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_cblas_batched<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(cblas_batched_test)
+
+} // namespace
@@ -0,0 +1,349 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <random>
+#include <vector>
+
+namespace
+{
+    // The full float copies and cblas_sgemm which cblas_gemm_blocked replaces
+    template <typename TiA,
+              typename TiB,
+              typename To,
+              typename LoadA,
+              typename LoadB,
+              typename LoadC>
+    void copied_gemm(rocblas_operation transA,
+                     rocblas_operation transB,
+                     int64_t           m,
+                     int64_t           n,
+                     int64_t           k,
+                     float             alpha,
+                     const TiA*        A,
+                     int64_t           lda,
+                     const TiB*        B,
+                     int64_t           ldb,
+                     float             beta,
+                     To*               C,
+                     int64_t           ldc,
+                     LoadA             load_a,
+                     LoadB             load_b,
+                     LoadC             load_c)
+    {
+        size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
+        size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
+        size_t sizeC = n * size_t(ldc);
+
+        std::vector<float> A_float(sizeA), B_float(sizeB), C_float(sizeC);
+        for(size_t i = 0; i < sizeA; i++)
+            A_float[i] = load_a(A[i]);
+        for(size_t i = 0; i < sizeB; i++)
+            B_float[i] = load_b(B[i]);
+        for(size_t i = 0; i < sizeC; i++)
+            C_float[i] = beta == 0 ? 0.0f : load_c(C[i]);
+
+        cblas_sgemm(CblasColMajor,
+                    static_cast<CBLAS_TRANSPOSE>(transA),
+                    static_cast<CBLAS_TRANSPOSE>(transB),
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    A_float.data(),
+                    lda,
+                    B_float.data(),
+                    ldb,
+                    beta,
+                    C_float.data(),
+                    ldc);
+
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+                C[i + j * ldc] = To(C_float[i + j * ldc]);
+    }
+
+    // Matrices of one gemm problem, with padding rows in lda, ldb and ldc
+    template <typename TiA, typename TiB, typename To>
+    struct gemm_problem
+    {
+        rocblas_operation transA, transB;
+        int64_t           m, n, k, lda, ldb, ldc;
+        std::vector<TiA>  A;
+        std::vector<TiB>  B;
+        std::vector<To>   C;
+
+        template <typename Gen>
+        gemm_problem(rocblas_operation transA,
+                     rocblas_operation transB,
+                     int64_t           m,
+                     int64_t           n,
+                     int64_t           k,
+                     Gen&&             gen)
+            : transA(transA)
+            , transB(transB)
+            , m(m)
+            , n(n)
+            , k(k)
+            , lda((transA == rocblas_operation_none ? m : k) + 3)
+            , ldb((transB == rocblas_operation_none ? k : n) + 1)
+            , ldc(m + 2)
+            , A(lda * (transA == rocblas_operation_none ? k : m))
+            , B(ldb * (transB == rocblas_operation_none ? n : k))
+            , C(ldc * n)
+        {
+            for(auto& a : A)
+                a = TiA(gen());
+            for(auto& b : B)
+                b = TiB(gen());
+            for(auto& c : C)
+                c = To(gen());
+        }
+    };
+
+    constexpr rocblas_operation operations[]
+        = {rocblas_operation_none, rocblas_operation_transpose};
+
+    // Sizes across the blocks of A, B and C, and single rows, columns and terms
+    constexpr int64_t sizes[][3] = {{1, 1, 1}, {7, 3, 5}, {131, 133, 517}, {200, 1, 300}};
+
+    // Compare cblas_gemm_blocked with the full copies for every transpose and size, exactly for
+    // small integers, and within tol of the largest term otherwise
+    template <typename TiA,
+              typename TiB,
+              typename To,
+              typename LoadA,
+              typename LoadB,
+              typename LoadC>
+    void check_gemm(LoadA load_a, LoadB load_b, LoadC load_c, bool integers, float tol = 0)
+    {
+        std::mt19937 rng(1);
+        auto         small_integer = [&] { return float(int(rng() % 7) - 3); };
+        auto         fraction      = [&] { return float(int(rng() % 4095) - 2047) / 512; };
+
+        for(auto transA : operations)
+            for(auto transB : operations)
+                for(auto& size : sizes)
+                    for(float beta : {0.0f, 2.0f})
+                    {
+                        SCOPED_TRACE(testing::Message() << "transA=" << transA << " transB="
+                                                        << transB << " m=" << size[0]
+                                                        << " n=" << size[1] << " k=" << size[2]
+                                                        << " beta=" << beta);
+
+                        gemm_problem<TiA, TiB, To> p(
+                            transA, transB, size[0], size[1], size[2], [&] {
+                                return integers ? small_integer() : fraction();
+                            });
+
+                        // C is not read when beta is 0
+                        if(beta == 0)
+                            for(auto& c : p.C)
+                                c = To(NAN);
+
+                        auto C_blocked = p.C, C_copied = p.C;
+
+                        // clang-format off
+                        ::cblas_gemm_blocked(p.transA, p.transB, p.m, p.n, p.k, 1.5f,
+                                             p.A.data(), p.lda, p.B.data(), p.ldb, beta,
+                                             C_blocked.data(), p.ldc, load_a, load_b, load_c);
+                        copied_gemm(p.transA, p.transB, p.m, p.n, p.k, 1.5f, p.A.data(), p.lda,
+                                    p.B.data(), p.ldb, beta, C_copied.data(), p.ldc,
+                                    load_a, load_b, load_c);
+                        // clang-format on
+
+                        // The terms are at most 1.5 * 4 * 4, and beta * C at most 2 * 4
+                        float bound = tol * (24 * p.k + 8);
+
+                        for(int64_t j = 0; j < p.n; j++)
+                            for(int64_t i = 0; i < p.m; i++)
+                            {
+                                float blocked = float(C_blocked[i + j * p.ldc]);
+                                float copied  = float(C_copied[i + j * p.ldc]);
+                                // float8 results may overflow to NaN, in both
+                                if(std::isnan(blocked) || std::isnan(copied))
+                                    ASSERT_EQ(std::isnan(blocked), std::isnan(copied))
+                                        << "at " << i << ", " << j;
+                                else if(integers)
+                                    ASSERT_EQ(blocked, copied) << "at " << i << ", " << j;
+                                else
+                                    ASSERT_NEAR(blocked, copied, bound) << "at " << i << ", " << j;
+                            }
+
+                        // Rows past m are not written
+                        for(int64_t j = 0; j < p.n; j++)
+                            for(int64_t i = p.m; i < p.ldc; i++)
+                                ASSERT_EQ(std::isnan(float(C_blocked[i + j * p.ldc])),
+                                          std::isnan(float(p.C[i + j * p.ldc])));
+                    }
+    }
+
+    template <typename...>
+    struct testing_cblas_gemm_blocked : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            auto from_float = [](float x) { return x; };
+            auto from_half  = [](rocblas_half x) { return float(x); };
+            auto from_bf16  = [](rocblas_bfloat16 x) { return float(x); };
+
+            check_gemm<float, float, float>(from_float, from_float, from_float, true);
+            check_gemm<float, float, float>(from_float, from_float, from_float, false, 1e-6f);
+            check_gemm<rocblas_half, rocblas_half, rocblas_half>(
+                from_half, from_half, from_half, true);
+            check_gemm<rocblas_half, rocblas_half, float>(from_half, from_half, from_float, true);
+            check_gemm<rocblas_bfloat16, rocblas_bfloat16, rocblas_bfloat16>(
+                from_bf16, from_bf16, from_bf16, true);
+            check_gemm<rocblas_bfloat16, rocblas_bfloat16, float>(
+                from_bf16, from_bf16, from_float, false, 1e-6f);
+
+            // Inputs rounded to bfloat16 with each rocblas_truncate_t, as by the half gemm
+            // with a rounding mode
+            for(auto round : {rocblas_bfloat16::rocblas_truncate,
+                              rocblas_bfloat16::rocblas_round_near_zero,
+                              rocblas_bfloat16::rocblas_round_near_even})
+            {
+                auto rounded = [round](rocblas_half x) {
+                    return float(rocblas_bfloat16(float(x), round));
+                };
+                check_gemm<rocblas_half, rocblas_half, rocblas_half>(
+                    rounded, rounded, rounded, true);
+                check_gemm<rocblas_half, rocblas_half, float>(
+                    rounded, rounded, from_float, false, 1e-6f);
+            }
+
+            // The rounding mode changes the result of the half gemm
+            {
+                std::mt19937 rng(arg.M);
+                gemm_problem<rocblas_half, rocblas_half, rocblas_half> p(
+                    rocblas_operation_none, rocblas_operation_none, 16, 16, 16, [&] {
+                        return float(int(rng() % 4095) - 2047) / 512;
+                    });
+                auto C_even = p.C, C_truncate = p.C;
+
+                // clang-format off
+                cblas_gemm<rocblas_half, rocblas_half, float>(p.transA, p.transB, p.m, p.n, p.k,
+                    1.0f, p.A.data(), p.lda, p.B.data(), p.ldb, 0.0f, C_even.data(), p.ldc,
+                    rocblas_bfloat16::rocblas_round_near_even);
+                cblas_gemm<rocblas_half, rocblas_half, float>(p.transA, p.transB, p.m, p.n, p.k,
+                    1.0f, p.A.data(), p.lda, p.B.data(), p.ldb, 0.0f, C_truncate.data(), p.ldc,
+                    rocblas_bfloat16::rocblas_truncate);
+                // clang-format on
+
+                bool differ = false;
+                for(int64_t j = 0; j < p.n; j++)
+                    for(int64_t i = 0; i < p.m; i++)
+                        differ |= float(C_even[i + j * p.ldc]) != float(C_truncate[i + j * p.ldc]);
+                EXPECT_TRUE(differ);
+            }
+
+            // float8 inputs and outputs
+            {
+                auto from_f8  = [](rocblas_f8 x) { return float(x); };
+                auto from_bf8 = [](rocblas_bf8 x) { return float(x); };
+                check_gemm<rocblas_f8, rocblas_bf8, float>(from_f8, from_bf8, from_float, true);
+                check_gemm<rocblas_f8, rocblas_f8, rocblas_f8>(from_f8, from_f8, from_f8, true);
+            }
+
+            // alpha of 0 only scales C, and k of 0 is the same
+            {
+                std::mt19937 rng(arg.M);
+                gemm_problem<rocblas_half, rocblas_half, float> p(
+                    rocblas_operation_none, rocblas_operation_transpose, 9, 5, 4, [&] {
+                        return float(int(rng() % 7) - 3);
+                    });
+                auto C = p.C;
+                cblas_gemm<rocblas_half, float, float>(
+                    p.transA, p.transB, p.m, p.n, p.k, 0.0f, p.A.data(), p.lda, p.B.data(), p.ldb,
+                    2.0f, C.data(), p.ldc);
+                for(int64_t j = 0; j < p.n; j++)
+                    for(int64_t i = 0; i < p.m; i++)
+                        ASSERT_EQ(C[i + j * p.ldc], 2 * p.C[i + j * p.ldc]);
+
+                cblas_gemm<rocblas_half, float, float>(
+                    p.transA, p.transB, p.m, p.n, 0, 1.0f, p.A.data(), p.lda, p.B.data(), p.ldb,
+                    0.5f, C.data(), p.ldc);
+                for(int64_t j = 0; j < p.n; j++)
+                    for(int64_t i = 0; i < p.m; i++)
+                        ASSERT_EQ(C[i + j * p.ldc], p.C[i + j * p.ldc]);
+            }
+
+#ifdef _OPENMP
+            // The result does not depend on the number of threads
+            {
+                std::mt19937 rng(arg.M);
+                gemm_problem<rocblas_bfloat16, rocblas_bfloat16, float> p(
+                    rocblas_operation_transpose, rocblas_operation_none, 300, 200, 700, [&] {
+                        return float(int(rng() % 4095) - 2047) / 512;
+                    });
+                auto C_threads = p.C, C_single = p.C;
+
+                // clang-format off
+                cblas_gemm<rocblas_bfloat16, float, float>(p.transA, p.transB, p.m, p.n, p.k,
+                    1.0f, p.A.data(), p.lda, p.B.data(), p.ldb, 1.0f, C_threads.data(), p.ldc);
+                int threads = omp_get_max_threads();
+                omp_set_num_threads(1);
+                cblas_gemm<rocblas_bfloat16, float, float>(p.transA, p.transB, p.m, p.n, p.k,
+                    1.0f, p.A.data(), p.lda, p.B.data(), p.ldb, 1.0f, C_single.data(), p.ldc);
+                omp_set_num_threads(threads);
+                // clang-format on
+
+                EXPECT_EQ(C_threads, C_single);
+            }
+#endif
+        }
+    };
+
+    struct cblas_gemm_blocked : RocBLAS_Test<cblas_gemm_blocked, testing_cblas_gemm_blocked>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "cblas_gemm_blocked");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<cblas_gemm_blocked>(arg.name);
+        }
+    };
+
+    TEST_P(cblas_gemm_blocked, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_cblas_gemm_blocked<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(cblas_gemm_blocked)
+
+} // namespace
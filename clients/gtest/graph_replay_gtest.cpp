@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_device_malloc.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include <stdlib.h>
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#endif
+
+namespace
+{
+    // Create a handle with ROCBLAS_GRAPH_REPLAY set to value, restoring the environment
+    rocblas_handle create_handle_with_graph_replay(const char* value)
+    {
+        const char* env      = getenv("ROCBLAS_GRAPH_REPLAY");
+        std::string previous = env ? env : "";
+        setenv("ROCBLAS_GRAPH_REPLAY", value, true);
+
+        rocblas_handle handle = nullptr;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+        if(env)
+            setenv("ROCBLAS_GRAPH_REPLAY", previous.c_str(), true);
+        else
+            unsetenv("ROCBLAS_GRAPH_REPLAY");
+        return handle;
+    }
+
+    // Run solve(handle, set) on the handle with graph replay in each of the ways which
+    // replay, update or bypass the cached graph, and check that each result matches the
+    // result of launching the kernels directly. set selects one of two copies of the data.
+    template <typename F>
+    void check_graph_replay(rocblas_handle replay, rocblas_handle direct, F&& solve)
+    {
+        const std::vector<float> gold = solve(direct, 0);
+
+        // The first call launches directly, the second captures the launch sequence, and
+        // the later calls with the same pointers replay the graph
+        for(int iter = 0; iter < 4; iter++)
+            EXPECT_TRUE(solve(replay, 0) == gold);
+
+        // New pointers update the kernel node parameters of the cached graph with
+        // hipGraphExecUpdate, and the original pointers update them back
+        for(int set : {1, 1, 0, 0, 1})
+            EXPECT_TRUE(solve(replay, set) == gold);
+
+        // Workspace held by the caller moves the free workspace used by the kernels, so the
+        // graph is updated and must leave the held memory untouched
+        {
+            constexpr size_t      held_size = 1 << 20;
+            rocblas_device_malloc held(replay, held_size);
+            ASSERT_TRUE(held);
+            void* held_ptr = static_cast<void*>(held);
+            CHECK_HIP_ERROR(hipMemset(held_ptr, 0x5a, held_size));
+
+            for(int iter = 0; iter < 3; iter++)
+                EXPECT_TRUE(solve(replay, 0) == gold);
+
+            std::vector<unsigned char> h_held(held_size);
+            CHECK_HIP_ERROR(hipMemcpy(h_held.data(), held_ptr, held_size, hipMemcpyDeviceToHost));
+            size_t overwritten = 0;
+            for(size_t i = 0; i < held_size; i++)
+                overwritten += h_held[i] != 0x5a;
+            EXPECT_EQ(overwritten, size_t(0));
+        }
+
+        for(int iter = 0; iter < 2; iter++)
+            EXPECT_TRUE(solve(replay, 0) == gold);
+
+        // Device pointer mode launches the kernels directly
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(replay, rocblas_pointer_mode_device));
+        for(int iter = 0; iter < 3; iter++)
+            EXPECT_TRUE(solve(replay, 0) == gold);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(replay, rocblas_pointer_mode_host));
+    }
+
+    template <typename...>
+    struct testing_graph_replay : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            rocblas_handle replay = create_handle_with_graph_replay("16");
+            rocblas_handle direct = create_handle_with_graph_replay("0");
+
+            const rocblas_int       N       = arg.N;
+            const rocblas_fill      uplo    = char2rocblas_fill(arg.uplo);
+            const rocblas_operation transA  = char2rocblas_operation(arg.transA);
+            const rocblas_diagonal  diag    = char2rocblas_diagonal(arg.diag);
+            const float             h_alpha = arg.get_alpha<float>();
+
+            host_matrix<float> hA(N, N, N);
+            host_matrix<float> hB(N, N, N);
+            host_matrix<float> hX(N, N, N);
+            host_vector<float> hx(N);
+            host_vector<float> hy(N);
+
+            device_matrix<float> dA0(N, N, N), dA1(N, N, N);
+            device_matrix<float> dB0(N, N, N), dB1(N, N, N);
+            device_vector<float> dx0(N), dx1(N);
+            device_vector<float> d_alpha(1);
+            CHECK_DEVICE_ALLOCATION(dA0.memcheck());
+            CHECK_DEVICE_ALLOCATION(dA1.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB0.memcheck());
+            CHECK_DEVICE_ALLOCATION(dB1.memcheck());
+            CHECK_DEVICE_ALLOCATION(dx0.memcheck());
+            CHECK_DEVICE_ALLOCATION(dx1.memcheck());
+            CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+            rocblas_init_matrix(hA,
+                                arg,
+                                rocblas_client_never_set_nan,
+                                rocblas_client_diagonally_dominant_triangular_matrix,
+                                true);
+            rocblas_init_matrix(
+                hB, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix);
+            rocblas_init_vector(hx, arg, rocblas_client_never_set_nan);
+
+            CHECK_HIP_ERROR(dA0.transfer_from(hA));
+            CHECK_HIP_ERROR(dA1.transfer_from(hA));
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+
+            const size_t size = size_t(N) * N;
+
+            // trsm solves in place, so B is reset before each call
+            auto trsm = [&](rocblas_handle handle, int set) {
+                auto& dA = set ? dA1 : dA0;
+                auto& dB = set ? dB1 : dB0;
+
+                rocblas_pointer_mode mode;
+                CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+                const float* alpha
+                    = mode == rocblas_pointer_mode_host ? &h_alpha : (const float*)d_alpha;
+
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+                CHECK_ROCBLAS_ERROR(rocblas_strsm(
+                    handle, rocblas_side_left, uplo, transA, diag, N, N, alpha, dA, N, dB, N));
+                CHECK_HIP_ERROR(hX.transfer_from(dB));
+                return std::vector<float>((float*)hX, (float*)hX + size);
+            };
+
+            // The triangle of invA not written by trtri is cleared before each call
+            auto trtri = [&](rocblas_handle handle, int set) {
+                auto& dA    = set ? dA1 : dA0;
+                auto& dinvA = set ? dB1 : dB0;
+
+                CHECK_HIP_ERROR(hipMemset(dinvA, 0, size * sizeof(float)));
+                CHECK_ROCBLAS_ERROR(rocblas_strtri(handle, uplo, diag, N, dA, N, dinvA, N));
+                CHECK_HIP_ERROR(hX.transfer_from(dinvA));
+                return std::vector<float>((float*)hX, (float*)hX + size);
+            };
+
+            // trsv solves in place, so x is reset before each call
+            auto trsv = [&](rocblas_handle handle, int set) {
+                auto& dA = set ? dA1 : dA0;
+                auto& dx = set ? dx1 : dx0;
+
+                CHECK_HIP_ERROR(dx.transfer_from(hx));
+                CHECK_ROCBLAS_ERROR(rocblas_strsv(handle, uplo, transA, diag, N, dA, N, dx, 1));
+                CHECK_HIP_ERROR(hy.transfer_from(dx));
+                return std::vector<float>((float*)hy, (float*)hy + N);
+            };
+
+            check_graph_replay(replay, direct, trsm);
+            check_graph_replay(replay, direct, trtri);
+            check_graph_replay(replay, direct, trsv);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(replay));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(direct));
+        }
+    };
+
+    struct graph_replay : RocBLAS_Test<graph_replay, testing_graph_replay>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "graph_replay");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<graph_replay>(arg.name) << arg.uplo << arg.transA << arg.diag;
+        }
+    };
+
+    TEST_P(graph_replay, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_graph_replay<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(graph_replay)
+
+} // namespace
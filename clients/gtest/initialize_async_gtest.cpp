@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <string>
+
+namespace
+{
+    template <typename...>
+    struct testing_initialize_async : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            int count, device;
+            CHECK_HIP_ERROR(hipGetDeviceCount(&count));
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+
+            int initialized, requested;
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_query(nullptr, &requested),
+                                  rocblas_status_invalid_pointer);
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_query(&initialized, nullptr),
+                                  rocblas_status_invalid_pointer);
+
+            // Out of range device IDs are rejected
+            rocblas_initialize_options options{};
+            int                        bad_device = count;
+            options.devices                       = &bad_device;
+            options.device_count                  = 1;
+            EXPECT_ROCBLAS_STATUS(rocblas_initialize_async(&options),
+                                  rocblas_status_invalid_value);
+
+            // Initialize the current device, twice, without blocking
+            options.devices = &device;
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_async(&options));
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_async(&options));
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_query(&initialized, &requested));
+            EXPECT_LE(initialized, requested);
+            EXPECT_LE(requested, count);
+
+            // A function which does not need initialization can run while it is in progress
+            rocblas_local_handle handle{arg};
+            rocblas_int          N = arg.N;
+            host_vector<float>   hx(N);
+            device_vector<float> dx(N);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            for(rocblas_int i = 0; i < N; i++)
+                hx[i] = 1.0f;
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+            float result = 0;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_sasum(handle, N, dx, 1, &result));
+            EXPECT_FLOAT_EQ(float(N), result);
+
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_wait());
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_query(&initialized, &requested));
+            EXPECT_EQ(initialized, requested);
+
+            // Initialize all devices
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_async(nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_wait());
+            CHECK_ROCBLAS_ERROR(rocblas_initialize_query(&initialized, &requested));
+            EXPECT_EQ(initialized, requested);
+
+            // The files loaded during initialization are reported
+            rocblas_tensile_load_stats stats;
+            EXPECT_ROCBLAS_STATUS(rocblas_get_tensile_load_stats(nullptr),
+                                  rocblas_status_invalid_pointer);
+            CHECK_ROCBLAS_ERROR(rocblas_get_tensile_load_stats(&stats));
+#ifdef BUILD_WITH_TENSILE
+            EXPECT_GT(stats.files_loaded, 0);
+            EXPECT_GT(stats.bytes_loaded, 0);
+            EXPECT_GE(stats.load_time_ms, 0);
+
+            // The load filter cannot be changed once Tensile is initialized
+            EXPECT_ROCBLAS_STATUS(rocblas_set_tensile_load_filter("HHS_NN,BSS"),
+                                  rocblas_status_invalid_value);
+#endif
+        }
+    };
+
+    struct initialize_async : RocBLAS_Test<initialize_async, testing_initialize_async>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "initialize_async");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<initialize_async>(arg.name);
+        }
+    };
+
+    TEST_P(initialize_async, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_initialize_async<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(initialize_async)
+
+} // namespace
@@ -0,0 +1,403 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_compare.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    T make(double re, double im)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return T(re, im);
+        else if constexpr(rocblas_convert_fast<T>)
+            return T(float(re));
+        else
+            return T(re);
+    }
+
+    template <typename T>
+    void parts(const T& x, double& re, double& im)
+    {
+        if constexpr(rocblas_is_complex<T>)
+        {
+            re = std::real(x);
+            im = std::imag(x);
+        }
+        else
+        {
+            re = rocblas_compare_detail::value(x);
+            im = 0;
+        }
+    }
+
+    // Errors of one batch computed from the dense matrix which the options describe
+    struct dense_errors
+    {
+        double one, inf, max, fro, entrywise;
+    };
+
+    template <typename T>
+    dense_errors dense_check(int64_t                        M,
+                             int64_t                        N,
+                             int64_t                        lda,
+                             const T*                       cpu,
+                             const T*                       gpu,
+                             const rocblas_compare_options& opt)
+    {
+        bool upper = opt.uplo == 'U', lower = opt.uplo == 'L';
+        bool sym   = opt.symmetric || opt.hermitian;
+
+        // Element (i, j) of the reference and of the difference, as in the dense matrix
+        std::vector<double> c(M * N), d(M * N);
+        double              sum_c = 0, sum_d = 0;
+        for(int64_t j = 0; j < N; j++)
+            for(int64_t i = 0; i < M; i++)
+            {
+                bool stored = upper ? i <= j : lower ? i >= j : true;
+                if(!stored)
+                    continue;
+
+                double cr, ci, gr, gi;
+                parts(cpu[i + j * lda], cr, ci);
+                parts(gpu[i + j * lda], gr, gi);
+                if(opt.hermitian && i == j)
+                    ci = gi = 0;
+
+                double ca = std::hypot(cr, ci), da = std::hypot(gr - cr, gi - ci);
+                sum_c += ca;
+                sum_d += da;
+                c[i + j * M] = ca;
+                d[i + j * M] = da;
+                if(sym)
+                {
+                    c[j + i * M] = ca;
+                    d[j + i * M] = da;
+                }
+            }
+
+        double one_c = 0, one_d = 0, inf_c = 0, inf_d = 0, max_c = 0, max_d = 0, fro_c = 0,
+               fro_d = 0;
+        for(int64_t j = 0; j < N; j++)
+        {
+            double col_c = 0, col_d = 0;
+            for(int64_t i = 0; i < M; i++)
+            {
+                col_c += c[i + j * M];
+                col_d += d[i + j * M];
+                max_c = std::max(max_c, c[i + j * M]);
+                max_d = std::max(max_d, d[i + j * M]);
+                fro_c += c[i + j * M] * c[i + j * M];
+                fro_d += d[i + j * M] * d[i + j * M];
+            }
+            one_c = std::max(one_c, col_c);
+            one_d = std::max(one_d, col_d);
+        }
+        for(int64_t i = 0; i < M; i++)
+        {
+            double row_c = 0, row_d = 0;
+            for(int64_t j = 0; j < N; j++)
+            {
+                row_c += c[i + j * M];
+                row_d += d[i + j * M];
+            }
+            inf_c = std::max(inf_c, row_c);
+            inf_d = std::max(inf_d, row_d);
+        }
+
+        return {one_d / one_c,
+                inf_d / inf_c,
+                max_d / max_c,
+                std::sqrt(fro_d) / std::sqrt(fro_c),
+                sum_d / sum_c};
+    }
+
+    // Random reference in [-1, 1] and a result with relative errors of about 1e-3
+    template <typename T>
+    void random_pair(std::vector<T>& cpu, std::vector<T>& gpu, size_t size, uint32_t seed)
+    {
+        std::mt19937                           rng(seed);
+        std::uniform_real_distribution<double> dist(-1, 1);
+        cpu.resize(size);
+        gpu.resize(size);
+        for(size_t k = 0; k < size; k++)
+        {
+            double re = dist(rng), im = dist(rng);
+            cpu[k]    = make<T>(re, im);
+            gpu[k]    = make<T>(re * (1 + 1e-3 * dist(rng)), im * (1 + 1e-3 * dist(rng)));
+        }
+    }
+
+    // The norms of rocblas_compare against dense_check for each batch, with few batches so
+    // that the columns are split across threads, and with many batches
+    template <typename T>
+    void check_norms(int64_t M, int64_t N, int64_t lda, int64_t batch_count, char uplo, int sym)
+    {
+        rocblas_compare_options opt;
+        opt.uplo      = uplo;
+        opt.symmetric = sym == 1;
+        opt.hermitian = sym == 2;
+
+        rocblas_stride stride = lda * N + 3;
+        std::vector<T> cpu, gpu;
+        random_pair(cpu, gpu, stride * batch_count, uint32_t(M * N + batch_count));
+
+        auto r = rocblas_compare(M, N, lda, stride, cpu.data(), gpu.data(), batch_count, opt);
+
+        dense_errors e{0, 0, 0, 0, 0};
+        for(int64_t b = 0; b < batch_count; b++)
+        {
+            auto eb = dense_check(M, N, lda, &cpu[b * stride], &gpu[b * stride], opt);
+            e.one   = std::max(e.one, eb.one);
+            e.inf   = std::max(e.inf, eb.inf);
+            e.max   = std::max(e.max, eb.max);
+            e.fro += eb.fro;
+            e.entrywise = std::max(e.entrywise, eb.entrywise);
+        }
+
+        SCOPED_TRACE(testing::Message() << "M=" << M << " N=" << N << " batch_count="
+                                        << batch_count << " uplo=" << uplo << " sym=" << sym);
+        EXPECT_GT(r.frobenius_norm_error, 0);
+        EXPECT_NEAR(r.one_norm_error, e.one, 1e-12 * e.one);
+        EXPECT_NEAR(r.inf_norm_error, e.inf, 1e-12 * e.inf);
+        EXPECT_NEAR(r.max_norm_error, e.max, 1e-12 * e.max);
+        EXPECT_NEAR(r.frobenius_norm_error, e.fro, 1e-12 * e.fro);
+        EXPECT_NEAR(r.entrywise_error, e.entrywise, 1e-12 * e.entrywise);
+        EXPECT_EQ(r.norm_error('O'), r.one_norm_error);
+        EXPECT_EQ(r.norm_error('i'), r.inf_norm_error);
+        EXPECT_EQ(r.norm_error('M'), r.max_norm_error);
+        EXPECT_EQ(r.norm_error('F'), r.frobenius_norm_error);
+    }
+
+    template <typename T>
+    void check_all_norms()
+    {
+        for(int64_t batch_count : {1, 2, 65})
+        {
+            int64_t n = batch_count > 2 ? 40 : 270;
+            check_norms<T>(n + 30, n - 13, n + 31, batch_count, 'N', 0);
+            check_norms<T>(1, n * 4, 1, batch_count, 'N', 0);
+            for(char uplo : {'U', 'L'})
+                for(int sym : {0, 1, rocblas_is_complex<T> ? 2 : 1})
+                    check_norms<T>(n, n, n + 5, batch_count, uplo, sym);
+        }
+    }
+
+    // Mismatches planted in the result are counted, and the first one is found, whether the
+    // batches or the columns are split across threads
+    template <typename T>
+    void check_mismatches(int64_t M, int64_t N, int64_t batch_count)
+    {
+        int64_t        lda    = M + 1;
+        rocblas_stride stride = lda * N;
+        std::vector<T> cpu(stride * batch_count), gpu;
+        for(size_t k = 0; k < cpu.size(); k++)
+            cpu[k] = make<T>(double(k % 7) - 3, 1);
+        gpu = cpu;
+
+        int64_t last_b = batch_count - 1;
+        int64_t spots[][3] = {{last_b, M - 1, N - 1}, {last_b, M / 2, N / 2}, {last_b, 0, N / 2}};
+        for(auto& s : spots)
+            gpu[s[0] * stride + s[1] + s[2] * lda] = make<T>(100, 1);
+
+        rocblas_compare_options opt;
+        opt.abs_error = 0.5;
+
+        auto r = rocblas_compare(M, N, lda, stride, cpu.data(), gpu.data(), batch_count, opt);
+        EXPECT_EQ(r.mismatches, 3);
+        EXPECT_EQ(r.first_batch, last_b);
+        EXPECT_EQ(r.first_col, N / 2);
+        EXPECT_EQ(r.first_row, 0);
+
+        gpu[last_b * stride + 1 + lda] = make<T>(100, 1);
+        r = rocblas_compare(M, N, lda, stride, cpu.data(), gpu.data(), batch_count, opt);
+        EXPECT_EQ(r.mismatches, 4);
+        EXPECT_EQ(r.first_batch, last_b);
+        EXPECT_EQ(r.first_col, 1);
+        EXPECT_EQ(r.first_row, 1);
+
+        // The padding between the columns is not compared
+        gpu = cpu;
+        for(int64_t b = 0; b < batch_count; b++)
+            for(int64_t j = 0; j < N; j++)
+                gpu[b * stride + M + j * lda] = make<T>(100, 1);
+        r = rocblas_compare(M, N, lda, stride, cpu.data(), gpu.data(), batch_count, opt);
+        EXPECT_EQ(r.mismatches, 0);
+        EXPECT_EQ(r.first_batch, -1);
+        EXPECT_EQ(r.max_abs_error, 0);
+        EXPECT_EQ(r.frobenius_norm_error, 0);
+
+        // Only the lower triangle is compared
+        gpu[2 + 3 * lda] = make<T>(100, 1);
+        gpu[3 + 2 * lda] = make<T>(100, 1);
+        opt.uplo         = 'L';
+        r = rocblas_compare(M, N, lda, stride, cpu.data(), gpu.data(), batch_count, opt);
+        EXPECT_EQ(r.mismatches, 1);
+        EXPECT_EQ(r.first_batch, 0);
+        EXPECT_EQ(r.first_col, 2);
+        EXPECT_EQ(r.first_row, 3);
+    }
+
+    // Results n units in the last place away from the reference
+    template <typename T, typename Next>
+    void check_ulp(const std::vector<double>& values, Next next)
+    {
+        for(double v : values)
+            for(int n : {0, 1, 3})
+            {
+                T cpu = make<T>(v, 0), gpu = cpu;
+                for(int k = 0; k < n; k++)
+                    gpu = next(gpu);
+
+                rocblas_compare_options opt;
+                opt.max_ulp = 1;
+
+                auto r = rocblas_compare<T, T>(1, 1, 1, 0, &cpu, &gpu, 1, opt);
+                SCOPED_TRACE(testing::Message() << "value=" << v << " n=" << n);
+                EXPECT_EQ(r.max_ulp_error, n);
+                EXPECT_EQ(r.mismatches, n > 1);
+            }
+    }
+
+    template <typename T>
+    T next_bits(T x)
+    {
+        uint16_t b = 0;
+        memcpy(&b, &x, sizeof(T));
+        b++;
+        memcpy(&x, &b, sizeof(T));
+        return x;
+    }
+
+    template <typename...>
+    struct testing_rocblas_compare : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            check_all_norms<float>();
+            check_all_norms<double>();
+            check_all_norms<rocblas_half>();
+            check_all_norms<rocblas_bfloat16>();
+            check_all_norms<rocblas_float_complex>();
+            check_all_norms<rocblas_double_complex>();
+
+            // Enough elements for the comparison to be split across threads
+            for(int64_t batch_count : {1, 3, 100})
+            {
+                int64_t N = batch_count > 3 ? 40 : 1500;
+                check_mismatches<float>(arg.M, N, batch_count);
+                check_mismatches<double>(arg.M, N, batch_count);
+                check_mismatches<rocblas_half>(arg.M, N, batch_count);
+                check_mismatches<rocblas_f8>(arg.M, N, batch_count);
+                check_mismatches<rocblas_double_complex>(arg.M, N, batch_count);
+                check_mismatches<int32_t>(arg.M, N, batch_count);
+            }
+
+            // Positive values, including subnormals, which stay below the next power of two,
+            // since the ULP error is in units of the spacing at the reference
+            std::vector<double> values = {1, 1.5, 3, 1000.25, 0.001, 0x1p-126, 0x1p-140, 0};
+            check_ulp<float>(values, [](float x) { return std::nextafter(x, 1e30f); });
+            check_ulp<double>(values, [](double x) { return std::nextafter(x, 1e300); });
+            values = {1, 1.5, 3, 1000, 0.001, 0x1p-14, 0x1p-20, 0};
+            check_ulp<rocblas_half>(values, next_bits<rocblas_half>);
+            check_ulp<rocblas_bfloat16>({1, 1.5, 3, 1000, 0.001, 0}, next_bits<rocblas_bfloat16>);
+            check_ulp<rocblas_f8>({1, 1.5, 3, 100, 0.01, 0x1p-7, 0x1p-9, 0}, next_bits<rocblas_f8>);
+            check_ulp<rocblas_bf8>({1, 4, 1000, 0.001, 0x1p-16, 0}, next_bits<rocblas_bf8>);
+            check_ulp<int32_t>({1, 5, 1000, 0}, [](int32_t x) { return x + 1; });
+
+            // Where the reference is NaN the result must be NaN, and NaN in the result is an
+            // infinite ULP error
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            std::vector<double> cpu = {1, nan, 2, nan}, gpu = {1, nan, 2, 3};
+            auto r = rocblas_compare<double, double>(2, 2, 2, 0, cpu.data(), gpu.data());
+            EXPECT_EQ(r.mismatches, 1);
+            EXPECT_EQ(r.first_col, 1);
+            EXPECT_EQ(r.first_row, 1);
+            EXPECT_EQ(r.max_ulp_error, std::numeric_limits<double>::infinity());
+            EXPECT_TRUE(std::isnan(r.norm_error('F')));
+            EXPECT_TRUE(std::isnan(r.norm_error('O')));
+            gpu[3] = nan;
+            r      = rocblas_compare<double, double>(2, 2, 2, 0, cpu.data(), gpu.data());
+            EXPECT_EQ(r.mismatches, 0);
+            EXPECT_EQ(r.max_ulp_error, 0);
+            gpu[0] = nan;
+            r      = rocblas_compare<double, double>(2, 2, 2, 0, cpu.data(), gpu.data());
+            EXPECT_EQ(r.mismatches, 1);
+            EXPECT_EQ(r.first_col, 0);
+            EXPECT_EQ(r.first_row, 0);
+
+            // A vector with a negative increment starts at its last element in memory
+            std::vector<float> x = {1, 2, 3, 4, 5, 6, 7}, y = x;
+            y[6]                 = 0;
+            r = rocblas_compare<float, float>(1, 4, -2, 0, x.data(), y.data());
+            EXPECT_EQ(r.mismatches, 1);
+            EXPECT_EQ(r.first_col, 0);
+
+            // Batches given by pointers, and a reference rounded to the type of the result
+            std::vector<float>            ref = {1.00390625f, 2, 3};
+            std::vector<rocblas_bfloat16> res(3);
+            rocblas_convert_n(ref.data(), res.data(), res.size());
+            const float*            hCPU[] = {ref.data(), ref.data() + 1, ref.data() + 2};
+            const rocblas_bfloat16* hGPU[] = {res.data(), res.data() + 1, res.data() + 2};
+            rocblas_compare_options opt;
+            r = rocblas_compare(1, 1, 1, hCPU, hGPU, 3, opt);
+            EXPECT_EQ(r.mismatches, 1);
+            EXPECT_EQ(r.first_batch, 0);
+            opt.round_reference = true;
+            r                   = rocblas_compare(1, 1, 1, hCPU, hGPU, 3, opt);
+            EXPECT_EQ(r.mismatches, 0);
+        }
+    };
+
+    struct rocblas_compare_test : RocBLAS_Test<rocblas_compare_test, testing_rocblas_compare>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "rocblas_compare");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<rocblas_compare_test>(arg.name);
+        }
+    };
+
+    TEST_P(rocblas_compare_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_rocblas_compare<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rocblas_compare_test)
+
+} // namespace
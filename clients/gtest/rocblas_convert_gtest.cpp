@@ -0,0 +1,208 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_convert.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    uint64_t bits(T x)
+    {
+        uint64_t b = 0;
+        memcpy(&b, &x, sizeof(T));
+        return b;
+    }
+
+    template <typename T>
+    std::vector<T> all_bit_patterns()
+    {
+        std::vector<T> x(size_t(1) << (8 * sizeof(T)));
+        for(size_t i = 0; i < x.size(); i++)
+            memcpy(&x[i], &i, sizeof(T));
+        return x;
+    }
+
+    // Floats with every sign and exponent, the rounding boundaries of half, bfloat16 and
+    // float8 in the low bits of the mantissa, and Inf and NaN with payloads, more than
+    // rocblas_convert_parallel_min of them so that the conversion is split across threads
+    std::vector<float> test_floats(uint32_t seed)
+    {
+        std::mt19937       rng(seed);
+        std::vector<float> x;
+        for(uint32_t exponent = 0; exponent < 256; exponent++)
+            for(uint32_t low : {0x0u, 0x1u, 0x7fffu, 0x8000u, 0x8001u, 0xffffu, 0x1000u, 0x2000u})
+                for(uint32_t sign : {0u, 1u})
+                    for(int r = 0; r < 64; r++)
+                    {
+                        uint32_t mantissa = (rng() & 0x7f0000) | (r ? low : 0);
+                        uint32_t b        = sign << 31 | exponent << 23 | mantissa;
+                        float    f;
+                        memcpy(&f, &b, sizeof(f));
+                        x.push_back(f);
+                    }
+        for(size_t i = 0; i < 200003; i++)
+        {
+            uint32_t b = rng();
+            float    f;
+            memcpy(&f, &b, sizeof(f));
+            x.push_back(f);
+        }
+        return x;
+    }
+
+    // Check rocblas_convert_n(src, dst, n, args...) against Dst(src[i], args...), at each
+    // offset and length around the width of the vector loops
+    template <typename Src, typename Dst, typename Convert, typename Scalar>
+    void check_convert(const std::vector<Src>& src, Convert convert, Scalar scalar)
+    {
+        std::vector<Dst> dst(src.size());
+        convert(src.data(), dst.data(), src.size(), size_t(0));
+        for(size_t i = 0; i < src.size(); i++)
+            ASSERT_EQ(bits(dst[i]), bits(scalar(src[i], i))) << "element " << i;
+
+        for(size_t offset = 0; offset < 8; offset++)
+            for(size_t n = 0; n < 40 && offset + n <= src.size(); n++)
+            {
+                std::vector<Dst> part(n + 1, dst[0]);
+                convert(src.data() + offset, part.data(), n, offset);
+                for(size_t i = 0; i < n; i++)
+                    ASSERT_EQ(bits(part[i]), bits(dst[offset + i]));
+                ASSERT_EQ(bits(part[n]), bits(dst[0])) << "written past n";
+            }
+    }
+
+    template <typename...>
+    struct testing_rocblas_convert : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            std::vector<float> floats = test_floats(arg.M);
+
+            auto to_float = [](auto x, size_t) { return float(x); };
+            auto convert  = [](auto src, auto dst, size_t n, size_t) {
+                rocblas_convert_n(src, dst, n);
+            };
+
+            // Every half, bfloat16 and float8 value to float
+            check_convert<rocblas_half, float>(all_bit_patterns<rocblas_half>(), convert, to_float);
+            check_convert<rocblas_bfloat16, float>(
+                all_bit_patterns<rocblas_bfloat16>(), convert, to_float);
+            check_convert<rocblas_f8, float>(all_bit_patterns<rocblas_f8>(), convert, to_float);
+            check_convert<rocblas_bf8, float>(all_bit_patterns<rocblas_bf8>(), convert, to_float);
+
+            // float to half, and to bfloat16 with each rounding
+            check_convert<float, rocblas_half>(
+                floats, convert, [](float x, size_t) { return rocblas_half(x); });
+            for(auto round : {rocblas_bfloat16::rocblas_truncate,
+                              rocblas_bfloat16::rocblas_round_near_zero,
+                              rocblas_bfloat16::rocblas_round_near_even})
+                check_convert<float, rocblas_bfloat16>(
+                    floats,
+                    [round](const float* src, rocblas_bfloat16* dst, size_t n, size_t) {
+                        rocblas_convert_n(src, dst, n, round);
+                    },
+                    [round](float x, size_t) { return rocblas_bfloat16(x, round); });
+
+            // float to float8, with standard and stochastic rounding
+            std::mt19937          rng(arg.M);
+            std::vector<uint32_t> random(floats.size());
+            for(auto& r : random)
+                r = rng();
+
+            using f8_mode  = rocblas_f8::rocblas_hip_f8_rounding_mode;
+            using bf8_mode = rocblas_bf8::rocblas_hip_f8_rounding_mode;
+            check_convert<float, rocblas_f8>(
+                floats, convert, [](float x, size_t) { return rocblas_f8(x); });
+            check_convert<float, rocblas_bf8>(
+                floats, convert, [](float x, size_t) { return rocblas_bf8(x); });
+            check_convert<float, rocblas_f8>(
+                floats,
+                [&](const float* src, rocblas_f8* dst, size_t n, size_t offset) {
+                    rocblas_convert_n(src, dst, n, f8_mode::stochastic, random.data() + offset);
+                },
+                [&](float x, size_t i) { return rocblas_f8(x, f8_mode::stochastic, random[i]); });
+            check_convert<float, rocblas_bf8>(
+                floats,
+                [&](const float* src, rocblas_bf8* dst, size_t n, size_t offset) {
+                    rocblas_convert_n(src, dst, n, bf8_mode::stochastic, random.data() + offset);
+                },
+                [&](float x, size_t i) {
+                    return rocblas_bf8(x, bf8_mode::stochastic, random[i]);
+                });
+
+            // Other types go through float, or convert directly
+            {
+                auto halves = all_bit_patterns<rocblas_half>();
+                std::vector<double> d(halves.size());
+                rocblas_convert_n<rocblas_half, double>(halves.data(), d.data(), halves.size());
+                for(size_t i = 0; i < halves.size(); i++)
+                {
+                    double expected = double(float(halves[i]));
+                    ASSERT_TRUE(d[i] == expected || (d[i] != d[i] && expected != expected))
+                        << "element " << i;
+                }
+
+                std::vector<double> from_float(floats.size());
+                rocblas_convert_n(floats.data(), from_float.data(), floats.size());
+                for(size_t i = 0; i < floats.size(); i++)
+                    ASSERT_EQ(bits(from_float[i]), bits(double(floats[i])));
+
+                std::vector<float> copy(floats.size());
+                rocblas_convert_n<float, float>(floats.data(), copy.data(), floats.size());
+                ASSERT_EQ(memcmp(copy.data(), floats.data(), floats.size() * sizeof(float)), 0);
+            }
+        }
+    };
+
+    struct rocblas_convert : RocBLAS_Test<rocblas_convert, testing_rocblas_convert>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "rocblas_convert");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<rocblas_convert>(arg.name);
+        }
+    };
+
+    TEST_P(rocblas_convert, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_rocblas_convert<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rocblas_convert)
+
+} // namespace
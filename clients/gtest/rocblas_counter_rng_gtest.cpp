@@ -0,0 +1,330 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_init_device.hpp"
+#include "rocblas_test.hpp"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace
+{
+    template <typename T>
+    bool same_bits(const host_vector<T>& a, const host_vector<T>& b)
+    {
+        return a.size() == b.size() && !memcmp(a.data(), b.data(), a.size() * sizeof(T));
+    }
+
+    // Run init with 1 thread and with 4 threads, from the same seed, and check that the data
+    // is the same and that it is not all one value. Without OpenMP both runs use one thread.
+    template <typename T, typename Init>
+    void check_threads(size_t size, Init init)
+    {
+        host_vector<T> one(size), many(size);
+#ifdef _OPENMP
+        int threads = omp_get_max_threads();
+#endif
+
+        for(int t : {1, 4})
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(t);
+#endif
+            rocblas_seedrand();
+            init(t == 1 ? one : many);
+        }
+#ifdef _OPENMP
+        omp_set_num_threads(threads);
+#endif
+
+        EXPECT_TRUE(same_bits(one, many));
+        EXPECT_TRUE(std::any_of(one.begin(), one.end(), [&](const T& x) {
+            return memcmp(&x, &one[0], sizeof(T));
+        }));
+    }
+
+    template <typename T>
+    void check_matrix_types(rocblas_check_matrix_type matrix_type,
+                            T                         rand_gen(rocblas_counter_rng&))
+    {
+        const size_t M = 67, N = 61, lda = 70, batch_count = 3, stride = lda * N + 5;
+        for(char uplo : {'U', 'L'})
+            check_threads<T>(stride * batch_count, [&](host_vector<T>& A) {
+                rocblas_init_matrix(
+                    matrix_type, uplo, rand_gen, A, M, N, lda, stride, batch_count);
+            });
+    }
+
+    template <typename T>
+    void check_init_threads()
+    {
+        for(auto matrix_type : {rocblas_client_general_matrix,
+                                rocblas_client_symmetric_matrix,
+                                rocblas_client_triangular_matrix,
+                                rocblas_client_diagonally_dominant_triangular_matrix})
+        {
+            check_matrix_types(matrix_type, random_generator<T>);
+            check_matrix_types(matrix_type, random_hpl_generator<T>);
+        }
+
+        const size_t M = 129, N = 33, lda = 130;
+        check_threads<T>(lda * N, [&](host_vector<T>& A) {
+            rocblas_init_matrix_alternating_sign(
+                rocblas_client_general_matrix, 'U', random_hpl_generator<T>, A, M, N, lda);
+        });
+        check_threads<T>(5000 * 3, [&](host_vector<T>& x) {
+            rocblas_init_vector(random_generator<T>, x.data(), 5000, -3);
+        });
+        check_threads<T>(5000 * 2, [&](host_vector<T>& x) {
+            rocblas_init_vector_alternating_sign(random_hpl_generator<T>, x.data(), 5000, 2);
+        });
+    }
+
+    // rocblas_init(), which fills columns with runs, gives the values of random_generator<T>
+    template <typename T>
+    void check_init_runs()
+    {
+        const size_t M = 1000, N = 7, lda = 1003, stride = lda * N, batch_count = 2;
+        host_vector<T> A(stride * batch_count);
+
+        rocblas_seedrand();
+        rocblas_init(A.data(), M, N, lda, stride, batch_count);
+
+        rocblas_seedrand();
+        rocblas_rng_stream s = rocblas_next_rng_stream();
+        for(size_t b = 0; b < batch_count; b++)
+            for(size_t j = 0; j < N; j++)
+                for(size_t i = 0; i < M; i++)
+                {
+                    rocblas_counter_rng rng(s, (b * N + j) * M + i);
+                    T                   expected = random_generator<T>(rng);
+                    ASSERT_EQ(memcmp(&A[i + j * lda + b * stride], &expected, sizeof(T)), 0);
+                }
+    }
+
+    // The values of generator over n indices, and how often each is generated
+    template <typename T>
+    std::map<double, size_t> histogram(T generator(rocblas_counter_rng&), size_t n)
+    {
+        rocblas_rng_stream       s{12345, 6};
+        std::map<double, size_t> h;
+        for(size_t i = 0; i < n; i++)
+        {
+            rocblas_counter_rng rng(s, i);
+            h[double(float(generator(rng)))]++;
+        }
+        return h;
+    }
+
+    template <typename...>
+    struct testing_rocblas_counter_rng : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            // Known answers of Philox4x32-10 from Random123
+            {
+                uint32_t zero[4] = {0, 0, 0, 0};
+                rocblas_philox4x32_10(zero, 0, 0);
+                EXPECT_EQ(zero[0], 0x6627e8d5u);
+                EXPECT_EQ(zero[1], 0xe169c58du);
+                EXPECT_EQ(zero[2], 0xbc57ac4cu);
+                EXPECT_EQ(zero[3], 0x9b00dbd8u);
+
+                uint32_t ones[4] = {~0u, ~0u, ~0u, ~0u};
+                rocblas_philox4x32_10(ones, ~0u, ~0u);
+                EXPECT_EQ(ones[0], 0x408f276du);
+                EXPECT_EQ(ones[1], 0x41c83b0eu);
+                EXPECT_EQ(ones[2], 0xa20bc7c6u);
+                EXPECT_EQ(ones[3], 0x6d5451fdu);
+
+                uint32_t pi[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+                rocblas_philox4x32_10(pi, 0xa4093822, 0x299f31d0);
+                EXPECT_EQ(pi[0], 0xd16cfe09u);
+                EXPECT_EQ(pi[1], 0x94fdccebu);
+                EXPECT_EQ(pi[2], 0x5001e420u);
+                EXPECT_EQ(pi[3], 0x24126ea1u);
+            }
+
+            // The words of an element are its successive Philox blocks
+            {
+                rocblas_rng_stream  s{0x123456789abcdefull, 42};
+                uint64_t            index = 0xfedcba987654ull;
+                rocblas_counter_rng rng(s, index);
+                for(uint32_t block = 0; block < 3; block++)
+                {
+                    uint32_t ctr[4] = {uint32_t(index), uint32_t(index >> 32), s.stream, block};
+                    rocblas_philox4x32_10(ctr, uint32_t(s.seed), uint32_t(s.seed >> 32));
+                    for(int w = 0; w < 4; w++)
+                        EXPECT_EQ(rng(), ctr[w]);
+                    if(!block)
+                        EXPECT_EQ(rocblas_rng_bits(s, index), ctr[0]);
+                }
+            }
+
+            // The data does not depend on the number of threads
+            check_init_threads<float>();
+            check_init_threads<double>();
+            check_init_threads<rocblas_half>();
+            check_init_threads<rocblas_bfloat16>();
+            check_init_threads<rocblas_float_complex>();
+            check_matrix_types(rocblas_client_hermitian_matrix,
+                               random_generator<rocblas_double_complex>);
+            check_matrix_types(rocblas_client_general_matrix, random_hpl_generator<rocblas_f8>);
+            check_matrix_types(rocblas_client_general_matrix, random_generator<rocblas_bf8>);
+            check_threads<float>(size_t(arg.M) * 4000, [&](host_vector<float>& A) {
+                rocblas_init(A.data(), 4000, arg.M, 4000);
+            });
+            check_threads<double>(size_t(arg.M) * 100, [&](host_vector<double>& A) {
+                rocblas_init_matrix(rocblas_client_general_matrix,
+                                    'U',
+                                    random_nan_generator<double>,
+                                    A,
+                                    100,
+                                    arg.M,
+                                    100);
+            });
+
+            check_init_runs<float>();
+            check_init_runs<double>();
+            check_init_runs<rocblas_float_complex>();
+            check_init_runs<rocblas_double_complex>();
+            check_init_runs<rocblas_half>();
+
+            // Each stream is new data, and rocblas_seedrand() restarts the streams
+            {
+                host_vector<float> A(1000), B(1000), C(1000);
+                rocblas_seedrand();
+                rocblas_init_vector(random_generator<float>, A.data(), 1000, 1);
+                rocblas_init_vector(random_generator<float>, B.data(), 1000, 1);
+                rocblas_seedrand();
+                rocblas_init_vector(random_generator<float>, C.data(), 1000, 1);
+                EXPECT_FALSE(same_bits(A, B));
+                EXPECT_TRUE(same_bits(A, C));
+            }
+
+            // The distributions of the generators
+            {
+                const size_t n = 200000;
+                auto         h = histogram<float>(random_generator<float>, n);
+                ASSERT_EQ(h.size(), 10u);
+                for(auto& v : h)
+                {
+                    EXPECT_TRUE(v.first >= 1 && v.first <= 10 && v.first == int(v.first));
+                    EXPECT_NEAR(v.second, n / 10, n / 100);
+                }
+
+                h = histogram<rocblas_half>(random_generator<rocblas_half>, n);
+                ASSERT_EQ(h.size(), 5u);
+                EXPECT_EQ(h.begin()->first, -2);
+                EXPECT_EQ(h.rbegin()->first, 2);
+
+                h = histogram<int8_t>(random_generator<int8_t>, n);
+                ASSERT_EQ(h.size(), 3u);
+                EXPECT_EQ(h.begin()->first, 1);
+
+                h = histogram<double>(random_hpl_generator<double>, n);
+                EXPECT_GE(h.begin()->first, -0.5);
+                EXPECT_LT(h.rbegin()->first, 0.5);
+
+                // Every normal float8 in [-0.5, 0.5] and zero
+                h = histogram<rocblas_f8>(random_hpl_generator<rocblas_f8>, n);
+                ASSERT_EQ(h.size(), 113u);
+                EXPECT_EQ(h.begin()->first, -0.5);
+                EXPECT_EQ(h.rbegin()->first, 0.5);
+                EXPECT_EQ(std::next(h.find(0.0))->first, 0.0009765625);
+
+                h = histogram<rocblas_bf8>(random_hpl_generator<rocblas_bf8>, n);
+                ASSERT_EQ(h.size(), 121u);
+                EXPECT_EQ(h.begin()->first, -0.5);
+                EXPECT_EQ(h.rbegin()->first, 0.5);
+                EXPECT_EQ(std::next(h.find(0.0))->first, 0.00000762939453125);
+
+                rocblas_rng_stream s{1, 2};
+                for(size_t i = 0; i < 10000; i++)
+                {
+                    rocblas_counter_rng rng(s, i);
+                    float               nan = random_nan_generator<float>(rng);
+                    ASSERT_TRUE(std::isnan(nan));
+                }
+            }
+
+            // The device generates the data of the host
+            {
+                const size_t M = 301, N = 17, lda = 310, stride = lda * N, batch_count = 3;
+                host_vector<float>   hA(stride * batch_count), hB(stride * batch_count);
+                device_vector<float> dA(stride * batch_count);
+                CHECK_HIP_ERROR(dA.memcheck());
+                CHECK_HIP_ERROR(dA.transfer_from(hB));
+
+                rocblas_seedrand();
+                rocblas_init_matrix(rocblas_client_general_matrix,
+                                    'U',
+                                    random_hpl_generator<float>,
+                                    hA,
+                                    M,
+                                    N,
+                                    lda,
+                                    stride,
+                                    batch_count);
+                rocblas_seedrand();
+                CHECK_HIP_ERROR((rocblas_init_matrix_device<float, random_hpl_generator<float>>(
+                    dA, M, N, lda, stride, batch_count)));
+                CHECK_HIP_ERROR(hB.transfer_from(dA));
+                EXPECT_TRUE(same_bits(hA, hB));
+            }
+        }
+    };
+
+    struct rocblas_counter_rng_test
+        : RocBLAS_Test<rocblas_counter_rng_test, testing_rocblas_counter_rng>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "rocblas_counter_rng");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<rocblas_counter_rng_test>(arg.name);
+        }
+    };
+
+    TEST_P(rocblas_counter_rng_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_rocblas_counter_rng<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rocblas_counter_rng_test)
+
+} // namespace
@@ -0,0 +1,68 @@
+# ########################################################################
+# Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+# ies of the Software, and to permit persons to whom the Software is furnished
+# to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+# PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+# CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# ########################################################################
+
+# Expands the YAML file yaml with rocblas-gentest, the C++ expansion of the clients, and fails
+# if the test data differs from that written by rocblas_gentest.py. The data of rocblas_gentest.py
+# is the file expected if it is given, and is otherwise written with the same arguments.
+#
+#   cmake -Dpython=<python> -Dgentest_py=<rocblas_gentest.py> -Dgentest=<rocblas-gentest>
+#         -Dyaml=<file> -Dinclude_dir=<dir> [-Dtemplate=<file>] [-Dexpected=<file>]
+#         -Doutput_dir=<dir> -P rocblas_gentest_drift.cmake
+
+get_filename_component( name "${yaml}" NAME_WE )
+get_filename_component( yaml_dir "${yaml}" DIRECTORY )
+file( MAKE_DIRECTORY "${output_dir}" )
+
+set( args -I "${include_dir}" )
+if( template )
+  list( APPEND args -t "${template}" )
+endif()
+
+set( actual "${output_dir}/${name}.cpp.data" )
+execute_process( COMMAND "${gentest}" ${args} -o "${actual}" "${yaml}"
+                 WORKING_DIRECTORY "${yaml_dir}"
+                 RESULT_VARIABLE result )
+if( result )
+  message( FATAL_ERROR "rocblas-gentest failed to expand ${yaml}" )
+endif()
+
+# The expansions of the gtest data are large, so they are removed when they match
+set( remove_files "${actual}" )
+if( NOT expected )
+  set( expected "${output_dir}/${name}.py.data" )
+  list( APPEND remove_files "${expected}" )
+  execute_process( COMMAND "${python}" "${gentest_py}" ${args} "${yaml}" -o "${expected}"
+                   WORKING_DIRECTORY "${yaml_dir}"
+                   RESULT_VARIABLE result )
+  if( result )
+    message( FATAL_ERROR "rocblas_gentest.py failed to expand ${yaml}" )
+  endif()
+endif()
+
+execute_process( COMMAND "${CMAKE_COMMAND}" -E compare_files "${expected}" "${actual}"
+                 RESULT_VARIABLE result )
+if( result )
+  message( FATAL_ERROR "The expansions of ${yaml} by rocblas-gentest and rocblas_gentest.py "
+                       "differ: ${actual} and ${expected}" )
+endif()
+
+file( REMOVE ${remove_files} )
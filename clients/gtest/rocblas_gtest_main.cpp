@@ -24,6 +24,8 @@
 
 #include "rocblas_data.hpp"
 #include "rocblas_parse_data.hpp"
+#include "rocblas_reference_cache.hpp"
+#include "rocblas_shard.hpp"
 #include "rocblas_test.hpp"
 #include "test_cleanup.hpp"
 #include "utility.hpp"
@@ -247,6 +249,20 @@ static void rocblas_print_args(const std::string& args)
     rocblas_cout.flush();
 }
 
+// Print the uses of the reference cache, if it is enabled
+static void rocblas_print_reference_cache_statistics()
+{
+    std::string dir = rocblas_reference_cache_dir();
+    if(dir.empty())
+        return;
+
+    auto stats = rocblas_reference_cache_statistics();
+    rocblas_cout << "rocblas-test INFO: reference cache " << dir << ": " << stats.hits
+                 << " hits, " << stats.misses << " misses, " << stats.bytes << " bytes stored in "
+                 << stats.stored_bytes << " bytes\n"
+                 << std::endl;
+}
+
 // Device Query
 static void rocblas_set_test_device()
 {
@@ -288,6 +304,9 @@ int main(int argc, char** argv)
     // Set data file path
     rocblas_parse_data(argc, argv, rocblas_exepath() + "rocblas_gtest.data");
 
+    // Set the shard of the data to run, and the timing logs
+    rocblas_parse_shard(argc, argv);
+
     // Initialize Google Tests
     testing::InitGoogleTest(&argc, argv);
 
@@ -300,6 +319,8 @@ int main(int argc, char** argv)
     // Run the tests
     int status = RUN_ALL_TESTS();
 
+    rocblas_print_reference_cache_statistics();
+
     // Failures printed at end for reporting so repeat version info
     rocblas_print_version();
 
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_reference_cache.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef WIN32
+#include <stdlib.h>
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#endif
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#error no filesystem found
+#endif
+
+namespace
+{
+    template <typename...>
+    struct testing_rocblas_reference_cache : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const char* env      = getenv("ROCBLAS_CLIENT_REFERENCE_CACHE");
+            std::string previous = env ? env : "";
+            std::string tmp      = rocblas_tempname();
+            std::string dir      = tmp + "_cache";
+            setenv("ROCBLAS_CLIENT_REFERENCE_CACHE", dir.c_str(), true);
+            ASSERT_EQ(rocblas_reference_cache_dir(), dir);
+
+            const int64_t M = arg.M, N = M + 3;
+            int           calls = 0;
+            auto          stats = rocblas_reference_cache_statistics();
+
+            // Integer values, like most test data, which compress well
+            auto reference = [&](host_matrix<float>& hC) {
+                return [&] {
+                    calls++;
+                    for(size_t i = 0; i < hC.size(); i++)
+                        hC[i] = float(int64_t(i * 7 % 19) - 9);
+                };
+            };
+
+            // The first result is computed and stored, and is read back the second time
+            host_matrix<float> hC(M, N, M), hC_cached(M, N, M);
+            rocblas_reference_cached(arg, hC, reference(hC));
+            rocblas_reference_cached(arg, hC_cached, reference(hC_cached));
+            EXPECT_EQ(calls, 1);
+            EXPECT_EQ(memcmp(hC.data(), hC_cached.data(), sizeof(float) * M * N), 0);
+
+            auto now = rocblas_reference_cache_statistics();
+            EXPECT_EQ(now.hits - stats.hits, 1u);
+            EXPECT_EQ(now.misses - stats.misses, 1u);
+            EXPECT_EQ(now.bytes - stats.bytes, 2 * sizeof(float) * M * N);
+            EXPECT_LT(now.stored_bytes - stats.stored_bytes, now.bytes - stats.bytes);
+
+            // Any other Arguments is another result
+            Arguments arg_other = arg;
+            arg_other.alpha += 1;
+            rocblas_reference_cached(arg_other, hC_cached, reference(hC_cached));
+            EXPECT_EQ(calls, 2);
+
+            // Timing always computes the result
+            Arguments arg_timing = arg;
+            arg_timing.timing    = 1;
+            rocblas_reference_cached(arg_timing, hC_cached, reference(hC_cached));
+            EXPECT_EQ(calls, 3);
+
+            // Damaged results are computed again
+            for(const auto& entry : fs::directory_iterator(dir))
+                fs::resize_file(entry.path(), fs::file_size(entry.path()) - 1);
+            memset(hC_cached.data(), 0, sizeof(float) * M * N);
+            rocblas_reference_cached(arg, hC_cached, reference(hC_cached));
+            EXPECT_EQ(calls, 4);
+            EXPECT_EQ(memcmp(hC.data(), hC_cached.data(), sizeof(float) * M * N), 0);
+
+            // Batches of complex results, of values which do not compress
+            const int64_t                             batch_count = 3;
+            host_batch_matrix<rocblas_double_complex> hB(M, N, M, batch_count);
+            host_batch_matrix<rocblas_double_complex> hB_cached(M, N, M, batch_count);
+            auto batch_reference = [&](host_batch_matrix<rocblas_double_complex>& hX) {
+                return [&] {
+                    calls++;
+                    for(int64_t b = 0; b < batch_count; b++)
+                        for(size_t i = 0; i < hX.nmemb(); i++)
+                            hX[b][i] = {1.0 / (i + b + 1), -std::sqrt(double(i + 2 * b))};
+                };
+            };
+            rocblas_reference_cached(arg, hB, batch_reference(hB));
+            rocblas_reference_cached(arg, hB_cached, batch_reference(hB_cached));
+            EXPECT_EQ(calls, 5);
+            for(int64_t b = 0; b < batch_count; b++)
+                EXPECT_EQ(memcmp(hB[b], hB_cached[b], sizeof(rocblas_double_complex) * hB.nmemb()),
+                          0)
+                    << "batch " << b;
+
+            // Disabled, the cache is not used
+            setenv("ROCBLAS_CLIENT_REFERENCE_CACHE", "0", true);
+            EXPECT_EQ(rocblas_reference_cache_dir(), "");
+            rocblas_reference_cached(arg, hC_cached, reference(hC_cached));
+            EXPECT_EQ(calls, 6);
+
+            if(env)
+                setenv("ROCBLAS_CLIENT_REFERENCE_CACHE", previous.c_str(), true);
+            else
+                unsetenv("ROCBLAS_CLIENT_REFERENCE_CACHE");
+
+            std::error_code ec;
+            fs::remove_all(dir, ec);
+            fs::remove(tmp, ec);
+        }
+    };
+
+    struct rocblas_reference_cache_test
+        : RocBLAS_Test<rocblas_reference_cache_test, testing_rocblas_reference_cache>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "rocblas_reference_cache");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<rocblas_reference_cache_test>(arg.name);
+        }
+    };
+
+    TEST_P(rocblas_reference_cache_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_rocblas_reference_cache<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rocblas_reference_cache_test)
+
+} // namespace
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_shard.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+namespace
+{
+    // arg for function with matrices of size n
+    Arguments square(Arguments arg, const char* function, int64_t n, int64_t batch_count = 1)
+    {
+        strcpy(arg.function, function);
+        arg.M           = arg.N = arg.K = n;
+        arg.batch_count = batch_count;
+        return arg;
+    }
+
+    template <typename...>
+    struct testing_rocblas_shard : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            // Longest processing time first
+            EXPECT_EQ(rocblas_lpt_schedule({5, 4, 3, 3, 3}, 2),
+                      (std::vector<size_t>{0, 1, 1, 0, 1}));
+            EXPECT_EQ(rocblas_lpt_schedule({}, 3), std::vector<size_t>{});
+
+            // Every cost is assigned, and no shard exceeds the average by more than the
+            // largest cost
+            std::vector<double> costs;
+            for(size_t i = 0; i < 1000; i++)
+                costs.push_back(double(i * 7919 % 1009) * (i % 13 ? 1 : 100));
+            const size_t shards = 7;
+            auto         shard  = rocblas_lpt_schedule(costs, shards);
+            ASSERT_EQ(shard.size(), costs.size());
+            std::vector<double> loads(shards);
+            for(size_t i = 0; i < costs.size(); i++)
+            {
+                ASSERT_LT(shard[i], shards);
+                loads[shard[i]] += costs[i];
+            }
+            double total = std::accumulate(costs.begin(), costs.end(), 0.0);
+            double most  = *std::max_element(costs.begin(), costs.end());
+            for(double load : loads)
+                EXPECT_LE(load, total / shards + most);
+
+            // Estimates grow with the work, and the batches of batched functions
+            Arguments small   = square(arg, "gemm", 16);
+            Arguments large   = square(arg, "gemm", 1024);
+            Arguments batched = square(arg, "gemm_strided_batched", 1024, 10);
+
+            auto work_small   = rocblas_test_work_estimate(small);
+            auto work_large   = rocblas_test_work_estimate(large);
+            auto work_batched = rocblas_test_work_estimate(batched);
+            EXPECT_LT(work_small.gflops, work_large.gflops);
+            EXPECT_LT(work_small.gbytes, work_large.gbytes);
+            EXPECT_DOUBLE_EQ(work_batched.gflops, 10 * work_large.gflops);
+            EXPECT_LT(rocblas_test_model_seconds(work_small),
+                      rocblas_test_model_seconds(work_large));
+
+            // Functions without a model cost the time of a test without work
+            auto work_none = rocblas_test_work_estimate(square(arg, "gemv_bad_arg", 1024));
+            EXPECT_EQ(work_none.gflops, 0);
+            EXPECT_EQ(work_none.gbytes, 0);
+
+            // Functions in a timing log are scaled by their own times, and others by the times
+            // of all of the log
+            rocblas_test_cost_model model;
+            EXPECT_EQ(model(large), rocblas_test_model_seconds(work_large));
+            EXPECT_FALSE(model.learn(""));
+
+            Arguments   axpy    = square(arg, "axpy", 16);
+            double      seconds = 4 * rocblas_test_model_seconds(work_large);
+            std::string log     = rocblas_tempname();
+            {
+                std::ofstream out(log);
+                out << std::setprecision(17) << "gemm " << work_large.gflops << " "
+                    << work_large.gbytes << " " << seconds << "\n"
+                    << "malformed line\n";
+            }
+            ASSERT_TRUE(model.learn(log));
+            remove(log.c_str());
+
+            auto model_axpy = rocblas_test_model_seconds(rocblas_test_work_estimate(axpy));
+            EXPECT_NEAR(model(large), seconds, seconds * 1e-6);
+            EXPECT_NEAR(model(small), 4 * rocblas_test_model_seconds(work_small), seconds * 1e-6);
+            EXPECT_NEAR(model(axpy), 4 * model_axpy, model_axpy * 1e-6);
+        }
+    };
+
+    struct rocblas_shard_test : RocBLAS_Test<rocblas_shard_test, testing_rocblas_shard>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "rocblas_shard");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<rocblas_shard_test>(arg.name);
+        }
+    };
+
+    TEST_P(rocblas_shard_test, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_rocblas_shard<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(rocblas_shard_test)
+
+} // namespace
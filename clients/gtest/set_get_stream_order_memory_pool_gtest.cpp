@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_device_malloc.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <string>
+#include <vector>
+
+namespace
+{
+#if HIP_VERSION >= 50300000
+    // Highest amount of memory allocated from the pool since it was last reset
+    uint64_t used_mem_high(hipMemPool_t pool)
+    {
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        uint64_t used = 0;
+        CHECK_HIP_ERROR(hipMemPoolGetAttribute(pool, hipMemPoolAttrUsedMemHigh, &used));
+        return used;
+    }
+
+    void reset_used_mem_high(hipMemPool_t pool)
+    {
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        uint64_t used = 0;
+        CHECK_HIP_ERROR(hipMemPoolSetAttribute(pool, hipMemPoolAttrUsedMemHigh, &used));
+    }
+#endif
+
+    template <typename...>
+    struct testing_set_get_stream_order_memory_pool : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+            int device;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+
+            int pools_supported = 0;
+            CHECK_HIP_ERROR(hipDeviceGetAttribute(
+                &pools_supported, hipDeviceAttributeMemoryPoolsSupported, device));
+            if(!pools_supported)
+                return;
+
+            hipMemPoolProps props = {};
+            props.allocType       = hipMemAllocationTypePinned;
+            props.location.type   = hipMemLocationTypeDevice;
+            props.location.id     = device;
+
+            hipMemPool_t pool;
+            CHECK_HIP_ERROR(hipMemPoolCreate(&pool, &props));
+
+            // Keep released memory cached in the pool between calls
+            uint64_t threshold = UINT64_MAX;
+            CHECK_HIP_ERROR(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold));
+
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            // Make sure the default pool is the device's default memory pool
+            hipMemPool_t handle_pool = pool;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream_order_memory_pool(handle, &handle_pool));
+            EXPECT_EQ(nullptr, handle_pool);
+
+            // Make sure set()/get() functions work
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, pool));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream_order_memory_pool(handle, &handle_pool));
+            EXPECT_EQ(pool, handle_pool);
+
+            // Make sure a function requiring workspace allocates it from the pool
+            rocblas_int          N = arg.N;
+            host_vector<float>   hx(N, 1);
+            device_vector<float> dx(N, 1);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            for(rocblas_int i = 0; i < N; i++)
+                hx[i] = 1.0f;
+            CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+            float result = 0;
+            for(int iter = 0; iter < 2; iter++)
+            {
+                reset_used_mem_high(pool);
+                CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, &result));
+                EXPECT_FLOAT_EQ(std::sqrt(float(N)), result);
+                EXPECT_GT(used_mem_high(pool), 0u);
+            }
+
+            // Make sure a function called while workspace is held allocates its workspace
+            // outside of the held memory when the arena is exhausted, and that the arena
+            // reserved by the next call grows to the combined size.
+            // Setting the pool again forgets the size of the arena learned from earlier calls.
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, pool));
+            constexpr size_t held_size = 16 << 20;
+            {
+                rocblas_device_malloc held(handle, held_size);
+                ASSERT_TRUE(held);
+                void* held_ptr = static_cast<void*>(held);
+                CHECK_HIP_ERROR(hipMemset(held_ptr, 0x5a, held_size));
+
+                CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, &result));
+                EXPECT_FLOAT_EQ(std::sqrt(float(N)), result);
+
+                std::vector<unsigned char> h_held(held_size);
+                CHECK_HIP_ERROR(
+                    hipMemcpy(h_held.data(), held_ptr, held_size, hipMemcpyDeviceToHost));
+                size_t overwritten = 0;
+                for(size_t i = 0; i < held_size; i++)
+                    overwritten += h_held[i] != 0x5a;
+                EXPECT_EQ(overwritten, size_t(0));
+            }
+
+            reset_used_mem_high(pool);
+            CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, &result));
+            EXPECT_FLOAT_EQ(std::sqrt(float(N)), result);
+            EXPECT_GT(used_mem_high(pool), held_size);
+
+            // Make sure switching back to the device's default memory pool leaves the pool unused
+            CHECK_ROCBLAS_ERROR(rocblas_set_stream_order_memory_pool(handle, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream_order_memory_pool(handle, &handle_pool));
+            EXPECT_EQ(nullptr, handle_pool);
+
+            reset_used_mem_high(pool);
+            CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, &result));
+            EXPECT_FLOAT_EQ(std::sqrt(float(N)), result);
+            EXPECT_EQ(used_mem_high(pool), 0u);
+
+            // Make sure a pool on another device is rejected
+            int device_count;
+            CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+            if(device_count > 1)
+            {
+                int other_device = (device + 1) % device_count;
+                CHECK_HIP_ERROR(hipDeviceGetAttribute(
+                    &pools_supported, hipDeviceAttributeMemoryPoolsSupported, other_device));
+                if(pools_supported)
+                {
+                    props.location.id = other_device;
+                    hipMemPool_t other_pool;
+                    CHECK_HIP_ERROR(hipMemPoolCreate(&other_pool, &props));
+                    EXPECT_ROCBLAS_STATUS(rocblas_set_stream_order_memory_pool(handle, other_pool),
+                                          rocblas_status_invalid_value);
+                    CHECK_HIP_ERROR(hipMemPoolDestroy(other_pool));
+                }
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+            CHECK_HIP_ERROR(hipMemPoolDestroy(pool));
+#endif
+        }
+    };
+
+    struct set_get_stream_order_memory_pool
+        : RocBLAS_Test<set_get_stream_order_memory_pool, testing_set_get_stream_order_memory_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "set_get_stream_order_memory_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<set_get_stream_order_memory_pool>(arg.name);
+        }
+    };
+
+    TEST_P(set_get_stream_order_memory_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            testing_set_get_stream_order_memory_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_get_stream_order_memory_pool)
+
+} // namespace
@@ -0,0 +1,140 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cstdlib>
+#include <string>
+
+#ifdef WIN32
+#include <stdlib.h>
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#endif
+
+namespace
+{
+    // The filter must be set before Tensile is initialized, so the test runs in a child process
+    constexpr char filter_var[] = "ROCBLAS_TENSILE_LOAD_FILTER";
+    constexpr char filter[]     = "SSS_NN";
+
+    template <typename T>
+    rocblas_status gemm(rocblas_handle handle, rocblas_operation trans_a, rocblas_int N)
+    {
+        T                alpha = 1, beta = 0;
+        host_vector<T>   hA(N * N);
+        device_vector<T> dA(N * N), dB(N * N), dC(N * N);
+        if(!dA.memcheck() || !dB.memcheck() || !dC.memcheck())
+            return rocblas_status_memory_error;
+        for(auto& a : hA)
+            a = 1;
+        if(dA.transfer_from(hA) != hipSuccess || dB.transfer_from(hA) != hipSuccess)
+            return rocblas_status_internal_error;
+        return rocblas_gemm<T>(handle,
+                               trans_a,
+                               rocblas_operation_none,
+                               N,
+                               N,
+                               N,
+                               &alpha,
+                               dA,
+                               N,
+                               dB,
+                               N,
+                               &beta,
+                               dC,
+                               N);
+    }
+
+    template <typename...>
+    struct testing_tensile_load_filter : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            const char* env = getenv(filter_var);
+            if(!env)
+            {
+                setenv(filter_var, filter, true);
+                std::string command = "\"" + rocblas_exepath()
+                                      + "rocblas-test\" --gtest_filter=*tensile_load_filter.*";
+                int status = system(command.c_str());
+                unsetenv(filter_var);
+                EXPECT_EQ(status, 0);
+                return;
+            }
+
+            // A filter set outside the test may not list the types used below
+            if(strcmp(env, filter))
+                return;
+
+            rocblas_local_handle handle{arg};
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            // The listed type and transposes are solved, the others are rejected
+            EXPECT_ROCBLAS_STATUS(gemm<float>(handle, rocblas_operation_none, arg.N),
+                                  rocblas_status_success);
+            EXPECT_ROCBLAS_STATUS(gemm<float>(handle, rocblas_operation_transpose, arg.N),
+                                  rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(gemm<double>(handle, rocblas_operation_none, arg.N),
+                                  rocblas_status_not_implemented);
+
+            // The master library and the lazily loaded files of the listed type are counted
+            rocblas_tensile_load_stats stats;
+            CHECK_ROCBLAS_ERROR(rocblas_get_tensile_load_stats(&stats));
+            EXPECT_GT(stats.files_loaded, 0);
+            EXPECT_GT(stats.bytes_loaded, 0);
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_tensile_load_filter(nullptr),
+                                  rocblas_status_invalid_value);
+        }
+    };
+
+    struct tensile_load_filter : RocBLAS_Test<tensile_load_filter, testing_tensile_load_filter>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "tensile_load_filter");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<tensile_load_filter>(arg.name);
+        }
+    };
+
+    TEST_P(tensile_load_filter, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_tensile_load_filter<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(tensile_load_filter)
+
+} // namespace
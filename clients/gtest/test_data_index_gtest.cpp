@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using file_t = RocBLAS_TestData_File;
+
+    // Function selected by suite_filter, standing for the function_filter of a suite
+    std::string suite_function;
+
+    bool suite_filter(const Arguments& arg)
+    {
+        return arg.function == suite_function;
+    }
+
+    // Write a data file of records whose function is f<i % functions> and whose M is i, in
+    // the format of rocblas_gentest.py, optionally without the index or with a bad footer
+    void write_data(const std::string& file,
+                    size_t             records,
+                    size_t             functions,
+                    bool               index   = true,
+                    bool               corrupt = false)
+    {
+        // The signature checked by Arguments::validate
+        Arguments signature;
+        memset(&signature, 0, sizeof(signature));
+        auto sign = [sig = 0u](auto& value) mutable {
+            for(size_t i = 0; i < sizeof(value); ++i)
+                reinterpret_cast<unsigned char*>(&value)[i] = sig ^ i;
+            sig = (sig + 89) % 256;
+        };
+#define SIGN_FUNC(NAME) sign(signature.NAME)
+        FOR_EACH_ARGUMENT(SIGN_FUNC, ;);
+#undef SIGN_FUNC
+
+        FILE* f = fopen(file.c_str(), "wb");
+        ASSERT_NE(f, nullptr);
+        fwrite("rocBLAS", 8, 1, f);
+        fwrite(&signature, sizeof(signature), 1, f);
+        fwrite("ROCblas", 8, 1, f);
+
+        std::vector<std::vector<uint64_t>> numbers(functions);
+        for(size_t i = 0; i < records; ++i)
+        {
+            Arguments arg{};
+            arg.init();
+            snprintf(arg.function, sizeof(arg.function), "f%zu", i % functions);
+            snprintf(arg.category, sizeof(arg.category), "quick");
+            arg.M = i;
+            fwrite(&arg, sizeof(arg), 1, f);
+            numbers[i % functions].push_back(i);
+        }
+
+        if(index)
+        {
+            uint64_t count = functions, first = 0;
+            fwrite(&count, sizeof(count), 1, f);
+            for(size_t j = 0; j < functions; ++j)
+            {
+                file_t::index_function entry{};
+                snprintf(entry.function, sizeof(entry.function), "f%zu", j);
+                entry.first = first;
+                entry.count = numbers[j].size();
+                first += entry.count;
+                fwrite(&entry, sizeof(entry), 1, f);
+            }
+            for(auto& n : numbers)
+                fwrite(n.data(), sizeof(uint64_t), n.size(), f);
+
+            file_t::index_footer footer{file_t::signature_size + records * sizeof(Arguments),
+                                        {'R', 'B', 'T', 'D', 'I', 'D', 'X', '\0'}};
+            if(corrupt)
+                footer.offset += 8;
+            fwrite(&footer, sizeof(footer), 1, f);
+        }
+        fclose(f);
+    }
+
+    // Records of the suite of function f<j>, with the records of all suites or only those of
+    // the functions accepted by suite_filter, as before and after the index
+    std::vector<int64_t> discover(const file_t& file, size_t j, bool use_index)
+    {
+        suite_function = "f" + std::to_string(j);
+
+        std::vector<int64_t> found;
+        for(size_t i : file.select(use_index ? suite_filter : nullptr))
+        {
+            Arguments arg = file[i];
+            if(arg.validate() && match_test_category(arg, "_") && suite_filter(arg))
+                found.push_back(arg.M);
+        }
+        return found;
+    }
+
+    template <typename...>
+    struct testing_test_data_index : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            std::string file      = rocblas_tempname();
+            size_t      records   = arg.M;
+            size_t      functions = arg.N;
+
+            std::vector<size_t> all(records);
+            std::iota(all.begin(), all.end(), 0);
+
+            // The records of a function are found in file order, with or without an index
+            for(bool index : {true, false})
+            {
+                write_data(file, records, functions, index);
+                file_t data(file);
+                ASSERT_EQ(data.indexed(), index);
+                ASSERT_EQ(data.size(), records);
+                EXPECT_EQ(data.select(), all);
+
+                for(size_t j = 0; j < functions; ++j)
+                {
+                    std::vector<int64_t> expected;
+                    for(size_t i = j; i < records; i += functions)
+                        expected.push_back(i);
+                    EXPECT_EQ(discover(data, j, true), expected);
+                    EXPECT_EQ(discover(data, j, false), expected);
+                }
+
+                suite_function = "missing";
+                EXPECT_TRUE(data.select(suite_filter).empty());
+            }
+
+            // An index which does not match the records is ignored
+            write_data(file, records, functions, true, true);
+            {
+                file_t data(file);
+                EXPECT_FALSE(data.indexed());
+                EXPECT_EQ(data.select(), all);
+            }
+
+            // Time the discovery of one suite per function, as gtest instantiates them
+            write_data(file, records, functions);
+            {
+                file_t data(file);
+                double scan_us = get_time_us_no_sync();
+                for(size_t j = 0; j < functions; ++j)
+                    discover(data, j, false);
+                scan_us = get_time_us_no_sync() - scan_us;
+
+                double index_us = get_time_us_no_sync();
+                for(size_t j = 0; j < functions; ++j)
+                    discover(data, j, true);
+                index_us = get_time_us_no_sync() - index_us;
+
+                rocblas_cout << "Discovery of " << functions << " suites in " << records
+                             << " records: " << scan_us << " us scanning, " << index_us
+                             << " us with the index" << std::endl;
+            }
+
+            remove(file.c_str());
+        }
+    };
+
+    struct test_data_index : RocBLAS_Test<test_data_index, testing_test_data_index>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "test_data_index");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<test_data_index>(arg.name);
+        }
+    };
+
+    TEST_P(test_data_index, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_test_data_index<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(test_data_index)
+
+} // namespace
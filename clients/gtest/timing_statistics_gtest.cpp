@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_test.hpp"
+#include "timing_statistics.hpp"
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename...>
+    struct testing_timing_statistics : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            // No samples
+            {
+                auto stats = rocblas_timing_summarize({});
+                EXPECT_EQ(stats.samples, 0);
+                EXPECT_EQ(stats.mean, 0);
+                EXPECT_EQ(stats.ci_relative_half_width(), 0);
+                EXPECT_EQ(rocblas_timing_percentile({}, 0.5), 0);
+            }
+
+            // A single sample has no spread
+            {
+                auto stats = rocblas_timing_summarize({3.0});
+                EXPECT_EQ(stats.samples, 1);
+                EXPECT_EQ(stats.min, 3.0);
+                EXPECT_EQ(stats.median, 3.0);
+                EXPECT_EQ(stats.p99, 3.0);
+                EXPECT_EQ(stats.max, 3.0);
+                EXPECT_EQ(stats.stddev, 0);
+                EXPECT_EQ(stats.ci_low, 3.0);
+                EXPECT_EQ(stats.ci_high, 3.0);
+            }
+
+            // Percentiles are interpolated between closest ranks
+            {
+                std::vector<double> sorted{1, 2, 3, 4};
+                EXPECT_DOUBLE_EQ(rocblas_timing_percentile(sorted, 0), 1);
+                EXPECT_DOUBLE_EQ(rocblas_timing_percentile(sorted, 0.5), 2.5);
+                EXPECT_DOUBLE_EQ(rocblas_timing_percentile(sorted, 1), 4);
+                EXPECT_DOUBLE_EQ(rocblas_timing_percentile(sorted, 2), 4);
+                EXPECT_DOUBLE_EQ(rocblas_timing_percentile(sorted, -1), 1);
+            }
+
+            // 1..100 in reverse order
+            std::vector<double> samples(100);
+            std::iota(samples.rbegin(), samples.rend(), 1.0);
+            {
+                auto stats = rocblas_timing_summarize(samples);
+                EXPECT_EQ(stats.samples, 100);
+                EXPECT_DOUBLE_EQ(stats.min, 1);
+                EXPECT_DOUBLE_EQ(stats.max, 100);
+                EXPECT_DOUBLE_EQ(stats.median, 50.5);
+                EXPECT_DOUBLE_EQ(stats.p90, 90.1);
+                EXPECT_DOUBLE_EQ(stats.p99, 99.01);
+                EXPECT_DOUBLE_EQ(stats.mean, 50.5);
+                EXPECT_NEAR(stats.stddev, std::sqrt(100 * 101 / 12.0), 1e-9);
+
+                // The mean's standard error is about 2.9, so a 95% interval is about +-5.7
+                EXPECT_LT(stats.ci_low, stats.mean);
+                EXPECT_GT(stats.ci_high, stats.mean);
+                EXPECT_NEAR(stats.ci_high - stats.ci_low, 2 * 1.96 * stats.stddev / 10, 2.0);
+
+                // The interval is reproducible, and narrower at a lower confidence
+                auto again = rocblas_timing_summarize(samples);
+                EXPECT_EQ(again.ci_low, stats.ci_low);
+                EXPECT_EQ(again.ci_high, stats.ci_high);
+
+                auto lower = rocblas_timing_summarize(samples, 0.5);
+                EXPECT_LT(lower.ci_high - lower.ci_low, stats.ci_high - stats.ci_low);
+            }
+
+            // Constant samples give an empty interval
+            {
+                auto stats = rocblas_timing_summarize(std::vector<double>(50, 7.0));
+                EXPECT_EQ(stats.stddev, 0);
+                EXPECT_EQ(stats.ci_low, 7.0);
+                EXPECT_EQ(stats.ci_high, 7.0);
+                EXPECT_EQ(stats.ci_relative_half_width(), 0);
+            }
+
+            // The relative interval width shrinks with the number of samples,
+            // which is what ends an adaptive --timing_ci run
+            {
+                std::mt19937_64     rng(arg.M);
+                std::vector<double> noisy;
+                double              previous = INFINITY;
+                for(size_t n : {16, 256, 4096})
+                {
+                    while(noisy.size() < n)
+                        noisy.push_back(100.0 + (rng() % 1000) / 100.0);
+                    double width = rocblas_timing_summarize(noisy).ci_relative_half_width();
+                    EXPECT_LT(width, previous);
+                    previous = width;
+                }
+                EXPECT_LT(previous, 0.01);
+            }
+
+            // Results are handed from the hot loop to the logger once
+            {
+                rocblas_timing_statistics stats;
+                rocblas_iteration_timing_clear_result();
+                EXPECT_FALSE(rocblas_iteration_timing_take_result(stats));
+                rocblas_iteration_timing_set_result(rocblas_timing_summarize(samples));
+                EXPECT_TRUE(rocblas_iteration_timing_take_result(stats));
+                EXPECT_EQ(stats.samples, 100);
+                EXPECT_FALSE(rocblas_iteration_timing_take_result(stats));
+            }
+        }
+    };
+
+    struct timing_statistics : RocBLAS_Test<timing_statistics, testing_timing_statistics>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "timing_statistics");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<timing_statistics>(arg.name);
+        }
+    };
+
+    TEST_P(timing_statistics, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_timing_statistics<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(timing_statistics)
+
+} // namespace
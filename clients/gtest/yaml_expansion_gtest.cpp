@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_gentest.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    // Tests expanded by rocblas_gentest, with the rocblas_common.yaml staged with the clients
+    const char yaml_tests[] = R"(---
+include: rocblas_common.yaml
+
+Known bugs:
+  - { function: yaml_expansion_b, M: 2 }
+  - { function: "yaml_expansion_[b]", M: 3, known_bug_platforms: "gfx90a, gfx90a" }
+
+Tests:
+- name: expansion
+  category: quick
+  function: [ yaml_expansion_a, yaml_expansion_b ]
+  precision: *single_precision
+  transA_transB: [ { transA: N, transB: T } ]
+  M: 1..4
+  N: [ 8, 8 ]
+  K: 0x10
+  batch_count: 2
+...
+)";
+
+    void write_yaml(const std::string& file, const char* text)
+    {
+        std::ofstream(file) << text;
+    }
+
+    template <typename...>
+    struct testing_yaml_expansion : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            std::string yaml = rocblas_tempname();
+            std::string data = rocblas_tempname();
+            std::string dir  = rocblas_exepath();
+
+            write_yaml(yaml, yaml_tests);
+            ASSERT_NO_THROW(rocblas_gentest(yaml, data, {dir}, dir + "rocblas_template.yaml"));
+
+            {
+                RocBLAS_TestData_File file(data);
+                EXPECT_TRUE(file.indexed());
+
+                // M is expanded outside function, and the duplicate N adds no records
+                ASSERT_EQ(file.size(), 8u);
+                for(size_t i = 0; i < file.size(); ++i)
+                {
+                    Arguments arg = file[i];
+                    int64_t   M   = 1 + i / 2;
+                    bool      b   = i % 2;
+                    EXPECT_TRUE(arg.validate());
+                    EXPECT_STREQ(arg.function, b ? "yaml_expansion_b" : "yaml_expansion_a");
+                    EXPECT_EQ(arg.a_type, rocblas_datatype_f32_r);
+                    EXPECT_EQ(arg.M, M);
+                    EXPECT_EQ(arg.N, 8);
+                    EXPECT_EQ(arg.K, 16);
+                    EXPECT_EQ(arg.transA, 'N');
+                    EXPECT_EQ(arg.transB, 'T');
+
+                    // Leading dimensions and strides take the gemm defaults
+                    EXPECT_EQ(arg.lda, M);
+                    EXPECT_EQ(arg.ldb, 8);
+                    EXPECT_EQ(arg.stride_a, M * 16);
+                    EXPECT_EQ(arg.stride_c, M * 8);
+
+                    EXPECT_STREQ(arg.category, b && M == 2 ? "known_bug" : "quick");
+                    EXPECT_STREQ(arg.known_bug_platforms, b && M == 3 ? "gfx90a" : "");
+                }
+            }
+
+            // A cached expansion is reused until an included file changes
+            {
+                std::string cache    = data + ".cache";
+                std::string included = yaml + ".included.yaml";
+                std::string tmpl     = dir + "rocblas_template.yaml";
+                write_yaml(included, yaml_tests);
+                write_yaml(yaml, ("include: " + fs::path(included).filename().string()).c_str());
+
+                auto first = rocblas_gentest_cached(yaml, cache, {dir}, tmpl);
+                ASSERT_NE(first, "");
+                EXPECT_EQ(rocblas_gentest_cached(yaml, cache, {dir}, tmpl), first);
+                {
+                    std::ifstream expected(data, std::ios::binary), cached(first, std::ios::binary);
+                    EXPECT_TRUE(std::equal(std::istreambuf_iterator<char>(expected),
+                                           std::istreambuf_iterator<char>(),
+                                           std::istreambuf_iterator<char>(cached),
+                                           std::istreambuf_iterator<char>()));
+                }
+
+                std::ofstream(included, std::ios::app) << "# changed\n";
+                auto second = rocblas_gentest_cached(yaml, cache, {dir}, tmpl);
+                EXPECT_NE(second, "");
+                EXPECT_NE(second, first);
+
+                fs::remove_all(cache);
+                remove(included.c_str());
+            }
+
+            // Errors are diagnosed with the location in the YAML file
+            write_yaml(yaml, "Tests:\n- { M: *undefined }\n");
+            EXPECT_THROW(rocblas_gentest(yaml, data), std::runtime_error);
+            write_yaml(yaml, "include: missing.yaml\n");
+            EXPECT_THROW(rocblas_gentest(yaml, data), std::runtime_error);
+
+            remove(yaml.c_str());
+            remove(data.c_str());
+        }
+    };
+
+    struct yaml_expansion : RocBLAS_Test<yaml_expansion, testing_yaml_expansion>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "yaml_expansion");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<yaml_expansion>(arg.name);
+        }
+    };
+
+    TEST_P(yaml_expansion, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_yaml_expansion<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(yaml_expansion)
+
+} // namespace
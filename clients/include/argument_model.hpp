@@ -22,7 +22,12 @@
 
 #pragma once
 
+#include "bench_output.hpp"
+#include "graph_timing.hpp"
+#include "launch_breakdown.hpp"
 #include "rocblas_arguments.hpp"
+#include "rotating_buffer.hpp"
+#include "timing_statistics.hpp"
 
 namespace ArgumentLogging
 {
@@ -35,6 +40,9 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+void                         ArgumentModel_set_output_format(rocblas_client_output_format fmt);
+rocblas_client_output_format ArgumentModel_get_output_format();
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -51,6 +59,96 @@ class ArgumentModel
     }
 
 public:
+    // Structured record of all Arguments fields and the results, see bench_output.hpp
+    void log_record(rocblas_internal_ostream& str,
+                    const Arguments&          arg,
+                    double                    gpu_us,
+                    double                    gflops,
+                    double                    gbytes,
+                    double                    cpu_us,
+                    double                    norm1,
+                    double                    norm2,
+                    double                    norm3,
+                    double                    norm4)
+    {
+        constexpr bool has_batch_count = has(e_batch_count);
+        rocblas_int    batch_count     = has_batch_count ? arg.batch_count : 1;
+        rocblas_int    hot_calls       = arg.iters < 1 ? 1 : arg.iters;
+        const double   NA              = ArgumentLogging::NA_value;
+
+        rocblas_timing_statistics stats;
+        bool                      has_stats = rocblas_iteration_timing_take_result(stats);
+
+        rocblas_bench_result result{};
+        result.gpu_us       = NA;
+        result.gflops       = NA;
+        result.gbytes_per_s = NA;
+        result.cpu_us       = NA;
+        result.cpu_gflops   = NA;
+        if(arg.timing)
+        {
+            result.gpu_us = gpu_us / hot_calls;
+            result.cpu_us = cpu_us;
+            if(gflops != NA)
+                result.gflops = gflops * batch_count / result.gpu_us * 1e6;
+            if(gbytes != NA)
+                result.gbytes_per_s = gbytes * batch_count / result.gpu_us * 1e6;
+            if(gflops != NA && cpu_us != NA)
+                result.cpu_gflops = gflops * batch_count / cpu_us * 1e6;
+        }
+        result.norm_error[0] = arg.norm_check ? norm1 : NA;
+        result.norm_error[1] = arg.norm_check ? norm2 : NA;
+        result.norm_error[2] = arg.norm_check ? norm3 : NA;
+        result.norm_error[3] = arg.norm_check ? norm4 : NA;
+        result.timing        = has_stats ? &stats : nullptr;
+
+        rocblas_rotating_buffer_result rotating;
+        result.hot_us           = NA;
+        result.hot_gflops       = NA;
+        result.hot_gbytes_per_s = NA;
+        if(rocblas_rotating_buffer_take_result(rotating) && arg.timing)
+        {
+            result.rotating_copies = rotating.copies;
+            result.hot_us          = rotating.hot_us / hot_calls;
+            if(gflops != NA)
+                result.hot_gflops = gflops * batch_count / result.hot_us * 1e6;
+            if(gbytes != NA)
+                result.hot_gbytes_per_s = gbytes * batch_count / result.hot_us * 1e6;
+        }
+
+        rocblas_graph_timing_result graph;
+        result.graph_us           = NA;
+        result.graph_gflops       = NA;
+        result.graph_gbytes_per_s = NA;
+        result.graph_launch_us    = NA;
+        if(rocblas_graph_timing_take_result(graph) && arg.timing)
+        {
+            result.graph_us        = graph.replay_us / hot_calls;
+            result.graph_launch_us = graph.launch_us;
+            if(gflops != NA)
+                result.graph_gflops = gflops * batch_count / result.graph_us * 1e6;
+            if(gbytes != NA)
+                result.graph_gbytes_per_s = gbytes * batch_count / result.graph_us * 1e6;
+        }
+
+        rocblas_launch_breakdown_result breakdown;
+        result.breakdown_host_us    = NA;
+        result.breakdown_queue_us   = NA;
+        result.breakdown_device_us  = NA;
+        result.breakdown_host_share = NA;
+        if(rocblas_launch_breakdown_take_result(breakdown) && arg.timing)
+        {
+            result.breakdown_calls            = breakdown.calls;
+            result.breakdown_host_us          = breakdown.host_us;
+            result.breakdown_queue_us         = breakdown.kernel_events ? breakdown.queue_us : NA;
+            result.breakdown_device_us        = breakdown.device_us;
+            result.breakdown_host_share       = breakdown.host_share;
+            result.breakdown_host_bound_calls = breakdown.host_bound_calls;
+        }
+
+        rocblas_bench_write_record(str, ArgumentModel_get_output_format(), arg, result);
+    }
+
     void log_perf(rocblas_internal_ostream& name_line,
                   rocblas_internal_ostream& val_line,
                   const Arguments&          arg,
@@ -92,6 +190,69 @@ public:
         name_line << ",us";
         val_line << ", " << gpu_us;
 
+        // distribution of per-iteration times from rocblas_time_hot_calls
+        rocblas_timing_statistics stats;
+        if(rocblas_iteration_timing_take_result(stats))
+        {
+            name_line << ",us_min,us_median,us_p90,us_p99,us_max,us_stddev,us_ci_low,us_ci_high,"
+                         "samples";
+            val_line << ", " << stats.min << ", " << stats.median << ", " << stats.p90 << ", "
+                     << stats.p99 << ", " << stats.max << ", " << stats.stddev << ", "
+                     << stats.ci_low << ", " << stats.ci_high << ", " << stats.samples;
+        }
+
+        // hot-cache time measured alongside rotating-buffer timing, which is reported as us
+        rocblas_rotating_buffer_result rotating;
+        if(rocblas_rotating_buffer_take_result(rotating))
+        {
+            double hot_us = rotating.hot_us / hot_calls;
+            if(gflops != ArgumentLogging::NA_value)
+            {
+                name_line << ",hot-Gflops";
+                val_line << ", " << gflops * batch_count / hot_us * 1e6;
+            }
+            if(gbytes != ArgumentLogging::NA_value)
+            {
+                name_line << ",hot-GB/s";
+                val_line << ", " << gbytes * batch_count / hot_us * 1e6;
+            }
+            name_line << ",hot_us,rotating_copies";
+            val_line << ", " << hot_us << ", " << rotating.copies;
+        }
+
+        // the same calls replayed from a graph, without the host API and launch overhead of
+        // each call; the overhead is the share of us which the replay saves
+        rocblas_graph_timing_result graph;
+        if(rocblas_graph_timing_take_result(graph))
+        {
+            double graph_us = graph.replay_us / hot_calls;
+            if(gflops != ArgumentLogging::NA_value)
+            {
+                name_line << ",graph-Gflops";
+                val_line << ", " << gflops * batch_count / graph_us * 1e6;
+            }
+            if(gbytes != ArgumentLogging::NA_value)
+            {
+                name_line << ",graph-GB/s";
+                val_line << ", " << gbytes * batch_count / graph_us * 1e6;
+            }
+            name_line << ",graph_us,graph_launch_us,launch_overhead_%";
+            val_line << ", " << graph_us << ", " << graph.launch_us << ", "
+                     << (gpu_us > graph_us ? (gpu_us - graph_us) / gpu_us * 100 : 0);
+        }
+
+        // the calls timed one at a time, split into host API time, queueing delay and device
+        // time; host_bound_calls counts the calls whose host share is above the threshold
+        rocblas_launch_breakdown_result breakdown;
+        if(rocblas_launch_breakdown_take_result(breakdown))
+        {
+            name_line << ",host_us,queue_us,device_us,host_share_%,host_bound_calls";
+            val_line << ", " << breakdown.host_us << ", "
+                     << (breakdown.kernel_events ? breakdown.queue_us : ArgumentLogging::NA_value)
+                     << ", " << breakdown.device_us << ", " << breakdown.host_share * 100 << ", "
+                     << breakdown.host_bound_calls << "/" << breakdown.calls;
+        }
+
         if(arg.unit_check || arg.norm_check)
         {
             if(cpu_us != ArgumentLogging::NA_value)
@@ -147,6 +308,10 @@ public:
         if(arg.iters < 1)
             return; // warmup test only
 
+        if(ArgumentModel_get_output_format() != rocblas_client_output_format::table)
+            return log_record(
+                str, arg, gpu_us, gflops, gpu_bytes, cpu_us, norm1, norm2, norm3, norm4);
+
         rocblas_internal_ostream name_list;
         rocblas_internal_ostream value_list;
         value_list.set_csv(true);
@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "timing_statistics.hpp"
+#include <string>
+
+/*!\file
+ * \brief Structured JSON and CSV records of rocblas-bench results
+ *
+ * The layout of the records is described by rocblas_bench_schema.json, which must be
+ * updated together with rocblas_bench_schema_version whenever fields are added, removed
+ * or change meaning.
+ */
+
+constexpr int rocblas_bench_schema_version = 6;
+
+enum class rocblas_client_output_format
+{
+    table, // human-oriented name and value lines
+    json, // one JSON object per line
+    csv, // one header line, then one line per result
+};
+
+/*! \brief Parse "table", "json" or "csv", returning false for other values */
+bool rocblas_client_output_format_parse(const std::string& str, rocblas_client_output_format& fmt);
+
+/*! \brief Results of one benchmark, with ArgumentLogging::NA_value for fields not measured */
+struct rocblas_bench_result
+{
+    double gpu_us; // per call
+    double gflops;
+    double gbytes_per_s;
+    double cpu_us;
+    double cpu_gflops;
+    double norm_error[4];
+
+    // per-iteration time distribution, or nullptr
+    const rocblas_timing_statistics* timing;
+
+    // hot-cache results of rotating-buffer timing, with rotating_copies 0 when not used
+    size_t rotating_copies;
+    double hot_us;
+    double hot_gflops;
+    double hot_gbytes_per_s;
+
+    // graph replay results, with NA_value when not used
+    double graph_us;
+    double graph_gflops;
+    double graph_gbytes_per_s;
+    double graph_launch_us;
+
+    // launch breakdown results, with breakdown_calls 0 when not used
+    size_t breakdown_calls;
+    double breakdown_host_us;
+    double breakdown_queue_us;
+    double breakdown_device_us;
+    double breakdown_host_share;
+    size_t breakdown_host_bound_calls;
+};
+
+/*! \brief Write one record of arg and result in the given structured format */
+void rocblas_bench_write_record(rocblas_internal_ostream&    os,
+                                rocblas_client_output_format fmt,
+                                const Arguments&             arg,
+                                const rocblas_bench_result&  result);
+
+/*! \brief Per-thread location for rocblas_set_solution_index_query, read when a record is written */
+rocblas_int* rocblas_bench_solution_index_slot();
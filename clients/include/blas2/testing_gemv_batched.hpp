@@ -26,6 +26,7 @@
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
 #include "rocblas_datatype2string.hpp"
@@ -436,11 +437,10 @@ void testing_gemv_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; ++b)
-        {
+        cblas_batched(batch_count, gemv_gflop_count<Tex>(transA, M, N), [&](int64_t b) {
             cblas_gemv<Ti, To>(
                 transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.pointer_mode_host)
@@ -466,7 +466,6 @@ void testing_gemv_batched(const Arguments& arg)
     if(arg.timing)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
@@ -487,28 +486,31 @@ void testing_gemv_batched(const Arguments& arg)
                                     batch_count);
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg, (dA.nmemb() + dx.nmemb()) * sizeof(Ti) + dy.nmemb() * sizeof(To));
+        rocblas_rotating_batch_copies<Ti> dA_copies(dA, copies);
+        rocblas_rotating_batch_copies<Ti> dx_copies(dx, copies);
+        rocblas_rotating_batch_copies<To> dy_copies(dy, copies);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dx_copies.init());
+        CHECK_HIP_ERROR(dy_copies.init());
+
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
             rocblas_gemv_batched_fn(handle,
                                     transA,
                                     M,
                                     N,
                                     &h_alpha,
-                                    dA.ptr_on_device(),
+                                    dA_copies[c],
                                     lda,
-                                    dx.ptr_on_device(),
+                                    dx_copies[c],
                                     incx,
                                     &h_beta,
-                                    dy.ptr_on_device(),
+                                    dy_copies[c],
                                     incy,
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA, e_M, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}
             .log_args<Tex>(rocblas_cout,
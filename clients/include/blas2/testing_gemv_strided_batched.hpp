@@ -26,6 +26,7 @@
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
 #include "rocblas_datatype2string.hpp"
@@ -491,11 +492,10 @@ void testing_gemv_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; ++b)
-        {
+        cblas_batched(batch_count, gemv_gflop_count<Tex>(transA, M, N), [&](int64_t b) {
             cblas_gemv<Ti, To>(
                 transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_gold[b], incy);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.pointer_mode_host)
@@ -521,7 +521,6 @@ void testing_gemv_strided_batched(const Arguments& arg)
     if(arg.timing)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
@@ -545,31 +544,34 @@ void testing_gemv_strided_batched(const Arguments& arg)
                                             batch_count);
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg, (dA.nmemb() + dx.nmemb()) * sizeof(Ti) + dy.nmemb() * sizeof(To));
+        rocblas_rotating_copies<Ti> dA_copies(dA, copies);
+        rocblas_rotating_copies<Ti> dx_copies(dx, copies);
+        rocblas_rotating_copies<To> dy_copies(dy, copies);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dx_copies.init());
+        CHECK_HIP_ERROR(dy_copies.init());
+
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
             rocblas_gemv_strided_batched_fn(handle,
                                             transA,
                                             M,
                                             N,
                                             &h_alpha,
-                                            dA,
+                                            dA_copies[c],
                                             lda,
                                             stride_a,
-                                            dx,
+                                            dx_copies[c],
                                             incx,
                                             stride_x,
                                             &h_beta,
-                                            dy,
+                                            dy_copies[c],
                                             incy,
                                             stride_y,
                                             batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_M,
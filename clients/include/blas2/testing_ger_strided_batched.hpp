@@ -378,10 +378,9 @@ void testing_ger_strided_batched(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; ++b)
-        {
+        cblas_batched(batch_count, ger_gflop_count<T>(M, N), [&](int64_t b) {
             cblas_ger<T, CONJ>(M, N, h_alpha, hx[b], incx, hy[b], incy, hA_gold[b], lda);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -26,6 +26,7 @@
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -276,7 +277,6 @@ void testing_hemv(const Arguments& arg)
     if(arg.timing)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
         for(int iter = 0; iter < number_cold_calls; iter++)
@@ -284,16 +284,29 @@ void testing_hemv(const Arguments& arg)
             rocblas_hemv_fn(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int iter = 0; iter < number_hot_calls; iter++)
-        {
-            rocblas_hemv_fn(handle, uplo, N, &h_alpha, dA, lda, dx, incx, &h_beta, dy, incy);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg, (dA.nmemb() + dx.nmemb() + dy.nmemb()) * sizeof(T));
+        rocblas_rotating_copies<T> dA_copies(dA, copies);
+        rocblas_rotating_copies<T> dx_copies(dx, copies);
+        rocblas_rotating_copies<T> dy_copies(dy, copies);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dx_copies.init());
+        CHECK_HIP_ERROR(dy_copies.init());
+
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
+            rocblas_hemv_fn(handle,
+                            uplo,
+                            N,
+                            &h_alpha,
+                            dA_copies[c],
+                            lda,
+                            dx_copies[c],
+                            incx,
+                            &h_beta,
+                            dy_copies[c],
+                            incy);
+        });
 
         ArgumentModel<e_uplo, e_N, e_alpha, e_lda, e_incx, e_beta, e_incy>{}.log_args<T>(
             rocblas_cout,
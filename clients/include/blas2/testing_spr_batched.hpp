@@ -224,10 +224,9 @@ void testing_spr_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, spr_gflop_count<T>(N), [&](int64_t b) {
             cblas_spr<T>(uplo, N, h_alpha, hx[b], incx, hAp_gold[b]);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // copy output from device to CPU
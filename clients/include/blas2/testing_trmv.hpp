@@ -26,6 +26,7 @@
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -185,15 +186,25 @@ void testing_trmv(const Arguments& arg)
 
         // Go !
         {
-            hipStream_t stream;
-            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-            gpu_time_used        = get_time_us_sync(stream); // in microseconds
-            int number_hot_calls = arg.iters;
-            for(int iter = 0; iter < number_hot_calls; iter++)
-            {
-                rocblas_trmv_fn(handle, uplo, transA, diag, N, dA, lda, dx, incx);
-            }
-            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+            // Copies of the operands for rotating-buffer timing
+            size_t copies = rocblas_rotating_buffer_copies(
+                arg, (dA.nmemb() + dx.nmemb()) * sizeof(T));
+            rocblas_rotating_copies<T> dA_copies(dA, copies);
+            rocblas_rotating_copies<T> dx_copies(dx, copies);
+            CHECK_HIP_ERROR(dA_copies.init());
+            CHECK_HIP_ERROR(dx_copies.init());
+
+            rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
+                rocblas_trmv_fn(handle,
+                                uplo,
+                                transA,
+                                diag,
+                                N,
+                                dA_copies[c],
+                                lda,
+                                dx_copies[c],
+                                incx);
+            });
         }
 
         // Log performance.
@@ -180,8 +180,9 @@ void testing_dgmm_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        cblas_batched(batch_count, dgmm_gflop_count<T>(M, N), [&](int64_t b) {
             cblas_dgmm<T>(side, M, N, hA[b], lda, hx[b], incx, hC_gold[b], ldc);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -485,8 +485,7 @@ void testing_geam_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, geam_gflop_count<T>(M, N), [&](int64_t b) {
             auto hA_copy_p = hA_copy[b];
             auto hB_copy_p = hB_copy[b];
             auto hC_gold_p = hC_gold[b];
@@ -503,7 +502,7 @@ void testing_geam_batched(const Arguments& arg)
                        ldb,
                        (T*)hC_gold_p,
                        ldc);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -562,8 +562,7 @@ void testing_geam_strided_batched(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        for(size_t b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, geam_gflop_count<T>(M, N), [&](int64_t b) {
             cblas_geam(transA,
                        transB,
                        M,
@@ -576,7 +575,7 @@ void testing_geam_strided_batched(const Arguments& arg)
                        ldb,
                        hC_gold[b],
                        ldc);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
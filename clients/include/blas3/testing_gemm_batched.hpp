@@ -24,6 +24,7 @@
 
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -32,6 +33,7 @@
 #include "rocblas_math.hpp"
 #include "rocblas_matrix.hpp"
 #include "rocblas_random.hpp"
+#include "rocblas_reference_cache.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
 #include "unit.hpp"
@@ -436,11 +438,23 @@ void testing_gemm_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(rocblas_int b = 0; b < batch_count; b++)
-        {
-            cblas_gemm<T>(
-                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
-        }
+        rocblas_reference_cached(arg, hC_gold, [&] {
+            cblas_batched(batch_count, gemm_gflop_count<T>(M, N, K), [&](int64_t b) {
+                cblas_gemm<T>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA[b],
+                              lda,
+                              hB[b],
+                              ldb,
+                              h_beta,
+                              hC_gold[b],
+                              ldc);
+            });
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // GPU fetch
@@ -509,7 +523,6 @@ void testing_gemm_batched(const Arguments& arg)
     if(arg.timing && arg.api != INTERNAL)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
@@ -532,12 +545,18 @@ void testing_gemm_batched(const Arguments& arg)
                                                          batch_count)));
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        double gpu_time_used = get_time_us_sync(stream); // in microseconds
-
-        for(int i = 0; i < number_hot_calls; i++)
-        {
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg, (dA.nmemb() + dB.nmemb() + dC.nmemb()) * sizeof(T));
+        rocblas_rotating_batch_copies<T> dA_copies(dA, copies, offsetA);
+        rocblas_rotating_batch_copies<T> dB_copies(dB, copies, offsetB);
+        rocblas_rotating_batch_copies<T> dC_copies(dC, copies, offsetC);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dB_copies.init());
+        CHECK_HIP_ERROR(dC_copies.init());
+
+        double gpu_time_used;
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
             rocblas_gemm_batched_fn(handle,
                                     transA,
                                     transB,
@@ -545,17 +564,15 @@ void testing_gemm_batched(const Arguments& arg)
                                     N,
                                     K,
                                     &h_alpha,
-                                    dA.ptr_on_device(),
+                                    dA_copies[c],
                                     lda,
-                                    dB.ptr_on_device(),
+                                    dB_copies[c],
                                     ldb,
                                     &h_beta,
-                                    dC.ptr_on_device(),
+                                    dC_copies[c],
                                     ldc,
                                     batch_count);
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_transB,
@@ -491,8 +491,7 @@ void testing_her2k_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, herXX_gflop_count_fn(N, K), [&](int64_t b) {
             // herkx: B equals A to ensure a symmetric result
             herXX_ref_fn(uplo,
                          transA,
@@ -506,7 +505,7 @@ void testing_her2k_batched(const Arguments& arg)
                          &h_beta[0],
                          hC_gold[b],
                          ldc);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
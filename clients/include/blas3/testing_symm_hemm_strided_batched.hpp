@@ -469,8 +469,7 @@ void testing_symm_hemm_strided_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, gflop_count_fn(side, M, N), [&](int64_t b) {
             if(HERM)
             {
                 cblas_hemm<T>(
@@ -491,7 +490,7 @@ void testing_symm_hemm_strided_batched(const Arguments& arg)
                               hC_gold[b],
                               ldc);
             }
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         if(arg.pointer_mode_host)
@@ -447,8 +447,7 @@ void testing_syr2k_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, syrXX_gflop_count_fn(N, K), [&](int64_t b) {
             if(TWOK)
             {
                 cblas_syr2k<T>(uplo,
@@ -469,7 +468,7 @@ void testing_syr2k_batched(const Arguments& arg)
                 cblas_syrk<T>(
                     uplo, transA, N, K, h_alpha[0], hA[b], lda, h_beta[0], hC_gold[b], ldc);
             }
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -540,8 +540,7 @@ void testing_syr2k_strided_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, syrXX_gflop_count_fn(N, K), [&](int64_t b) {
             if(TWOK)
             {
                 cblas_syr2k<T>(uplo,
@@ -570,7 +569,7 @@ void testing_syr2k_strided_batched(const Arguments& arg)
                               hC_gold[b],
                               ldc); // B must == A to use syrk as reference
             }
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
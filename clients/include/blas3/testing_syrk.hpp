@@ -25,6 +25,7 @@
 #include "bytes.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -33,6 +34,7 @@
 #include "rocblas_math.hpp"
 #include "rocblas_matrix.hpp"
 #include "rocblas_random.hpp"
+#include "rocblas_reference_cache.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
 #include "unit.hpp"
@@ -245,9 +247,8 @@ void testing_syrk(const Arguments& arg)
     size_t flush_batch_count = 1;
     if(arg.timing)
     {
-        size_t a_c_size          = (stride_a + stride_c) * sizeof(T);
-        size_t flush_malloc_size = arg.flush_malloc_size > 0 ? arg.flush_malloc_size : 1;
-        flush_batch_count        = 1 + ((flush_malloc_size - 1) / a_c_size);
+        size_t a_c_size   = (stride_a + stride_c) * sizeof(T);
+        flush_batch_count = rocblas_rotating_buffer_copies(arg, a_c_size);
         rocblas_cout << "flush_batch_count = " << flush_batch_count << std::endl;
     }
 
@@ -319,7 +320,9 @@ void testing_syrk(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        cblas_syrk<T>(uplo, transA, N, K, h_alpha[0], hA, lda, h_beta[0], hC_gold, ldc);
+        rocblas_reference_cached(arg, hC_gold, [&] {
+            cblas_syrk<T>(uplo, transA, N, K, h_alpha[0], hA, lda, h_beta[0], hC_gold, ldc);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -376,7 +379,6 @@ void testing_syrk(const Arguments& arg)
     if(arg.timing)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
         CHECK_HIP_ERROR(dC.broadcast_one_matrix_from(hC));
@@ -386,25 +388,20 @@ void testing_syrk(const Arguments& arg)
             rocblas_syrk_fn(handle, uplo, transA, N, K, h_alpha, dA[0], lda, h_beta, dC[0], ldc);
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int i = 0; i < number_hot_calls; i++)
-        {
-            int flush_index = (i + 1) % flush_batch_count;
-            rocblas_syrk_fn(handle,
-                            uplo,
-                            transA,
-                            N,
-                            K,
-                            h_alpha,
-                            dA[flush_index],
-                            lda,
-                            h_beta,
-                            dC[flush_index],
-                            ldc);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        rocblas_time_hot_calls(
+            arg, handle, flush_batch_count, gpu_time_used, [&](int, size_t flush_index) {
+                rocblas_syrk_fn(handle,
+                                uplo,
+                                transA,
+                                N,
+                                K,
+                                h_alpha,
+                                dA[flush_index],
+                                lda,
+                                h_beta,
+                                dC[flush_index],
+                                ldc);
+            });
 
         ArgumentModel<e_uplo, e_transA, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>{}.log_args<T>(
             rocblas_cout,
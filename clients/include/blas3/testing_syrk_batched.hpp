@@ -33,6 +33,7 @@
 #include "rocblas_math.hpp"
 #include "rocblas_matrix.hpp"
 #include "rocblas_random.hpp"
+#include "rocblas_reference_cache.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
 #include "unit.hpp"
@@ -350,10 +351,12 @@ void testing_syrk_batched(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // cpu reference
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_syrk<T>(uplo, transA, N, K, h_alpha[0], hA[i], lda, h_beta[0], hC_gold[i], ldc);
-        }
+        rocblas_reference_cached(arg, hC_gold, [&] {
+            cblas_batched(batch_count, syrk_gflop_count<T>(N, K), [&](int64_t i) {
+                cblas_syrk<T>(
+                    uplo, transA, N, K, h_alpha[0], hA[i], lda, h_beta[0], hC_gold[i], ldc);
+            });
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
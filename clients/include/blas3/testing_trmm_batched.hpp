@@ -648,10 +648,9 @@ void testing_trmm_batched(const Arguments& arg)
 
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
-        for(rocblas_int i = 0; i < batch_count; i++)
-        {
+        cblas_batched(batch_count, trmm_gflop_count<T>(M, N, side), [&](int64_t i) {
             cblas_trmm<T>(side, uplo, transA, diag, M, N, alpha, hA[i], lda, hB[i], ldb);
-        }
+        });
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
         // copy B matrix into C matrix
@@ -31,6 +31,7 @@
 #include "rocblas_math.hpp"
 #include "rocblas_matrix.hpp"
 #include "rocblas_random.hpp"
+#include "rocblas_reference_cache.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
 #include "unit.hpp"
@@ -386,11 +387,13 @@ void testing_trsm_batched(const Arguments& arg)
 
     copy_matrix_with_different_leading_dimensions(hX, hB);
 
-    for(int b = 0; b < batch_count; b++)
-    {
-        // Calculate hB = hA*hX
-        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hB[b], M);
-    }
+    rocblas_reference_cached(arg, hB, [&] {
+        for(int b = 0; b < batch_count; b++)
+        {
+            // Calculate hB = hA*hX
+            cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA[b], lda, hB[b], M);
+        }
+    });
 
     copy_matrix_with_different_leading_dimensions(hB, hXorB_1);
 
@@ -675,8 +678,9 @@ void testing_trsm_batched(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
+        cblas_batched(batch_count, trsm_gflop_count<T>(M, N, K), [&](int64_t b) {
             cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA[b], lda, hXorB_1[b], ldb);
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -376,8 +376,9 @@ void testing_trtri_batched(const Arguments& arg)
             cpu_time_used = get_time_us_no_sync();
 
         // CBLAS doesn't have trtri implementation so using the LAPACK trtri
-        for(size_t b = 0; b < batch_count; b++)
+        cblas_batched(batch_count, trtri_gflop_count<T>(N), [&](int64_t b) {
             lapack_xtrtri<T>(char_uplo, char_diag, N, hB[b], lda);
+        });
 
         if(arg.timing)
             cpu_time_used = get_time_us_no_sync() - cpu_time_used;
@@ -24,6 +24,7 @@
 
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -531,8 +532,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
         // CPU BLAS
         cpu_time_used = get_time_us_no_sync();
 
-        for(rocblas_int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, gemm_gflop_count<Tc>(M, N, K), [&](int64_t b) {
             cblas_gemm<Ti, To_hpa>(transA,
                                    transB,
                                    M,
@@ -546,7 +546,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                    h_beta_Tc,
                                    hD_gold[b],
                                    ldd);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -616,12 +616,21 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                                            flags));
         }
 
-        int         number_hot_calls = arg.iters;
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int i = 0; i < number_hot_calls; i++)
-        {
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg,
+            (dA.nmemb() + dB.nmemb()) * sizeof(Ti)
+                + (dC.nmemb() + (arg.outofplace ? dD.nmemb() : 0)) * sizeof(To));
+        rocblas_rotating_batch_copies<Ti> dA_copies(dA, copies);
+        rocblas_rotating_batch_copies<Ti> dB_copies(dB, copies);
+        rocblas_rotating_batch_copies<To> dC_copies(dC, copies);
+        rocblas_rotating_batch_copies<To> dD_copies(dD, arg.outofplace ? copies : 1);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dB_copies.init());
+        CHECK_HIP_ERROR(dC_copies.init());
+        CHECK_HIP_ERROR(dD_copies.init());
+
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
             rocblas_gemm_batched_ex_fn(handle,
                                        transA,
                                        transB,
@@ -629,17 +638,17 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                        N,
                                        K,
                                        &h_alpha_Tc,
-                                       dA.ptr_on_device(),
+                                       dA_copies[c],
                                        arg.a_type,
                                        lda,
-                                       dB.ptr_on_device(),
+                                       dB_copies[c],
                                        arg.b_type,
                                        ldb,
                                        &h_beta_Tc,
-                                       dC.ptr_on_device(),
+                                       dC_copies[c],
                                        arg.c_type,
                                        ldc,
-                                       dDref.ptr_on_device(),
+                                       arg.outofplace ? dD_copies[c] : dC_copies[c],
                                        d_type,
                                        ldd,
                                        batch_count,
@@ -647,8 +656,7 @@ void testing_gemm_batched_ex(const Arguments& arg)
                                        algo,
                                        solution_index,
                                        flags);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_transB,
@@ -25,6 +25,7 @@
 #include "../../library/src/include/handle.hpp"
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -331,6 +332,8 @@ void testing_gemm_ex(const Arguments& arg)
     // - In the number_hot_calls timing loop it cycles through the flush_batch_count copies
     //   of dA, dB, dC, dD, and if arg.flush_malloc_size is large enouth they will be evicted
     //   from cache before they are reused.
+    // - With rocblas-bench --rotating_buffer the copies are sized from the device caches
+    //   instead, see rocblas_rotating_buffer_copies.
     size_t stride_a          = lda * A_col;
     size_t stride_b          = ldb * B_col;
     size_t stride_c          = ldc * N;
@@ -338,10 +341,9 @@ void testing_gemm_ex(const Arguments& arg)
     size_t flush_batch_count = 1;
     if(arg.timing)
     {
-        size_t flush_malloc_size = arg.flush_malloc_size > 0 ? arg.flush_malloc_size : 1;
         size_t a_b_c_d_size
             = (stride_a + stride_b) * sizeof(Ti) + (stride_c + stride_d) * sizeof(To);
-        flush_batch_count = 1 + ((flush_malloc_size - 1) / a_b_c_d_size);
+        flush_batch_count = rocblas_rotating_buffer_copies(arg, a_b_c_d_size);
         rocblas_cout << "flush_batch_count = " << flush_batch_count << std::endl;
     }
 
@@ -572,7 +574,6 @@ void testing_gemm_ex(const Arguments& arg)
     if(arg.timing)
     {
         int number_cold_calls = arg.cold_iters;
-        int number_hot_calls  = arg.iters;
 
         CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
 
@@ -588,22 +589,17 @@ void testing_gemm_ex(const Arguments& arg)
             // clang-format on
         }
 
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int i = 0; i < number_hot_calls; i++)
-        {
-            int flush_index = (i + 1) % flush_batch_count;
-            // clang-format off
-            rocblas_gemm_ex_fn(handle, transA, transB, M, N, K, &h_alpha_Tc,
-                               dA[flush_index], arg.a_type, lda,
-                               dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
-                               dC[flush_index], arg.c_type, ldc,
-                               dD[flush_index],     d_type, ldd,
-                               arg.compute_type, algo, solution_index, flags);
-            // clang-format on
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        rocblas_time_hot_calls(
+            arg, handle, flush_batch_count, gpu_time_used, [&](int, size_t flush_index) {
+                // clang-format off
+                rocblas_gemm_ex_fn(handle, transA, transB, M, N, K, &h_alpha_Tc,
+                                   dA[flush_index], arg.a_type, lda,
+                                   dB[flush_index], arg.b_type, ldb, &h_beta_Tc,
+                                   dC[flush_index], arg.c_type, ldc,
+                                   dD[flush_index],     d_type, ldd,
+                                   arg.compute_type, algo, solution_index, flags);
+                // clang-format on
+            });
 
         ArgumentModel<e_transA,
                       e_transB,
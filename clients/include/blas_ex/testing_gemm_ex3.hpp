@@ -12,6 +12,7 @@
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
+#include "rocblas_convert.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_init.hpp"
 #include "rocblas_math.hpp"
@@ -929,10 +930,8 @@ rocblas_status call_trusted_gemm_f8(rocblas_handle    handle,
     if(!To_is_final)
     {
         auto* D_ptr = hD_new[0];
-        // auto* C_ptr = C[0];
-        for(int i = 0; i < M; i++)
-            for(int j = 0; j < N; j++)
-                D_ptr[i + j * ldd_new] = static_cast<float>(C[i + j * ldc]);
+        for(int j = 0; j < N; j++)
+            rocblas_convert_n(C + size_t(j) * ldc, D_ptr + size_t(j) * ldd_new, M);
     }
 
     const int dim_m = 16;
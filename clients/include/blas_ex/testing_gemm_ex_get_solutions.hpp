@@ -167,6 +167,22 @@ void testing_gemm_ex_get_solutions(const Arguments& arg)
     EXPECT_ROCBLAS_STATUS(rocblas_gemm_exM(GEMM_EX_ARGS, max + 1, rocblas_gemm_flags_none),
                           rocblas_status_invalid_value);
 
+    // Testing the selected solution is reported with the numbering of get_solutions
+    rocblas_int selected = -1;
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_index_query(handle, &selected));
+    EXPECT_EQ(selected, 0);
+    if(size)
+    {
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_exM(GEMM_EX_ARGS, 0, rocblas_gemm_flags_check_solution_index));
+        EXPECT_GT(selected, 0);
+
+        CHECK_ROCBLAS_ERROR(
+            rocblas_gemm_exM(GEMM_EX_ARGS, ary[0], rocblas_gemm_flags_check_solution_index));
+        EXPECT_EQ(selected, ary[0]);
+    }
+    CHECK_ROCBLAS_ERROR(rocblas_set_solution_index_query(handle, nullptr));
+
     // Testing get solutions by type - should be superset of solutions that solve problem
     rocblas_int size_type;
     CHECK_ROCBLAS_ERROR(rocblas_gemm_ex_get_solutions_by_type(handle,
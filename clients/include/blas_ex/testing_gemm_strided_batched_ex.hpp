@@ -24,6 +24,7 @@
 
 #include "cblas_interface.hpp"
 #include "flops.hpp"
+#include "hot_call_timing.hpp"
 #include "near.hpp"
 #include "norm.hpp"
 #include "rocblas.hpp"
@@ -551,8 +552,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         cpu_time_used = get_time_us_no_sync();
 
         // CPU BLAS
-        for(rocblas_int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, gemm_gflop_count<Tc>(M, N, K), [&](int64_t b) {
             cblas_gemm<Ti, To_hpa>(
                 transA,
                 transB,
@@ -570,7 +570,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                 alt ? (alt_round ? rocblas_bfloat16::rocblas_truncate_t::rocblas_round_near_zero
                                  : rocblas_bfloat16::rocblas_truncate_t::rocblas_truncate)
                     : rocblas_bfloat16::rocblas_truncate_t::rocblas_round_near_even);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -648,12 +648,21 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                                                    flags));
         }
 
-        int         number_hot_calls = arg.iters;
-        hipStream_t stream;
-        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-        gpu_time_used = get_time_us_sync(stream); // in microseconds
-        for(int i = 0; i < number_hot_calls; i++)
-        {
+        // Copies of the operands for rotating-buffer timing
+        size_t copies = rocblas_rotating_buffer_copies(
+            arg,
+            (dA.nmemb() + dB.nmemb()) * sizeof(Ti)
+                + (dC.nmemb() + (arg.outofplace ? dD.nmemb() : 0)) * sizeof(To));
+        rocblas_rotating_copies<Ti> dA_copies(dA, copies);
+        rocblas_rotating_copies<Ti> dB_copies(dB, copies);
+        rocblas_rotating_copies<To> dC_copies(dC, copies);
+        rocblas_rotating_copies<To> dD_copies(dD, arg.outofplace ? copies : 1);
+        CHECK_HIP_ERROR(dA_copies.init());
+        CHECK_HIP_ERROR(dB_copies.init());
+        CHECK_HIP_ERROR(dC_copies.init());
+        CHECK_HIP_ERROR(dD_copies.init());
+
+        rocblas_time_hot_calls(arg, handle, copies, gpu_time_used, [&](int, size_t c) {
             rocblas_gemm_strided_batched_ex_fn(handle,
                                                transA,
                                                transB,
@@ -661,20 +670,20 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                                N,
                                                K,
                                                &h_alpha_Tc,
-                                               dA,
+                                               dA_copies[c],
                                                arg.a_type,
                                                lda,
                                                stride_a,
-                                               dB,
+                                               dB_copies[c],
                                                arg.b_type,
                                                ldb,
                                                stride_b,
                                                &h_beta_Tc,
-                                               dC,
+                                               dC_copies[c],
                                                arg.c_type,
                                                ldc,
                                                stride_c,
-                                               dDref,
+                                               arg.outofplace ? dD_copies[c] : dC_copies[c],
                                                d_type,
                                                ldd,
                                                stride_d,
@@ -683,8 +692,7 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
                                                algo,
                                                solution_index,
                                                flags);
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        });
 
         ArgumentModel<e_transA,
                       e_transB,
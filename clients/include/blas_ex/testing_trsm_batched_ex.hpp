@@ -610,10 +610,9 @@ void testing_trsm_batched_ex(const Arguments& arg)
         // CPU cblas
         cpu_time_used = get_time_us_no_sync();
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, trsm_gflop_count<T>(M, N, K), [&](int64_t b) {
             cblas_trsm<T>(side, uplo, transA, diag, M, N, alpha_h, hA[b], lda, cpuXorB[b], ldb);
-        }
+        });
 
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/*!\file
+ * \brief Blocked, multithreaded reference gemm for inputs which cblas does not support
+ *
+ * The half, bfloat16 and float8 cblas_gemm references compute in float. Instead of converting
+ * whole copies of A, B and C to float and calling cblas_sgemm, cblas_gemm_blocked converts
+ * blocks of A and B into float panels local to each OpenMP thread as they are needed, and
+ * computes the tiles of C from the panels. Each element of C is accumulated in float in the
+ * order of k, so the result does not depend on the number of threads.
+ */
+
+namespace cblas_gemm_blocking
+{
+    // Rows and columns of C computed in registers, and the rows, columns and depth of the
+    // blocks of C, A and B converted to panels
+    constexpr int64_t mr = 8;
+    constexpr int64_t nr = 4;
+    constexpr int64_t mc = 128;
+    constexpr int64_t nc = 128;
+    constexpr int64_t kc = 256;
+
+    // c[nr][mr] += a[kb][mr] * b[kb][nr]
+    inline void micro_kernel(int64_t kb, const float* a, const float* b, float* c)
+    {
+        float acc[nr][mr] = {};
+        for(int64_t p = 0; p < kb; ++p)
+            for(int64_t j = 0; j < nr; ++j)
+            {
+                float bj = b[p * nr + j];
+                for(int64_t i = 0; i < mr; ++i)
+                    acc[j][i] += a[p * mr + i] * bj;
+            }
+        for(int64_t j = 0; j < nr; ++j)
+            for(int64_t i = 0; i < mr; ++i)
+                c[j * mr + i] += acc[j][i];
+    }
+}
+
+/*! \brief C = alpha * op(A) * op(B) + beta * C, computed in float.
+
+    load_a, load_b and load_c convert elements of A, B and C to float, as the conversions
+    of the full copies they replace, including any rocblas_truncate_t rounding, and the
+    results are stored to C with To(float). As with cblas_sgemm, C is not read when beta is 0,
+    and C is only scaled by beta when alpha or k is 0.
+*/
+template <typename TiA, typename TiB, typename To, typename LoadA, typename LoadB, typename LoadC>
+void cblas_gemm_blocked(rocblas_operation transA,
+                        rocblas_operation transB,
+                        int64_t           m,
+                        int64_t           n,
+                        int64_t           k,
+                        float             alpha,
+                        const TiA*        A,
+                        int64_t           lda,
+                        const TiB*        B,
+                        int64_t           ldb,
+                        float             beta,
+                        To*               C,
+                        int64_t           ldc,
+                        LoadA             load_a,
+                        LoadB             load_b,
+                        LoadC             load_c)
+{
+    using namespace cblas_gemm_blocking;
+
+    if(m <= 0 || n <= 0)
+        return;
+
+    // A(i, p) and B(p, j) of op(A) and op(B)
+    const int64_t a_row = transA == rocblas_operation_none ? 1 : lda;
+    const int64_t a_col = transA == rocblas_operation_none ? lda : 1;
+    const int64_t b_row = transB == rocblas_operation_none ? 1 : ldb;
+    const int64_t b_col = transB == rocblas_operation_none ? ldb : 1;
+
+    const int64_t m_tiles = (m + mc - 1) / mc;
+    const int64_t n_tiles = (n + nc - 1) / nc;
+
+#pragma omp parallel
+    {
+        // Panels of A and B padded to multiples of mr and nr, and the tile of C
+        constexpr int64_t  mc_pad = (mc + mr - 1) / mr * mr, nc_pad = (nc + nr - 1) / nr * nr;
+        std::vector<float> a_panel(mc_pad * kc), b_panel(kc * nc_pad), c_tile(mc_pad * nc_pad);
+
+#pragma omp for collapse(2) schedule(dynamic)
+        for(int64_t jt = 0; jt < n_tiles; ++jt)
+            for(int64_t it = 0; it < m_tiles; ++it)
+            {
+                const int64_t i0 = it * mc, mb = std::min(mc, m - i0);
+                const int64_t j0 = jt * nc, nb = std::min(nc, n - j0);
+                const int64_t ms = (mb + mr - 1) / mr, ns = (nb + nr - 1) / nr;
+
+                std::fill(c_tile.begin(), c_tile.end(), 0.0f);
+
+                for(int64_t p0 = 0; alpha != 0 && p0 < k; p0 += kc)
+                {
+                    const int64_t kb = std::min(kc, k - p0);
+
+                    // a_panel[s][p][i] holds A(i0 + s * mr + i, p0 + p), zero past m
+                    for(int64_t s = 0; s < ms; ++s)
+                        for(int64_t p = 0; p < kb; ++p)
+                        {
+                            float*      a = &a_panel[(s * kc + p) * mr];
+                            const TiA*  src = A + (i0 + s * mr) * a_row + (p0 + p) * a_col;
+                            int64_t     rows = std::min(mr, mb - s * mr);
+                            for(int64_t i = 0; i < rows; ++i)
+                                a[i] = load_a(src[i * a_row]);
+                            std::fill(a + rows, a + mr, 0.0f);
+                        }
+
+                    // b_panel[s][p][j] holds B(p0 + p, j0 + s * nr + j), zero past n
+                    for(int64_t s = 0; s < ns; ++s)
+                        for(int64_t p = 0; p < kb; ++p)
+                        {
+                            float*      b = &b_panel[(s * kc + p) * nr];
+                            const TiB*  src = B + (p0 + p) * b_row + (j0 + s * nr) * b_col;
+                            int64_t     cols = std::min(nr, nb - s * nr);
+                            for(int64_t j = 0; j < cols; ++j)
+                                b[j] = load_b(src[j * b_col]);
+                            std::fill(b + cols, b + nr, 0.0f);
+                        }
+
+                    for(int64_t sj = 0; sj < ns; ++sj)
+                        for(int64_t si = 0; si < ms; ++si)
+                            micro_kernel(kb,
+                                         &a_panel[si * kc * mr],
+                                         &b_panel[sj * kc * nr],
+                                         &c_tile[(sj * ms + si) * mr * nr]);
+                }
+
+                // c_tile[sj][si][j][i] holds the product for C(i0 + si * mr + i, j0 + sj * nr + j)
+                for(int64_t j = 0; j < nb; ++j)
+                {
+                    To*          c   = C + i0 + (j0 + j) * ldc;
+                    const float* sum = &c_tile[((j / nr) * ms * nr + j % nr) * mr];
+                    for(int64_t i = 0; i < mb; ++i)
+                    {
+                        float ab = sum[(i / mr) * mr * nr + i % mr];
+                        float result;
+                        if(alpha == 0 || k == 0)
+                            result = beta == 0 ? 0.0f : beta * load_c(c[i]);
+                        else
+                            result = beta == 0 ? alpha * ab : alpha * ab + beta * load_c(c[i]);
+                        c[i] = To(result);
+                    }
+                }
+            }
+    }
+}
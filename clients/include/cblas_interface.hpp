@@ -24,10 +24,69 @@
 #pragma once
 
 #include "cblas.h"
+#include "cblas_gemm_blocked.hpp"
 #include "lapack_utilities.hpp"
 #include "rocblas.h"
+#include <string>
 #include <type_traits>
 
+/*
+ * ===========================================================================
+ *    batched references
+ * ===========================================================================
+ */
+
+//! GFLOP count of a batch above which the host BLAS gets the threads, instead of the batches
+constexpr double cblas_batched_large_gflops = 0.01;
+
+/*! \brief Sets the number of threads of the host BLAS library.
+
+    Returns the previous setting, which cblas_set_num_threads() restores, or 0 if the library
+    has no such control. A num_threads of 0 does nothing.
+*/
+int cblas_set_num_threads(int num_threads);
+
+//! Name and configuration of the host BLAS library, as far as the library reports them
+std::string cblas_library_identity();
+
+/*! \brief Number of OpenMP threads cblas_batched() computes batch_count batches with, or 1 to
+    compute them in order with a multithreaded host BLAS.
+
+    The batches get the threads when there are at least as many batches as threads, or when
+    each batch, of batch_gflops, is too small for the host BLAS to use the threads well.
+    Returns 1 inside a parallel region.
+*/
+int cblas_batched_threads(int64_t batch_count, double batch_gflops);
+
+/*! \brief Computes the reference of batches 0 to batch_count - 1 with ref(b).
+
+    When cblas_batched_threads() gives more than one thread, the batches are computed in
+    parallel and the host BLAS is pinned to one thread until they are done, so ref must only
+    write the results of batch b. batch_gflops is the GFLOP count of one batch, as given by
+    flops.hpp.
+*/
+template <typename F>
+void cblas_batched(int64_t batch_count, double batch_gflops, F&& ref)
+{
+    int threads = cblas_batched_threads(batch_count, batch_gflops);
+    if(threads <= 1)
+    {
+        for(int64_t b = 0; b < batch_count; b++)
+            ref(b);
+        return;
+    }
+
+    int blas_threads = cblas_set_num_threads(1);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(threads)
+#endif
+    for(int64_t b = 0; b < batch_count; b++)
+        ref(b);
+
+    cblas_set_num_threads(blas_threads);
+}
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -1820,63 +1879,7 @@ void cblas_geam(rocblas_operation transa,
                 int64_t           ldc);
 
 // gemm
-template <typename TiA,
-          typename TiB,
-          typename To,
-          typename Tc,
-          typename std::enable_if<std::is_same<To, Tc>{}, int>::type = 0>
-inline void f8_to_cblas_sgemm(rocblas_operation transA,
-                              rocblas_operation transB,
-                              int64_t           m,
-                              int64_t           n,
-                              int64_t           k,
-                              Tc                alpha,
-                              const TiA*        A,
-                              int64_t           lda,
-                              const TiB*        B,
-                              int64_t           ldb,
-                              Tc                beta,
-                              To*               C,
-                              int64_t           ldc)
-{
-    // cblas does not support rocblas_float8, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<Tc> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C,
-                ldc);
-}
-
-// gemm
-template <typename TiA,
-          typename TiB,
-          typename To,
-          typename Tc,
-          typename std::enable_if<!std::is_same<To, Tc>{}, int>::type = 0>
+template <typename TiA, typename TiB, typename To, typename Tc>
 inline void f8_to_cblas_sgemm(rocblas_operation transA,
                               rocblas_operation transB,
                               int64_t           m,
@@ -1891,41 +1894,13 @@ inline void f8_to_cblas_sgemm(rocblas_operation transA,
                               To*               C,
                               int64_t           ldc)
 {
-    // cblas does not support rocblas_float8, so convert to higher precision float
+    // cblas does not support rocblas_float8, so compute in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = (transA == rocblas_operation_none ? k : m) * size_t(lda);
-    size_t sizeB = (transB == rocblas_operation_none ? n : k) * size_t(ldb);
-    size_t sizeC = n * size_t(ldc);
-
-    host_vector<Tc> A_float(sizeA), B_float(sizeB), C_float(sizeC);
-
-    for(size_t i = 0; i < sizeA; i++)
-        A_float[i] = static_cast<float>(A[i]);
-    for(size_t i = 0; i < sizeB; i++)
-        B_float[i] = static_cast<float>(B[i]);
-    for(size_t i = 0; i < sizeC; i++)
-        C_float[i] = static_cast<float>(C[i]);
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, static_cast<CBLAS_TRANSPOSE>(transA) );
-    cblas_sgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha,
-                A_float,
-                lda,
-                B_float,
-                ldb,
-                beta,
-                C_float,
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = To(C_float[i]);
+    auto load_a = [](TiA x) { return static_cast<float>(x); };
+    auto load_b = [](TiB x) { return static_cast<float>(x); };
+    auto load_c = [](To x) { return static_cast<float>(x); };
+    cblas_gemm_blocked(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, load_a, load_b, load_c);
 }
 
 template <typename Ti, typename To = Ti, typename Tc>
@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <hip/hip_runtime.h>
+
+/*!\file
+ * \brief Graph replay timing of the hot calls of rocblas-bench
+ *
+ * The hot calls are captured into a hipGraph once and the graph is replayed, so that their
+ * kernels run back to back without the host API and launch overhead of each call. A replay
+ * much faster than the calls themselves shows that the problem is launch-bound, and would
+ * gain from batching.
+ */
+
+/*! \brief rocblas-bench graph timing options, set from the command line */
+struct rocblas_graph_timing_options
+{
+    bool enabled = false;
+};
+
+void rocblas_set_graph_timing(const rocblas_graph_timing_options& opt);
+const rocblas_graph_timing_options& rocblas_get_graph_timing();
+
+/*! \brief Time of the hot calls replayed from a graph */
+struct rocblas_graph_timing_result
+{
+    double replay_us = 0; // device time of the replay of arg.iters calls, as gpu_time_used
+    double launch_us = 0; // host time of hipGraphLaunch
+};
+
+// Result of the last timed hot loop on this thread, consumed when logged
+void rocblas_graph_timing_set_result(const rocblas_graph_timing_result& result);
+void rocblas_graph_timing_clear_result();
+bool rocblas_graph_timing_take_result(rocblas_graph_timing_result& result);
+
+/*! \brief Captures the work enqueued by rocBLAS calls on handle into a graph.
+
+    The default stream cannot be captured, so the handle is switched to a stream created for
+    the capture, with stream-ordered workspace allocation as in graph tests. The stream of the
+    handle is restored by replay or the destructor.
+*/
+class rocblas_graph_capture
+{
+public:
+    explicit rocblas_graph_capture(rocblas_handle handle);
+    ~rocblas_graph_capture();
+
+    rocblas_graph_capture(const rocblas_graph_capture&) = delete;
+    rocblas_graph_capture& operator=(const rocblas_graph_capture&) = delete;
+
+    /*! \brief End the capture, then time one replay of the graph after an untimed one */
+    void replay(rocblas_graph_timing_result& result);
+
+private:
+    void end_capture(hipGraph_t* graph);
+
+    rocblas_handle m_handle;
+    hipStream_t    m_stream     = nullptr;
+    hipStream_t    m_old_stream = nullptr;
+    bool           m_capturing  = false;
+};
@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "graph_timing.hpp"
+#include "launch_breakdown.hpp"
+#include "rocblas_arguments.hpp"
+#include "rocblas_test.hpp"
+#include "rotating_buffer.hpp"
+#include "timing_statistics.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <vector>
+
+/*!\file
+ * \brief Timing of the hot calls of rocblas-bench
+ */
+
+/*! \brief With graph timing enabled, capture arg.iters calls of hot_call(i) into a graph and
+    time its replay, reported by ArgumentModel::log_perf next to the time of the calls. */
+template <typename F>
+void rocblas_time_graph_replay(const Arguments& arg, rocblas_handle handle, F&& hot_call)
+{
+    if(!rocblas_get_graph_timing().enabled || arg.iters < 1)
+        return;
+
+    rocblas_graph_timing_result result;
+    rocblas_graph_capture       graph(handle);
+    for(int i = 0; i < arg.iters; i++)
+        hot_call(i);
+    graph.replay(result);
+    rocblas_graph_timing_set_result(result);
+}
+
+/*! \brief With the launch breakdown enabled, time arg.iters calls of hot_call(i) one at a time
+    and split each into host API time, queueing delay and device time, reported by
+    ArgumentModel::log_perf next to the time of the calls. */
+template <typename F>
+void rocblas_time_launch_breakdown(const Arguments& arg, rocblas_handle handle, F&& hot_call)
+{
+    if(!rocblas_get_launch_breakdown().enabled || arg.iters < 1)
+        return;
+
+    rocblas_launch_breakdown_result result;
+    rocblas_launch_breakdown_timer  timer(handle);
+    for(int i = 0; i < arg.iters; i++)
+    {
+        timer.start();
+        hot_call(i);
+        timer.stop();
+    }
+    timer.finish(result);
+    rocblas_launch_breakdown_set_result(result);
+}
+
+/*! \brief Time arg.iters calls of hot_call(i) on the stream of handle, returning the total time
+    in gpu_time_used as expected by ArgumentModel::log_args.
+
+    By default the calls are timed as one block with get_time_us_sync. With per-iteration
+    timing enabled each call is bracketed by a pair of events. Rounds of calls are run,
+    doubling in size, until the bootstrap confidence interval of the mean is narrower than
+    the target or the time budget is used up. The total returned is then the mean of all
+    calls times arg.iters, and the distribution is reported by ArgumentModel::log_perf.
+
+    hot_call(i) receives a running call index, which may exceed arg.iters in adaptive runs.
+    Graph replay and the launch breakdown are not timed; see rocblas_time_hot_calls.
+*/
+template <typename F>
+void rocblas_time_hot_call_loop(const Arguments& arg,
+                                rocblas_handle   handle,
+                                double&          gpu_time_used,
+                                F&&              hot_call)
+{
+    rocblas_iteration_timing_clear_result();
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    const auto& opt       = rocblas_get_iteration_timing();
+    int         hot_calls = arg.iters;
+
+    if(!opt.enabled || hot_calls < 1)
+    {
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < hot_calls; i++)
+            hot_call(i);
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        return;
+    }
+
+    // bounds the number of events alive at once
+    constexpr size_t max_round = 4096;
+
+    std::vector<hipEvent_t>   start, stop;
+    std::vector<double>       samples;
+    rocblas_timing_statistics stats;
+
+    size_t min_samples = hot_calls;
+    size_t max_samples = std::max(opt.max_samples, min_samples);
+    size_t round       = std::min(min_samples, max_round);
+    int    call        = 0;
+    double wall_start  = get_time_us_no_sync();
+
+    while(true)
+    {
+        while(start.size() < round)
+        {
+            hipEvent_t e0, e1;
+            CHECK_HIP_ERROR(hipEventCreate(&e0));
+            CHECK_HIP_ERROR(hipEventCreate(&e1));
+            start.push_back(e0);
+            stop.push_back(e1);
+        }
+
+        for(size_t j = 0; j < round; j++)
+        {
+            CHECK_HIP_ERROR(hipEventRecord(start[j], stream));
+            hot_call(call++);
+            CHECK_HIP_ERROR(hipEventRecord(stop[j], stream));
+        }
+        CHECK_HIP_ERROR(hipEventSynchronize(stop[round - 1]));
+
+        for(size_t j = 0; j < round; j++)
+        {
+            float ms = 0;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&ms, start[j], stop[j]));
+            samples.push_back(ms * 1000.0);
+        }
+
+        // at least arg.iters calls are always timed
+        if(samples.size() < min_samples)
+        {
+            round = std::min(min_samples - samples.size(), max_round);
+            continue;
+        }
+
+        stats = rocblas_timing_summarize(samples, opt.confidence);
+
+        if(opt.ci_target <= 0 || stats.ci_relative_half_width() <= opt.ci_target
+           || samples.size() >= max_samples
+           || (opt.time_budget > 0
+               && get_time_us_no_sync() - wall_start >= opt.time_budget * 1e6))
+            break;
+
+        round = std::min({samples.size(), max_round, max_samples - samples.size()});
+    }
+
+    for(size_t j = 0; j < start.size(); j++)
+    {
+        CHECK_HIP_ERROR(hipEventDestroy(start[j]));
+        CHECK_HIP_ERROR(hipEventDestroy(stop[j]));
+    }
+
+    if(opt.keep_values)
+        stats.values = std::move(samples);
+
+    rocblas_iteration_timing_set_result(stats);
+    gpu_time_used = stats.mean * hot_calls;
+}
+
+/*! \brief Time arg.iters calls of hot_call(i) with rocblas_time_hot_call_loop. With graph
+    timing the calls are also replayed from a graph by rocblas_time_graph_replay, and with the
+    launch breakdown timed one at a time by rocblas_time_launch_breakdown.
+*/
+template <typename F>
+void rocblas_time_hot_calls(const Arguments& arg,
+                            rocblas_handle   handle,
+                            double&          gpu_time_used,
+                            F&&              hot_call)
+{
+    rocblas_graph_timing_clear_result();
+    rocblas_launch_breakdown_clear_result();
+
+    rocblas_time_hot_call_loop(arg, handle, gpu_time_used, hot_call);
+    rocblas_time_graph_replay(arg, handle, hot_call);
+    rocblas_time_launch_breakdown(arg, handle, hot_call);
+}
+
+/*! \brief Time the hot calls cycling through copies of their operands.
+
+    hot_call(i, copy) must use copy number copy of its operands, such as those of
+    rocblas_rotating_copies. Call i uses copy (i + 1) % copies, so that with enough copies
+    each call reads operands which are not in the device caches. The cold calls are expected
+    to use copy 0.
+
+    With rotating buffers enabled, the same calls reusing copy 0 are also timed first, and the
+    hot-cache time is reported by ArgumentModel::log_perf next to the rotating-buffer time in
+    gpu_time_used. With per-iteration timing the distribution is that of the rotating calls,
+    and graph replay and the launch breakdown are only timed for the rotating calls.
+*/
+template <typename F>
+void rocblas_time_hot_calls(const Arguments& arg,
+                            rocblas_handle   handle,
+                            size_t           copies,
+                            double&          gpu_time_used,
+                            F&&              hot_call)
+{
+    rocblas_rotating_buffer_clear_result();
+
+    copies           = std::max<size_t>(copies, 1);
+    bool   report    = rocblas_get_rotating_buffer().enabled && arg.iters > 0;
+    double hot_total = 0;
+
+    if(report && copies > 1)
+        rocblas_time_hot_call_loop(arg, handle, hot_total, [&](int i) { hot_call(i, size_t(0)); });
+
+    rocblas_time_hot_calls(
+        arg, handle, gpu_time_used, [&](int i) { hot_call(i, size_t(i + 1) % copies); });
+
+    if(report)
+        rocblas_rotating_buffer_set_result({copies, copies > 1 ? hot_total : gpu_time_used});
+}
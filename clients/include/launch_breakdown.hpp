@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <hip/hip_runtime.h>
+
+/*!\file
+ * \brief Launch overhead breakdown of the hot calls of rocblas-bench
+ *
+ * Each hot call is run alone on an idle stream and split into the host time of the API call,
+ * from entry to return without synchronization, the queueing delay from entry until its
+ * kernels start on the device, and the device time of the kernels. The kernels of gemm-based
+ * functions are bracketed with the start and stop events of the handle, set by
+ * rocblas_set_start_stop_events. For other functions the queueing delay is not reported, and
+ * the device time is the time the stream stays busy after the call returns.
+ */
+
+/*! \brief rocblas-bench launch breakdown options, set from the command line */
+struct rocblas_launch_breakdown_options
+{
+    bool   enabled        = false;
+    double host_threshold = 0.5; // host share of a call above which it is host-bound
+};
+
+void rocblas_set_launch_breakdown(const rocblas_launch_breakdown_options& opt);
+const rocblas_launch_breakdown_options& rocblas_get_launch_breakdown();
+
+/*! \brief Mean breakdown of the calls, in microseconds per call */
+struct rocblas_launch_breakdown_result
+{
+    size_t calls            = 0;
+    double host_us          = 0; // host API time, from entry to return
+    double queue_us         = 0; // from entry to the start of the kernels, with kernel_events
+    double device_us        = 0; // device time of the kernels
+    double host_share       = 0; // host_us / (host_us + device_us)
+    size_t host_bound_calls = 0; // calls with a host share above host_threshold
+    bool   kernel_events    = false; // whether the handle events bracketed the kernels
+};
+
+// Result of the last timed hot loop on this thread, consumed when logged
+void rocblas_launch_breakdown_set_result(const rocblas_launch_breakdown_result& result);
+void rocblas_launch_breakdown_clear_result();
+bool rocblas_launch_breakdown_take_result(rocblas_launch_breakdown_result& result);
+
+/*! \brief Accumulates the breakdown of calls on the stream of handle made between start and
+    stop. start waits for the stream to be idle, so calls are timed one at a time. */
+class rocblas_launch_breakdown_timer
+{
+public:
+    explicit rocblas_launch_breakdown_timer(rocblas_handle handle);
+    ~rocblas_launch_breakdown_timer();
+
+    rocblas_launch_breakdown_timer(const rocblas_launch_breakdown_timer&) = delete;
+    rocblas_launch_breakdown_timer& operator=(const rocblas_launch_breakdown_timer&) = delete;
+
+    void start();
+    void stop();
+
+    /*! \brief Mean breakdown of the calls timed so far */
+    void finish(rocblas_launch_breakdown_result& result) const;
+
+private:
+    rocblas_handle m_handle;
+    hipStream_t    m_stream       = nullptr;
+    hipEvent_t     m_entry        = nullptr;
+    hipEvent_t     m_done         = nullptr;
+    hipEvent_t     m_kernel_start = nullptr;
+    hipEvent_t     m_kernel_stop  = nullptr;
+    double         m_entry_us     = 0;
+
+    size_t m_calls            = 0;
+    size_t m_kernel_calls     = 0;
+    size_t m_host_bound_calls = 0;
+    double m_host_us          = 0;
+    double m_queue_us         = 0;
+    double m_device_us        = 0;
+};
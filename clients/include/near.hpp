@@ -32,6 +32,7 @@
 #pragma once
 
 #include "rocblas.h"
+#include "rocblas_compare.hpp"
 #include "rocblas_math.hpp"
 #include "rocblas_test.hpp"
 #include "rocblas_vector.hpp"
@@ -101,57 +102,105 @@ ROCBLAS_CLANG_STATIC constexpr double
                                   rocblas_double_complex,
                                   rocblas_double_complex> = 1 / 1000000.0;
 
+// The number and first location of the elements of hGPU which differ from hCPU by more than
+// abs_error, as the NEAR_ASSERT macros below compare them, which round a float reference of a
+// bfloat16 result to bfloat16
+template <typename Tc, typename Tg>
+rocblas_compare_result near_check_mismatches(int64_t        M,
+                                             int64_t        N,
+                                             int64_t        lda,
+                                             rocblas_stride strideA,
+                                             const Tc*      hCPU,
+                                             const Tg*      hGPU,
+                                             int64_t        batch_count,
+                                             double         abs_error)
+{
+    rocblas_compare_options opt;
+    opt.abs_error       = abs_error;
+    opt.round_reference = std::is_same<Tg, rocblas_bfloat16>{};
+
+    return rocblas_compare(M, N, lda, strideA, hCPU, hGPU, batch_count, opt);
+}
+
+template <typename CPU, typename GPU>
+rocblas_compare_result near_check_mismatches_batched(int64_t M,
+                                                     int64_t N,
+                                                     int64_t lda,
+                                                     CPU&&   hCPU,
+                                                     GPU&&   hGPU,
+                                                     int64_t batch_count,
+                                                     double  abs_error)
+{
+    using Tc = std::remove_cv_t<std::remove_reference_t<decltype(hCPU[0][0])>>;
+    using Tg = std::remove_cv_t<std::remove_reference_t<decltype(hGPU[0][0])>>;
+
+    rocblas_compare_options opt;
+    opt.abs_error       = abs_error;
+    opt.round_reference = std::is_same<Tg, rocblas_bfloat16>{};
+
+    return rocblas_compare_batches<Tc, Tg>(
+        M,
+        N,
+        [&](int64_t b) { return &hCPU[b][0]; },
+        lda,
+        [&](int64_t b) { return &hGPU[b][0]; },
+        lda,
+        batch_count,
+        opt);
+}
+
 #ifndef GOOGLE_TEST
 #define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err, NEAR_ASSERT)
 #define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err, NEAR_ASSERT)
 #else
 
+// The elements are compared in one parallel pass, and the first one which is not near enough is
+// asserted again with NEAR_ASSERT for its message
+
 // Also used for vectors with lda used for inc, which may be negative
-#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err, NEAR_ASSERT) \
-    do                                                                            \
-    {                                                                             \
-        for(int64_t k = 0; k < batch_count; k++)                                  \
-            for(int64_t j = 0; j < N; j++)                                        \
-            {                                                                     \
-                int64_t offset = lda >= 0 ? 0 : int64_t(lda) * (1 - N);           \
-                offset += j * int64_t(lda) + k * strideA;                         \
-                size_t idx = offset;                                              \
-                for(size_t i = 0; i < M; i++)                                     \
-                {                                                                 \
-                    if(rocblas_isnan(hCPU[i + idx]))                              \
-                    {                                                             \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[i + idx]));                \
-                    }                                                             \
-                    else                                                          \
-                    {                                                             \
-                        NEAR_ASSERT(hCPU[i + idx], hGPU[i + idx], err);           \
-                    }                                                             \
-                }                                                                 \
-            }                                                                     \
+#define NEAR_CHECK(M, N, lda, strideA, hCPU, hGPU, batch_count, err, NEAR_ASSERT)      \
+    do                                                                                 \
+    {                                                                                  \
+        auto near_result                                                               \
+            = near_check_mismatches(M, N, lda, strideA, hCPU, hGPU, batch_count, err); \
+        if(near_result.mismatches)                                                     \
+        {                                                                              \
+            int64_t offset = lda >= 0 ? 0 : int64_t(lda) * (1 - N);                    \
+            offset += near_result.first_col * int64_t(lda)                             \
+                      + near_result.first_batch * (strideA);                           \
+            size_t idx = offset + near_result.first_row;                               \
+            if(rocblas_isnan(hCPU[idx]))                                               \
+            {                                                                          \
+                ASSERT_TRUE(rocblas_isnan(hGPU[idx]));                                 \
+            }                                                                          \
+            else                                                                       \
+            {                                                                          \
+                NEAR_ASSERT(hCPU[idx], hGPU[idx], err);                                \
+            }                                                                          \
+        }                                                                              \
     } while(0)
 
 // Also used for vectors with lda used for inc, which may be negative
-#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err, NEAR_ASSERT)    \
-    do                                                                        \
-    {                                                                         \
-        for(size_t k = 0; k < batch_count; k++)                               \
-            for(int64_t j = 0; j < N; j++)                                    \
-            {                                                                 \
-                int64_t offset = lda >= 0 ? 0 : int64_t(lda) * (1 - N);       \
-                offset += j * int64_t(lda);                                   \
-                size_t idx = offset;                                          \
-                for(size_t i = 0; i < M; i++)                                 \
-                {                                                             \
-                    if(rocblas_isnan(hCPU[k][i + idx]))                       \
-                    {                                                         \
-                        ASSERT_TRUE(rocblas_isnan(hGPU[k][i + idx]));         \
-                    }                                                         \
-                    else                                                      \
-                    {                                                         \
-                        NEAR_ASSERT(hCPU[k][i + idx], hGPU[k][i + idx], err); \
-                    }                                                         \
-                }                                                             \
-            }                                                                 \
+#define NEAR_CHECK_B(M, N, lda, hCPU, hGPU, batch_count, err, NEAR_ASSERT)            \
+    do                                                                                \
+    {                                                                                 \
+        auto near_result                                                              \
+            = near_check_mismatches_batched(M, N, lda, hCPU, hGPU, batch_count, err); \
+        if(near_result.mismatches)                                                    \
+        {                                                                             \
+            int64_t k      = near_result.first_batch;                                 \
+            int64_t offset = lda >= 0 ? 0 : int64_t(lda) * (1 - N);                   \
+            offset += near_result.first_col * int64_t(lda);                           \
+            size_t idx = offset + near_result.first_row;                              \
+            if(rocblas_isnan(hCPU[k][idx]))                                           \
+            {                                                                         \
+                ASSERT_TRUE(rocblas_isnan(hGPU[k][idx]));                             \
+            }                                                                         \
+            else                                                                      \
+            {                                                                         \
+                NEAR_ASSERT(hCPU[k][idx], hGPU[k][idx], err);                         \
+            }                                                                         \
+        }                                                                             \
     } while(0)
 
 #endif
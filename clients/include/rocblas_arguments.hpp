@@ -87,6 +87,9 @@ struct Arguments
     double beta;
     double betai;
 
+    // relative call frequency of the problem in a rocblas-bench workload
+    double weight;
+
     rocblas_stride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
     rocblas_stride stride_b; //  stride_b > transB == 'N' ? ldb * N : ldb * K
     rocblas_stride stride_c; //  stride_c > ldc * N
@@ -206,6 +209,7 @@ struct Arguments
     OPER(alphai) SEP                 \
     OPER(beta) SEP                   \
     OPER(betai) SEP                  \
+    OPER(weight) SEP                 \
     OPER(stride_a) SEP               \
     OPER(stride_b) SEP               \
     OPER(stride_c) SEP               \
@@ -0,0 +1,682 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include "rocblas_convert.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <type_traits>
+#include <vector>
+
+/*!\file
+ * \brief Comparison of a result (usually the GPU result) with a reference (usually the CPU result)
+ *
+ * rocblas_compare() computes, in one pass over the elements of all the batches, the one,
+ * infinity, max and Frobenius norms of the reference and of the difference, the largest
+ * absolute and ULP errors, and the number and first location of the elements which are not
+ * near enough. The columns are converted to double in blocks, with rocblas_convert_n for the
+ * half, bfloat16 and float8 types, and the blocks are reduced with SIMD loops. The batches,
+ * or the columns of a batch when there are fewer batches than threads, are split across
+ * OpenMP threads.
+ */
+
+//! Number of elements from which comparisons are split across OpenMP threads
+constexpr size_t rocblas_compare_parallel_min = size_t(1) << 16;
+
+//! Which elements of the matrices are compared, and how their norms are computed
+struct rocblas_compare_options
+{
+    //! 'U' or 'L' to compare only the upper or the lower triangle, including the diagonal
+    char uplo = 'N';
+
+    //! The norms are those of the symmetric matrix stored in the uplo triangle
+    bool symmetric = false;
+
+    //! The norms are those of the Hermitian matrix stored in the uplo triangle, whose diagonal
+    //! has no imaginary part
+    bool hermitian = false;
+
+    //! The reference is rounded to the type of the result before it is compared
+    bool round_reference = false;
+
+    //! Elements whose real and imaginary parts differ by at most abs_error, or by at most
+    //! max_ulp units in the last place of the type of the result, match. Where the reference
+    //! is NaN, the result must be NaN.
+    double abs_error = 0;
+    double max_ulp   = 0;
+};
+
+//! Result of rocblas_compare()
+struct rocblas_compare_result
+{
+    //! Largest norm(result - reference) / norm(reference) of the batches, for the one,
+    //! infinity and max norms
+    double one_norm_error = 0;
+    double inf_norm_error = 0;
+    double max_norm_error = 0;
+
+    //! Sum over the batches of norm(result - reference) / norm(reference) for the Frobenius
+    //! norm, which bounds the error of the batches as a whole
+    double frobenius_norm_error = 0;
+
+    //! Largest sum|result - reference| / sum|reference| of the batches
+    double entrywise_error = 0;
+
+    //! Largest absolute error and largest error in units in the last place of an element,
+    //! which is infinite where the result is NaN and the reference is not
+    double max_abs_error = 0;
+    double max_ulp_error = 0;
+
+    //! Number of elements which do not match, and location of the first one in the order of
+    //! the batches, columns and rows, or -1
+    int64_t mismatches  = 0;
+    int64_t first_batch = -1;
+    int64_t first_row   = -1;
+    int64_t first_col   = -1;
+
+    //! The error for the norm_type of LAPACK, 'O', 'I', 'M' or 'F', and 0 for other types
+    double norm_error(char norm_type) const
+    {
+        switch(norm_type)
+        {
+        case 'O':
+        case 'o':
+        case '1':
+            return one_norm_error;
+        case 'I':
+        case 'i':
+            return inf_norm_error;
+        case 'M':
+        case 'm':
+            return max_norm_error;
+        case 'F':
+        case 'f':
+        case 'E':
+        case 'e':
+            return frobenius_norm_error;
+        }
+        return 0;
+    }
+};
+
+namespace rocblas_compare_detail
+{
+    //! Number of rows converted to double at a time
+    constexpr int64_t block = 256;
+
+    template <typename T>
+    using real_t = std::remove_cv_t<decltype(std::real(T{}))>;
+
+    //! Number of explicit significand bits and smallest normal value of the types
+    template <typename T>
+    struct ulp_traits
+    {
+        static constexpr int    digits     = std::numeric_limits<T>::digits - 1;
+        static constexpr double min_normal = double(std::numeric_limits<T>::min());
+    };
+
+    template <>
+    struct ulp_traits<rocblas_half>
+    {
+        static constexpr int    digits     = 10;
+        static constexpr double min_normal = 0x1p-14;
+    };
+
+    template <>
+    struct ulp_traits<rocblas_bfloat16>
+    {
+        static constexpr int    digits     = 7;
+        static constexpr double min_normal = 0x1p-126;
+    };
+
+    template <>
+    struct ulp_traits<rocblas_f8>
+    {
+        static constexpr int    digits     = 3;
+        static constexpr double min_normal = 0x1p-7;
+    };
+
+    template <>
+    struct ulp_traits<rocblas_bf8>
+    {
+        static constexpr int    digits     = 2;
+        static constexpr double min_normal = 0x1p-15;
+    };
+
+    template <typename T>
+    inline double value(const T& x)
+    {
+        if constexpr(rocblas_convert_fast<T>)
+            return double(float(x));
+        else
+            return double(x);
+    }
+
+    //! Distance between x and the next value of type T, or 1 for integers
+    template <typename T>
+    inline double ulp(double x)
+    {
+        if constexpr(std::is_integral<T>{})
+        {
+            return 1;
+        }
+        else
+        {
+            // The power of two of max(|x|, min_normal), which is a normal double
+            double   y = std::max(std::fabs(x), ulp_traits<T>::min_normal);
+            uint64_t bits;
+            memcpy(&bits, &y, sizeof(bits));
+            bits &= 0x7ff0000000000000;
+            memcpy(&y, &bits, sizeof(y));
+            return y * (1.0 / double(uint64_t(1) << ulp_traits<T>::digits));
+        }
+    }
+
+    //! re[i] and im[i] = the parts of src[i] for i < n, with src[i] rounded to R if ROUND
+    template <typename R, bool ROUND, typename T>
+    inline void load(const T* src, int64_t n, double* re, double* im)
+    {
+        if constexpr(rocblas_is_complex<T>)
+        {
+            auto* parts = reinterpret_cast<const real_t<T>*>(src);
+            for(int64_t i = 0; i < n; i++)
+            {
+                re[i] = parts[2 * i];
+                im[i] = parts[2 * i + 1];
+            }
+        }
+        else if constexpr(ROUND && !std::is_same<R, T>{})
+        {
+            for(int64_t i = 0; i < n; i++)
+                re[i] = value(static_cast<R>(src[i]));
+        }
+        else if constexpr(rocblas_convert_fast<T>)
+        {
+            float f[block];
+            rocblas_convert_n(src, f, n);
+            for(int64_t i = 0; i < n; i++)
+                re[i] = f[i];
+        }
+        else
+        {
+            for(int64_t i = 0; i < n; i++)
+                re[i] = double(src[i]);
+        }
+    }
+
+    //! Sums of a thread over some of the columns of a batch
+    struct partial
+    {
+        double  one_err = 0, one_ref = 0; // largest column sums, when not symmetric
+        double  fro_err = 0, fro_ref = 0; // sums of squares
+        double  max_err = 0, max_ref = 0;
+        double  sum_err = 0, sum_ref = 0;
+        double  max_ulp    = 0;
+        int64_t mismatches = 0;
+        int64_t first_row = -1, first_col = -1;
+
+        // Row sums, and column sums when symmetric, without the diagonal in the row sums
+        std::vector<double> row_err, row_ref, col_err, col_ref;
+
+        partial(int64_t M, int64_t N, bool symmetric)
+            : row_err(M)
+            , row_ref(M)
+            , col_err(symmetric ? N : 0)
+            , col_ref(symmetric ? N : 0)
+        {
+        }
+
+        void reset()
+        {
+            one_err = one_ref = 0;
+            fro_err = fro_ref = 0;
+            max_err = max_ref = 0;
+            sum_err = sum_ref = 0;
+            max_ulp           = 0;
+            mismatches        = 0;
+            first_row = first_col = -1;
+            std::fill(row_err.begin(), row_err.end(), 0.0);
+            std::fill(row_ref.begin(), row_ref.end(), 0.0);
+            std::fill(col_err.begin(), col_err.end(), 0.0);
+            std::fill(col_ref.begin(), col_ref.end(), 0.0);
+        }
+
+        //! Adds the sums of another thread over other columns of the batch
+        void merge(const partial& p)
+        {
+            one_err = std::max(one_err, p.one_err);
+            one_ref = std::max(one_ref, p.one_ref);
+            fro_err += p.fro_err;
+            fro_ref += p.fro_ref;
+            max_err = std::max(max_err, p.max_err);
+            max_ref = std::max(max_ref, p.max_ref);
+            sum_err += p.sum_err;
+            sum_ref += p.sum_ref;
+            max_ulp = std::max(max_ulp, p.max_ulp);
+            mismatches += p.mismatches;
+            if(p.first_col >= 0
+               && (first_col < 0 || p.first_col < first_col
+                   || (p.first_col == first_col && p.first_row < first_row)))
+            {
+                first_row = p.first_row;
+                first_col = p.first_col;
+            }
+            for(size_t i = 0; i < row_err.size(); i++)
+            {
+                row_err[i] += p.row_err[i];
+                row_ref[i] += p.row_ref[i];
+            }
+            for(size_t j = 0; j < col_err.size(); j++)
+            {
+                col_err[j] += p.col_err[j];
+                col_ref[j] += p.col_ref[j];
+            }
+        }
+    };
+
+    //! Errors of a batch
+    struct batch
+    {
+        double  one_err, one_ref, inf_err, inf_ref, fro_err, fro_ref, max_err, max_ref;
+        double  sum_err, sum_ref, max_ulp;
+        int64_t mismatches, first_row, first_col;
+    };
+
+    inline batch finish(const partial& p, bool symmetric)
+    {
+        batch b{p.one_err,
+                p.one_ref,
+                0,
+                0,
+                std::sqrt(p.fro_err),
+                std::sqrt(p.fro_ref),
+                p.max_err,
+                p.max_ref,
+                p.sum_err,
+                p.sum_ref,
+                p.max_ulp,
+                p.mismatches,
+                p.first_row,
+                p.first_col};
+
+        if(symmetric)
+        {
+            // Row k of a symmetric matrix is its column k, which is stored as column k of the
+            // triangle and, without the diagonal, as row k of the triangle
+            for(size_t k = 0; k < p.col_err.size(); k++)
+            {
+                b.inf_err = std::max(b.inf_err, p.col_err[k] + p.row_err[k]);
+                b.inf_ref = std::max(b.inf_ref, p.col_ref[k] + p.row_ref[k]);
+            }
+            b.one_err = b.inf_err;
+            b.one_ref = b.inf_ref;
+        }
+        else
+        {
+            for(size_t i = 0; i < p.row_err.size(); i++)
+            {
+                b.inf_err = std::max(b.inf_err, p.row_err[i]);
+                b.inf_ref = std::max(b.inf_ref, p.row_ref[i]);
+            }
+        }
+
+        // The largest elements and sums skip NaN, which the sums of squares keep, as LAPACK
+        if(std::isnan(b.fro_err))
+            b.one_err = b.inf_err = b.max_err = b.sum_err = b.fro_err;
+        if(std::isnan(b.fro_ref))
+            b.one_ref = b.inf_ref = b.max_ref = b.sum_ref = b.fro_ref;
+
+        return b;
+    }
+
+    //! Compares rows [i0, i1) of column j, which is the diagonal element when DIAG
+    template <typename Tc, typename Tg, bool DIAG>
+    void compare_rows(const Tc*                      cpu,
+                      const Tg*                      gpu,
+                      int64_t                        i0,
+                      int64_t                        i1,
+                      int64_t                        j,
+                      const rocblas_compare_options& opt,
+                      double&                        col_err,
+                      double&                        col_ref,
+                      partial&                       p)
+    {
+        constexpr bool complex = rocblas_is_complex<Tg>;
+        using Tu               = std::conditional_t<complex, real_t<Tg>, Tg>;
+
+        const bool   symmetric = opt.symmetric || opt.hermitian;
+        const bool   real_diag = DIAG && opt.hermitian;
+        const double weight    = symmetric && !DIAG ? 2 : 1;
+        const double abs_error = opt.abs_error;
+        const double max_ulp   = opt.max_ulp;
+        const double inf       = std::numeric_limits<double>::infinity();
+
+        double cr[block], ci[block] = {}, gr[block], gi[block] = {};
+
+        for(int64_t i = i0; i < i1; i += block)
+        {
+            int64_t n = std::min(block, i1 - i);
+            if(opt.round_reference)
+                load<Tg, true>(cpu + i, n, cr, ci);
+            else
+                load<Tg, false>(cpu + i, n, cr, ci);
+            load<Tg, false>(gpu + i, n, gr, gi);
+
+            double* row_err = p.row_err.data() + i;
+            double* row_ref = p.row_ref.data() + i;
+
+            double  c_err = 0, c_ref = 0, fro_err = 0, fro_ref = 0, max_err = p.max_err,
+                   max_ref = p.max_ref, max_ulps = p.max_ulp;
+            int64_t mismatches = 0;
+
+#ifdef _OPENMP
+#pragma omp simd reduction(+ : c_err, c_ref, fro_err, fro_ref, mismatches) \
+    reduction(max : max_err, max_ref, max_ulps)
+#endif
+            for(int64_t k = 0; k < n; k++)
+            {
+                double dr = gr[k] - cr[k], di = gi[k] - ci[k];
+                double err, ref;
+                if(complex && !real_diag)
+                {
+                    err = std::sqrt(dr * dr + di * di);
+                    ref = std::sqrt(cr[k] * cr[k] + ci[k] * ci[k]);
+                }
+                else
+                {
+                    err = std::fabs(dr);
+                    ref = std::fabs(cr[k]);
+                }
+
+                c_err += err;
+                c_ref += ref;
+                if(!DIAG)
+                {
+                    row_err[k] += err;
+                    row_ref[k] += ref;
+                }
+                fro_err += weight * err * err;
+                fro_ref += weight * ref * ref;
+                max_err = err > max_err ? err : max_err;
+                max_ref = ref > max_ref ? ref : max_ref;
+
+                bool   c_nan   = cr[k] != cr[k] || ci[k] != ci[k];
+                bool   g_nan   = gr[k] != gr[k] || gi[k] != gi[k];
+                double ulp_r   = std::fabs(dr) / ulp<Tu>(cr[k]);
+                double ulp_i   = complex ? std::fabs(di) / ulp<Tu>(ci[k]) : 0;
+                bool   match_r = std::fabs(dr) <= abs_error || ulp_r <= max_ulp;
+                bool   match_i = !complex || std::fabs(di) <= abs_error || ulp_i <= max_ulp;
+                bool   match   = c_nan ? g_nan : match_r && match_i;
+                double ulps    = ulp_r > ulp_i ? ulp_r : ulp_i;
+                ulps           = c_nan ? (g_nan ? 0 : inf) : ulps == ulps ? ulps : inf;
+
+                max_ulps = ulps > max_ulps ? ulps : max_ulps;
+                mismatches += !match;
+            }
+
+            col_err += c_err;
+            col_ref += c_ref;
+            p.fro_err += fro_err;
+            p.fro_ref += fro_ref;
+            p.sum_err += c_err;
+            p.sum_ref += c_ref;
+            p.max_err = max_err;
+            p.max_ref = max_ref;
+            p.max_ulp = max_ulps;
+            p.mismatches += mismatches;
+
+            // The columns of a thread are compared in order, so its first mismatch is in the
+            // first block which has one
+            if(mismatches && p.first_col < 0)
+            {
+                for(int64_t k = 0; k < n; k++)
+                {
+                    bool c_nan = cr[k] != cr[k] || ci[k] != ci[k];
+                    bool g_nan = gr[k] != gr[k] || gi[k] != gi[k];
+                    auto close = [&](double c, double g) {
+                        double d = std::fabs(g - c);
+                        return d <= abs_error || d / ulp<Tu>(c) <= max_ulp;
+                    };
+                    if(c_nan ? !g_nan : !(close(cr[k], gr[k]) && close(ci[k], gi[k])))
+                    {
+                        p.first_row = i + k;
+                        p.first_col = j;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    //! Compares column j, whose element i is cpu[i] and gpu[i]
+    template <typename Tc, typename Tg>
+    void compare_column(int64_t                        M,
+                        const Tc*                      cpu,
+                        const Tg*                      gpu,
+                        int64_t                        j,
+                        const rocblas_compare_options& opt,
+                        partial&                       p)
+    {
+        int64_t i0 = 0, i1 = M;
+        if(opt.uplo == 'U' || opt.uplo == 'u')
+            i1 = std::min(j + 1, M);
+        else if(opt.uplo == 'L' || opt.uplo == 'l')
+            i0 = std::min(j, M);
+
+        double col_err = 0, col_ref = 0;
+        if((opt.symmetric || opt.hermitian) && j >= i0 && j < i1)
+        {
+            // The elements off the diagonal are also the elements of row j
+            compare_rows<Tc, Tg, false>(cpu, gpu, i0, j, j, opt, col_err, col_ref, p);
+            compare_rows<Tc, Tg, true>(cpu, gpu, j, j + 1, j, opt, col_err, col_ref, p);
+            compare_rows<Tc, Tg, false>(cpu, gpu, j + 1, i1, j, opt, col_err, col_ref, p);
+        }
+        else
+        {
+            compare_rows<Tc, Tg, false>(cpu, gpu, i0, i1, j, opt, col_err, col_ref, p);
+        }
+
+        if(opt.symmetric || opt.hermitian)
+        {
+            p.col_err[j] = col_err;
+            p.col_ref[j] = col_ref;
+        }
+        else
+        {
+            p.one_err = std::max(p.one_err, col_err);
+            p.one_ref = std::max(p.one_ref, col_ref);
+        }
+    }
+
+    //! NaN if either is NaN, otherwise the larger
+    inline double max_nan(double a, double b)
+    {
+        return std::isnan(b) || b > a ? b : a;
+    }
+}
+
+/*! \brief Compares the M x N matrices of batch_count batches of a result with a reference.
+
+    cpu(b) and gpu(b) are pointers to the first elements of the matrices of batch b of the
+    reference and the result, whose columns are ldc and ldg apart. When a leading dimension is
+    negative, as for vectors with a negative increment, the first element is the last one in
+    memory, as in NEAR_CHECK. With symmetric or hermitian options, N must be M.
+*/
+template <typename Tc, typename Tg, typename CPU, typename GPU>
+rocblas_compare_result rocblas_compare_batches(int64_t                        M,
+                                               int64_t                        N,
+                                               CPU&&                          cpu,
+                                               int64_t                        ldc,
+                                               GPU&&                          gpu,
+                                               int64_t                        ldg,
+                                               int64_t                        batch_count,
+                                               const rocblas_compare_options& opt = {})
+{
+    using namespace rocblas_compare_detail;
+
+    rocblas_compare_result result;
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return result;
+
+    const bool    symmetric  = opt.symmetric || opt.hermitian;
+    const int64_t offset_cpu = ldc >= 0 ? 0 : ldc * (1 - N);
+    const int64_t offset_gpu = ldg >= 0 ? 0 : ldg * (1 - N);
+    const size_t  elements  = size_t(M) * N * batch_count;
+#ifdef _OPENMP
+    const int threads = elements >= rocblas_compare_parallel_min ? omp_get_max_threads() : 1;
+#else
+    const int threads = 1;
+#endif
+
+    std::vector<batch> batches(batch_count);
+
+    if(batch_count >= threads)
+    {
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+        {
+            partial p(M, N, symmetric);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for(int64_t b = 0; b < batch_count; b++)
+            {
+                const Tc* c = &cpu(b)[0] + offset_cpu;
+                const Tg* g = &gpu(b)[0] + offset_gpu;
+
+                p.reset();
+                for(int64_t j = 0; j < N; j++)
+                    compare_column(M, c + j * ldc, g + j * ldg, j, opt, p);
+                batches[b] = finish(p, symmetric);
+            }
+        }
+    }
+    else
+    {
+        // Each thread sums the rows of its columns, so there are no more threads than columns
+        const int            col_threads = int(std::min(int64_t(threads), N));
+        std::vector<partial> parts(col_threads, partial(M, N, symmetric));
+
+        for(int64_t b = 0; b < batch_count; b++)
+        {
+            const Tc* c = &cpu(b)[0] + offset_cpu;
+            const Tg* g = &gpu(b)[0] + offset_gpu;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(col_threads)
+#endif
+            {
+#ifdef _OPENMP
+                partial& p = parts[omp_get_thread_num()];
+#else
+                partial& p = parts[0];
+#endif
+                p.reset();
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                for(int64_t j = 0; j < N; j++)
+                    compare_column(M, c + j * ldc, g + j * ldg, j, opt, p);
+            }
+
+            for(int t = 1; t < col_threads; t++)
+                parts[0].merge(parts[t]);
+            batches[b] = finish(parts[0], symmetric);
+        }
+    }
+
+    for(int64_t b = 0; b < batch_count; b++)
+    {
+        const batch& e = batches[b];
+
+        result.one_norm_error  = max_nan(result.one_norm_error, e.one_err / e.one_ref);
+        result.inf_norm_error  = max_nan(result.inf_norm_error, e.inf_err / e.inf_ref);
+        result.max_norm_error  = max_nan(result.max_norm_error, e.max_err / e.max_ref);
+        result.entrywise_error = max_nan(result.entrywise_error, e.sum_err / e.sum_ref);
+        result.frobenius_norm_error += e.fro_err / e.fro_ref;
+        result.max_abs_error = max_nan(result.max_abs_error, e.max_err);
+        result.max_ulp_error = std::max(result.max_ulp_error, e.max_ulp);
+        result.mismatches += e.mismatches;
+        if(e.mismatches && result.first_batch < 0)
+        {
+            result.first_batch = b;
+            result.first_row   = e.first_row;
+            result.first_col   = e.first_col;
+        }
+    }
+
+    return result;
+}
+
+//! Compares strided batches of matrices, stride elements apart
+template <typename Tc, typename Tg>
+rocblas_compare_result rocblas_compare(int64_t                        M,
+                                       int64_t                        N,
+                                       int64_t                        lda,
+                                       rocblas_stride                 stride,
+                                       const Tc*                      hCPU,
+                                       const Tg*                      hGPU,
+                                       int64_t                        batch_count = 1,
+                                       const rocblas_compare_options& opt         = {})
+{
+    return rocblas_compare_batches<Tc, Tg>(
+        M,
+        N,
+        [=](int64_t b) { return hCPU + b * stride; },
+        lda,
+        [=](int64_t b) { return hGPU + b * stride; },
+        lda,
+        batch_count,
+        opt);
+}
+
+//! Compares batches of matrices given by arrays of pointers
+template <typename Tc, typename Tg>
+rocblas_compare_result rocblas_compare(int64_t                        M,
+                                       int64_t                        N,
+                                       int64_t                        lda,
+                                       const Tc* const                hCPU[],
+                                       const Tg* const                hGPU[],
+                                       int64_t                        batch_count,
+                                       const rocblas_compare_options& opt = {})
+{
+    return rocblas_compare_batches<Tc, Tg>(
+        M,
+        N,
+        [=](int64_t b) { return hCPU[b]; },
+        lda,
+        [=](int64_t b) { return hGPU[b]; },
+        lda,
+        batch_count,
+        opt);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*!\file
+ * \brief Bulk conversions between float and the half, bfloat16 and float8 types on the host
+ *
+ * rocblas_convert_n converts n contiguous elements with the same result, bit for bit, as
+ * converting each element with the constructors and conversion operators of the types,
+ * including NaN payloads, the bfloat16 rounding modes and the float8 saturation and
+ * stochastic rounding. Half uses the F16C instructions and bfloat16 uses AVX2 when the CPU
+ * has them, float8 to float uses a table of the 256 values, and arrays of at least
+ * rocblas_convert_parallel_min elements are split across OpenMP threads.
+ */
+
+//! Number of elements from which conversions are split across OpenMP threads
+constexpr size_t rocblas_convert_parallel_min = size_t(1) << 16;
+
+void rocblas_convert_n(const rocblas_half* src, float* dst, size_t n);
+void rocblas_convert_n(const float* src, rocblas_half* dst, size_t n);
+
+void rocblas_convert_n(const rocblas_bfloat16* src, float* dst, size_t n);
+void rocblas_convert_n(const float*                         src,
+                       rocblas_bfloat16*                    dst,
+                       size_t                               n,
+                       rocblas_bfloat16::rocblas_truncate_t round
+                       = rocblas_bfloat16::rocblas_round_near_even);
+
+void rocblas_convert_n(const rocblas_f8* src, float* dst, size_t n);
+void rocblas_convert_n(const rocblas_bf8* src, float* dst, size_t n);
+
+/*! \brief Convert float to float8 as rocblas_f8(src[i], rm, rng[i]) does.
+
+    rng holds the random bits of each element for stochastic rounding, and is not read with
+    standard rounding.
+*/
+void rocblas_convert_n(const float*                             src,
+                       rocblas_f8*                              dst,
+                       size_t                                   n,
+                       rocblas_f8::rocblas_hip_f8_rounding_mode rm
+                       = rocblas_f8::rocblas_hip_f8_rounding_mode::standard,
+                       const uint32_t* rng = nullptr);
+void rocblas_convert_n(const float*                              src,
+                       rocblas_bf8*                              dst,
+                       size_t                                    n,
+                       rocblas_bf8::rocblas_hip_f8_rounding_mode rm
+                       = rocblas_bf8::rocblas_hip_f8_rounding_mode::standard,
+                       const uint32_t* rng = nullptr);
+
+template <typename T>
+constexpr bool rocblas_convert_fast
+    = std::is_same_v<T, rocblas_half> || std::is_same_v<T, rocblas_bfloat16>
+      || std::is_same_v<T, rocblas_f8> || std::is_same_v<T, rocblas_bf8>;
+
+/*! \brief dst[i] = Dst(src[i]) for i < n.
+
+    Conversions between float and the half, bfloat16 and float8 types use the overloads
+    above, and conversions from those types to other types, such as double, go through float.
+*/
+template <typename Src, typename Dst>
+void rocblas_convert_n(const Src* src, Dst* dst, size_t n)
+{
+    if constexpr(std::is_same_v<Src, Dst>)
+    {
+        if(n)
+            memcpy(dst, src, n * sizeof(Dst));
+    }
+    else if constexpr((std::is_same_v<Src, float> && rocblas_convert_fast<Dst>)
+                      || (rocblas_convert_fast<Src> && std::is_same_v<Dst, float>))
+    {
+        rocblas_convert_n(src, dst, n);
+    }
+    else if constexpr(rocblas_convert_fast<Src>)
+    {
+        constexpr size_t block = 4096;
+#pragma omp parallel for schedule(static) if(n >= rocblas_convert_parallel_min)
+        for(size_t i = 0; i < n; i += block)
+        {
+            float  f[block];
+            size_t count = std::min(block, n - i);
+            rocblas_convert_n(src + i, f, count);
+            for(size_t j = 0; j < count; j++)
+                dst[i + j] = Dst(f[j]);
+        }
+    }
+    else
+    {
+#pragma omp parallel for schedule(static) if(n >= rocblas_convert_parallel_min)
+        for(size_t i = 0; i < n; i++)
+            dst[i] = Dst(src[i]);
+    }
+}
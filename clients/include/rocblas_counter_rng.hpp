@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <hip/hip_runtime.h>
+
+/*!\file
+ * \brief Counter-based random numbers for the initialization of test data
+ *
+ * Each value is the Philox4x32-10 function (Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3", SC11) of a seed, a stream and the index of the element, so an element does not
+ * depend on the elements generated before it, on the thread that generates it, or on whether
+ * it is generated on the host or on the device. The functions only use 32-bit integer
+ * arithmetic, so loops over the index vectorize.
+ */
+
+//! A sequence of counter-based random numbers, with one value per index
+struct rocblas_rng_stream
+{
+    uint64_t seed;
+    uint32_t stream;
+};
+
+//! Philox4x32-10 of the counter ctr and the key (k0, k1), in place
+__host__ __device__ inline void rocblas_philox4x32_10(uint32_t ctr[4], uint32_t k0, uint32_t k1)
+{
+    for(int round = 0; round < 10; ++round)
+    {
+        uint64_t p0 = uint64_t(0xD2511F53) * ctr[0];
+        uint64_t p1 = uint64_t(0xCD9E8D57) * ctr[2];
+        uint32_t c1 = ctr[1];
+        uint32_t c3 = ctr[3];
+        ctr[0]      = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        ctr[1]      = uint32_t(p1);
+        ctr[2]      = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        ctr[3]      = uint32_t(p0);
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+}
+
+//! The first 32 bits of the block of random bits of index in s
+__host__ __device__ inline uint32_t rocblas_rng_bits(const rocblas_rng_stream& s, uint64_t index)
+{
+    uint32_t ctr[4] = {uint32_t(index), uint32_t(index >> 32), s.stream, 0};
+    rocblas_philox4x32_10(ctr, uint32_t(s.seed), uint32_t(s.seed >> 32));
+    return ctr[0];
+}
+
+//! An integer in [a, b] from 32 random bits
+__host__ __device__ inline int rocblas_rng_int(uint32_t bits, int a, int b)
+{
+    return a + int((uint64_t(bits) * uint32_t(b - a + 1)) >> 32);
+}
+
+/*! \brief The random numbers of one element
+
+    Successive calls return successive 32-bit words of the Philox blocks of (s, index), four
+    words per block, so a value which needs more than one word, such as a complex number or
+    a rejected NaN, is still a function of the index only.
+*/
+class rocblas_counter_rng
+{
+    uint32_t m_key[2];
+    uint32_t m_ctr[4];
+    uint32_t m_bits[4];
+    int      m_next = 4;
+
+public:
+    __host__ __device__ rocblas_counter_rng(const rocblas_rng_stream& s, uint64_t index)
+        : m_key{uint32_t(s.seed), uint32_t(s.seed >> 32)}
+        , m_ctr{uint32_t(index), uint32_t(index >> 32), s.stream, 0}
+    {
+    }
+
+    //! The next 32 random bits
+    __host__ __device__ uint32_t operator()()
+    {
+        if(m_next == 4)
+        {
+            for(int i = 0; i < 4; ++i)
+                m_bits[i] = m_ctr[i];
+            rocblas_philox4x32_10(m_bits, m_key[0], m_key[1]);
+            ++m_ctr[3];
+            m_next = 0;
+        }
+        return m_bits[m_next++];
+    }
+
+    //! The next 64 random bits
+    __host__ __device__ uint64_t bits64()
+    {
+        uint64_t lo = (*this)();
+        return lo | uint64_t((*this)()) << 32;
+    }
+
+    //! An integer in [a, b]
+    __host__ __device__ int uniform_int(int a, int b)
+    {
+        return rocblas_rng_int((*this)(), a, b);
+    }
+
+    //! A float in [a, b), with 24 random bits
+    __host__ __device__ float uniform_float(float a, float b)
+    {
+        return a + (b - a) * (float((*this)() >> 8) * 0x1p-24f);
+    }
+
+    //! A double in [a, b), with 53 random bits
+    __host__ __device__ double uniform_double(double a, double b)
+    {
+        return a + (b - a) * (double(bits64() >> 11) * 0x1p-53);
+    }
+};
@@ -25,6 +25,7 @@
 #include "rocblas_arguments.hpp"
 #include "test_cleanup.hpp"
 #include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -32,8 +33,10 @@
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -45,6 +48,95 @@ namespace fs = std::experimental::filesystem;
 #error no filesystem found
 #endif
 
+/*! \brief Binary Arguments records of a test data file written by rocblas_gentest.py.
+
+    The file is mapped into memory, or read when it cannot be mapped, e.g. from a pipe. It
+    holds the signature checked by Arguments::validate(), the records, and an index of the
+    numbers of the records of each function:
+
+        uint64_t       function_count
+        index_function functions[function_count]
+        uint64_t       numbers[]      record numbers of each function, in file order
+        index_footer   footer         offset of function_count, and "RBTDIDX"
+
+    The records of files without a valid index are scanned once to build it, so suites find
+    their records without reading the whole file again.
+*/
+class RocBLAS_TestData_File
+{
+public:
+    struct index_function
+    {
+        char     function[sizeof(Arguments::function)];
+        uint64_t first; // position of its first record number
+        uint64_t count;
+    };
+
+    struct index_footer
+    {
+        uint64_t offset;
+        char     magic[8];
+    };
+
+    // Size of the signature before the first record
+    static constexpr size_t signature_size = 8 + sizeof(Arguments) + 8;
+
+    // Map a file, exiting with an error if it cannot be read or is not a valid data file
+    explicit RocBLAS_TestData_File(const std::string& path);
+    ~RocBLAS_TestData_File();
+
+    RocBLAS_TestData_File(const RocBLAS_TestData_File&) = delete;
+    RocBLAS_TestData_File& operator=(const RocBLAS_TestData_File&) = delete;
+
+    // Number of records
+    size_t size() const
+    {
+        return m_records;
+    }
+
+    // Whether the file has a valid index
+    bool indexed() const
+    {
+        return m_indexed;
+    }
+
+    // Copy of record i
+    Arguments operator[](size_t i) const
+    {
+        Arguments arg;
+        memcpy(&arg, m_data + signature_size + i * sizeof(Arguments), sizeof(Arguments));
+        return arg;
+    }
+
+    /*! \brief Numbers of the records, in file order, of the functions accepted by
+        function_filter, which is called with the first record of each function. All records
+        are selected without a filter. */
+    std::vector<size_t> select(bool function_filter(const Arguments&) = nullptr) const;
+
+private:
+    struct function_records
+    {
+        size_t              first; // first record of the function
+        std::vector<size_t> records;
+    };
+
+    const char*                   m_data    = nullptr;
+    size_t                        m_size    = 0;
+    size_t                        m_records = 0;
+    bool                          m_mapped  = false;
+    bool                          m_indexed = false;
+    std::vector<char>             m_buffer; // contents of files which cannot be mapped
+    std::vector<function_records> m_functions;
+
+    void map(const std::string& path);
+    void unmap();
+    bool read_index();
+    void build_index();
+};
+
+// Removes the records which are not in the shard selected by --shard, if any
+void rocblas_shard_select(const RocBLAS_TestData_File& file, std::vector<size_t>& records);
+
 // Class used to read Arguments data into the tests
 class RocBLAS_TestData
 {
@@ -56,29 +148,45 @@ class RocBLAS_TestData
         return filename;
     }
 
-    // filter iterator
-    class iterator : public std::istream_iterator<Arguments>
+    // filter iterator over the records selected by a suite
+    class iterator
     {
-        bool (*const filter)(const Arguments&) = nullptr;
+        const RocBLAS_TestData_File*               file    = nullptr;
+        std::shared_ptr<const std::vector<size_t>> records = nullptr;
+        size_t                                     pos     = 0;
+        Arguments                                  arg{};
+        bool (*filter)(const Arguments&) = nullptr;
+
+        bool at_end() const
+        {
+            return !records || pos >= records->size();
+        }
 
         // Skip entries for which validate or filter returns false
         void skip_filter()
         {
-            static auto endIter = std::istream_iterator<Arguments>{};
-
-            // warning we may update the Arguments in validate, thus the const_cast
-            while(*this != endIter && !(const_cast<Arguments&>(**this).validate()))
-                ++*static_cast<std::istream_iterator<Arguments>*>(this);
-
-            if(filter)
-                while(*this != endIter && !filter(**this))
-                    ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            // we may update the Arguments in validate
+            for(; !at_end(); ++pos)
+            {
+                arg = (*file)[(*records)[pos]];
+                if(arg.validate() && (!filter || filter(arg)))
+                    break;
+            }
         }
 
     public:
-        // Constructor takes a filter and iterator
-        iterator(bool filter(const Arguments&), std::istream_iterator<Arguments> iter)
-            : std::istream_iterator<Arguments>(iter)
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = Arguments;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Arguments*;
+        using reference         = const Arguments&;
+
+        // Constructor takes a filter and the selected records of file
+        iterator(bool filter(const Arguments&),
+                 const RocBLAS_TestData_File& file,
+                 std::vector<size_t>          records)
+            : file(&file)
+            , records(std::make_shared<const std::vector<size_t>>(std::move(records)))
             , filter(filter)
         {
             skip_filter();
@@ -87,18 +195,38 @@ class RocBLAS_TestData
         // Default end iterator and nullptr filter
         iterator() = default;
 
+        const Arguments& operator*() const
+        {
+            return arg;
+        }
+
+        const Arguments* operator->() const
+        {
+            return &arg;
+        }
+
         // Preincrement iterator operator with filtering
         iterator& operator++()
         {
-            ++*static_cast<std::istream_iterator<Arguments>*>(this);
+            ++pos;
             skip_filter();
             return *this;
         }
 
         // We do not need a postincrement iterator operator
-        // We delete it here so that the base class's isn't silently called
+        // We delete it here so that it is not silently used
         // To implement it, use "auto old = *this; ++*this; return old;"
         iterator operator++(int) = delete;
+
+        bool operator==(const iterator& rhs) const
+        {
+            return at_end() ? rhs.at_end() : !rhs.at_end() && pos == rhs.pos;
+        }
+
+        bool operator!=(const iterator& rhs) const
+        {
+            return !(*this == rhs);
+        }
     };
 
 public:
@@ -114,36 +242,24 @@ public:
         }
     }
 
-    // begin() iterator which accepts an optional filter.
-    static iterator begin(bool filter(const Arguments&) = nullptr)
+    // begin() iterator which accepts an optional filter, and an optional function_filter
+    // which depends only on arg.function, used to look up the records in the index
+    static iterator begin(bool filter(const Arguments&)          = nullptr,
+                          bool function_filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        static RocBLAS_TestData_File* file = nullptr;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
-        if(!ifs)
-        {
-            std::string fileToOpen = filename();
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
-            if(!ifs || ifs->fail())
-            {
-                rocblas_cerr << "Cannot open " << fileToOpen << ": " << strerror(errno)
-                             << std::endl;
-                exit(EXIT_FAILURE);
-            }
-        }
-
-        // We re-seek the file back to position 0
-        ifs->clear();
-        ifs->seekg(0);
+        // Allocate the mapped file and register it to be deleted during cleanup
+        if(!file)
+            file = test_cleanup::allocate(&file, filename());
 
-        // Validate the data file format
-        Arguments::validate(*ifs);
+        auto records = file->select(function_filter);
+        rocblas_shard_select(*file, records);
 
         // We create a filter iterator which will choose only the test cases we want right now.
         // This is to preserve Gtest structure while not creating no-op tests which "always pass".
-        return iterator(filter, std::istream_iterator<Arguments>(*ifs));
+        return iterator(filter, *file, std::move(records));
     }
 
     // end() iterator
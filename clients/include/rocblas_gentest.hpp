@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Native expansion of YAML test data into binary Arguments records
+ *
+ * rocblas_gentest() does what rocblas_gentest.py does, without a Python interpreter, and
+ * writes the same bytes: the include: lines, the Datatypes, Arguments, Dictionary lists to
+ * expand, Lists to not expand, Defaults, Known bugs and Functions of each document, the
+ * expansion of lists and A..B[..C] ranges, the dynamic stride and leading dimension defaults,
+ * the removal of duplicate records, and the signature and index of the file.
+ *
+ * The YAML is parsed with the YAML 1.1 scalar rules of PyYAML, for the block and flow
+ * collections, anchors, aliases, merge keys and quoted scalars used by the test data.
+ * Tags and block scalars are not supported.
+ */
+
+//! Version of the expansion, which is part of the key of cached expansions. Increment it when
+//! the records written for the same YAML change.
+constexpr int rocblas_gentest_version = 1;
+
+/*! \brief Expand the YAML file infile into the binary test data file outfile.
+
+    includes are the directories searched for include: files after the directory of the
+    including file, as with -I, and template_file, if not empty, is read before infile, as
+    with --template. Throws std::runtime_error with the diagnostic rocblas_gentest.py would
+    print if the YAML cannot be expanded.
+*/
+void rocblas_gentest(const std::string&              infile,
+                     const std::string&              outfile,
+                     const std::vector<std::string>& includes      = {},
+                     const std::string&              template_file = "");
+
+/*! \brief Expand infile as rocblas_gentest() does, reusing an earlier expansion of the same input.
+
+    The expansion is stored in cache_dir under a name which is a hash of rocblas_gentest_version
+    and the text of template_file, infile and every file they include, so a change to any of
+    them is a new entry. It is written under a temporary name and renamed into place, so that
+    processes sharing cache_dir, such as concurrent test shards, never read a partial file.
+    cache_dir is created with mode 0700 and, on POSIX systems, is only used if it is a
+    directory owned by the user which no one else can write. Beyond 64 entries the least
+    recently used are removed. Returns the path of the data file in cache_dir, or an empty
+    string if cache_dir cannot be created, trusted or written. Throws std::runtime_error if the
+    YAML cannot be expanded.
+*/
+std::string rocblas_gentest_cached(const std::string&              infile,
+                                   const std::string&              cache_dir,
+                                   const std::vector<std::string>& includes      = {},
+                                   const std::string&              template_file = "");
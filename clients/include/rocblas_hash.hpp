@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+//! 128 bits identifying a string of bytes, such as a test record or the source of a cached file
+struct rocblas_hash128
+{
+    uint64_t lo, hi;
+
+    bool operator==(const rocblas_hash128& other) const
+    {
+        return lo == other.lo && hi == other.hi;
+    }
+};
+
+struct rocblas_hash128_hasher
+{
+    size_t operator()(const rocblas_hash128& h) const
+    {
+        return size_t(h.lo);
+    }
+};
+
+inline rocblas_hash128 rocblas_hash_bytes(const std::string& record)
+{
+    auto fmix = [](uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        return k ^ (k >> 33);
+    };
+    auto rotl = [](uint64_t x, int r) { return x << r | x >> (64 - r); };
+
+    uint64_t a = 0x9e3779b97f4a7c15ULL, b = 0xc2b2ae3d27d4eb4fULL ^ record.size();
+    for(size_t i = 0; i < record.size(); i += 8)
+    {
+        uint64_t w = 0;
+        memcpy(&w, record.data() + i, std::min<size_t>(8, record.size() - i));
+        a = rotl(a ^ (w * 0x87c37b91114253d5ULL), 31) * 0x4cf5ad432745937fULL;
+        b = rotl(b + w, 27) * 0x9e3779b97f4a7c15ULL + 0x52dce729;
+    }
+    return {fmix(a ^ b), fmix(b + 0x38495ab5 + a)};
+}
@@ -27,6 +27,7 @@
 #include "rocblas.h"
 #include "rocblas_math.hpp"
 #include "rocblas_random.hpp"
+#include <algorithm>
 #include <cinttypes>
 #include <iostream>
 #ifdef _OPENMP
@@ -61,7 +62,7 @@ typedef enum rocblas_check_nan_init_
 template <typename T>
 void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
                                           const char                uplo,
-                                          T                         rand_gen(),
+                                          T                         rand_gen(rocblas_counter_rng&),
                                           host_vector<T>&           A,
                                           size_t                    M,
                                           size_t                    N,
@@ -69,6 +70,14 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
                                           rocblas_stride            stride      = 0,
                                           int64_t                   batch_count = 1)
 {
+    // Element (i, j) of batch b is a function of the stream and of (b, i, j) only, so the data
+    // does not depend on the number of threads
+    auto rand_at = [&, rng_stream = rocblas_next_rng_stream(), rows = std::max(M, N)](
+                       size_t b, size_t i, size_t j) {
+        rocblas_counter_rng rng(rng_stream, (b * N + j) * rows + i);
+        return rand_gen(rng);
+    };
+
     if(matrix_type == rocblas_client_general_matrix)
     {
         for(size_t b = 0; b < batch_count; b++)
@@ -78,7 +87,7 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value                  = rand_gen();
+                    auto value                  = rand_at(b, i, j);
                     A[i + j * lda + b * stride] = (i ^ j) & 1 ? T(value) : T(negate(value));
                 }
     }
@@ -92,7 +101,7 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
                 for(size_t j = 0; j < N; ++j)
                 {
                     auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : 0) : (j <= i ? rand_gen() : 0);
+                        = (uplo == 'U' ? j >= i : j <= i) ? rand_at(b, i, j) : 0;
                     A[i + j * lda + b * stride] = (i ^ j) & 1 ? T(value) : T(negate(value));
                 }
     }
@@ -101,9 +110,13 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
 template <typename U, typename T>
 void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
                                           const char                uplo,
-                                          T                         rand_gen(),
+                                          T                         rand_gen(rocblas_counter_rng&),
                                           U&                        hA)
 {
+    // Element (i, j) of batch batch_index is a function of the stream and of
+    // (batch_index, i, j) only, so the data does not depend on the number of threads
+    const rocblas_rng_stream rng_stream = rocblas_next_rng_stream();
+
     for(int64_t batch_index = 0; batch_index < hA.batch_count(); ++batch_index)
     {
         auto* A   = hA[batch_index];
@@ -111,6 +124,11 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
         auto  N   = hA.n();
         auto  lda = hA.lda();
 
+        auto rand_at = [&, rows = std::max(M, N)](size_t i, size_t j) {
+            rocblas_counter_rng rng(rng_stream, (batch_index * N + j) * rows + i);
+            return rand_gen(rng);
+        };
+
         if(matrix_type == rocblas_client_general_matrix)
         {
 #ifdef _OPENMP
@@ -119,7 +137,7 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value     = rand_gen();
+                    auto value     = rand_at(i, j);
                     A[i + j * lda] = (i ^ j) & 1 ? T(value) : T(negate(value));
                 }
         }
@@ -131,8 +149,7 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                    auto value     = (uplo == 'U' ? j >= i : j <= i) ? rand_at(i, j) : T(0);
                     A[i + j * lda] = (i ^ j) & 1 ? T(value) : T(negate(value));
                 }
         }
@@ -141,8 +158,17 @@ void rocblas_init_matrix_alternating_sign(rocblas_check_matrix_type matrix_type,
 
 // Initialize vector so adjacent entries have alternating sign.
 template <typename T>
-void rocblas_init_vector_alternating_sign(T rand_gen(), T* x, int64_t N, int64_t incx)
+void rocblas_init_vector_alternating_sign(T rand_gen(rocblas_counter_rng&),
+                                          T*      x,
+                                          int64_t N,
+                                          int64_t incx)
 {
+    // x[j * incx] is a function of the stream and of j only
+    auto rand_at = [&, rng_stream = rocblas_next_rng_stream()](int64_t j) {
+        rocblas_counter_rng rng(rng_stream, j);
+        return rand_gen(rng);
+    };
+
     if(incx < 0)
         x -= (N - 1) * incx;
 
@@ -151,7 +177,7 @@ void rocblas_init_vector_alternating_sign(T rand_gen(), T* x, int64_t N, int64_t
 #endif
     for(int64_t j = 0; j < N; ++j)
     {
-        auto value  = rand_gen();
+        auto value  = rand_at(j);
         x[j * incx] = j & 1 ? T(value) : T(negate(value));
     }
 }
@@ -163,7 +189,7 @@ void rocblas_init_vector_alternating_sign(T rand_gen(), T* x, int64_t N, int64_t
 template <typename T>
 void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
                          const char                uplo,
-                         T                         rand_gen(),
+                         T                         rand_gen(rocblas_counter_rng&),
                          host_vector<T>&           A,
                          size_t                    M,
                          size_t                    N,
@@ -171,6 +197,14 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
                          rocblas_stride            stride      = 0,
                          int64_t                   batch_count = 1)
 {
+    // Element (i, j) of batch b is a function of the stream and of (b, i, j) only, so the data
+    // does not depend on the number of threads
+    auto rand_at = [&, rng_stream = rocblas_next_rng_stream(), rows = std::max(M, N)](
+                       size_t b, size_t i, size_t j) {
+        rocblas_counter_rng rng(rng_stream, (b * N + j) * rows + i);
+        return rand_gen(rng);
+    };
+
     if(matrix_type == rocblas_client_general_matrix)
     {
         for(size_t b = 0; b < batch_count; b++)
@@ -179,7 +213,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
 #endif
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
-                    A[i + j * lda + b * stride] = rand_gen();
+                    A[i + j * lda + b * stride] = rand_at(b, i, j);
     }
     else if(matrix_type == rocblas_client_hermitian_matrix)
     {
@@ -190,7 +224,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_at(b, i, j);
                     if(i == j)
                         A[b * stride + j + i * lda] = std::real(value);
                     else if(uplo == 'U')
@@ -219,7 +253,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_at(b, i, j);
                     if(i == j)
                         A[b * stride + j + i * lda] = value;
                     else if(uplo == 'U')
@@ -249,7 +283,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
                 for(size_t j = 0; j < N; ++j)
                 {
                     auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                        = (uplo == 'U' ? j >= i : j <= i) ? rand_at(b, i, j) : T(0);
                     A[i + j * lda + b * stride] = value;
                 }
     }
@@ -267,8 +301,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
         for(size_t i = 0; i < M; ++i)
             for(size_t j = 0; j < N; ++j)
             {
-                auto value
-                    = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                auto value     = (uplo == 'U' ? j >= i : j <= i) ? rand_at(0, i, j) : T(0);
                 A[i + j * lda] = value;
             }
 
@@ -328,15 +361,25 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
 template <typename U, typename T>
 void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
                          const char                uplo,
-                         T                         rand_gen(),
+                         T                         rand_gen(rocblas_counter_rng&),
                          U&                        hA)
 {
+    // Element (i, j) of batch batch_index is a function of the stream and of
+    // (batch_index, i, j) only, so the data does not depend on the number of threads
+    const rocblas_rng_stream rng_stream = rocblas_next_rng_stream();
+
     for(int64_t batch_index = 0; batch_index < hA.batch_count(); ++batch_index)
     {
         auto* A   = hA[batch_index];
         auto  M   = hA.m();
         auto  N   = hA.n();
         auto  lda = hA.lda();
+
+        auto rand_at = [&, rows = std::max(M, N)](size_t i, size_t j) {
+            rocblas_counter_rng rng(rng_stream, (batch_index * N + j) * rows + i);
+            return rand_gen(rng);
+        };
+
         if(matrix_type == rocblas_client_general_matrix)
         {
 #ifdef _OPENMP
@@ -344,7 +387,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
 #endif
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
-                    A[i + j * lda] = rand_gen();
+                    A[i + j * lda] = rand_at(i, j);
         }
         else if(matrix_type == rocblas_client_hermitian_matrix)
         {
@@ -354,7 +397,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_at(i, j);
                     if(i == j)
                         A[j + i * lda] = std::real(value);
                     else if(uplo == 'U')
@@ -382,7 +425,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < N; ++i)
                 for(size_t j = 0; j <= i; ++j)
                 {
-                    auto value = rand_gen();
+                    auto value = rand_at(i, j);
                     if(i == j)
                         A[j + i * lda] = value;
                     else if(uplo == 'U')
@@ -410,8 +453,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                    auto value     = (uplo == 'U' ? j >= i : j <= i) ? rand_at(i, j) : T(0);
                     A[i + j * lda] = value;
                 }
         }
@@ -429,8 +471,7 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
             for(size_t i = 0; i < M; ++i)
                 for(size_t j = 0; j < N; ++j)
                 {
-                    auto value
-                        = uplo == 'U' ? (j >= i ? rand_gen() : T(0)) : (j <= i ? rand_gen() : T(0));
+                    auto value     = (uplo == 'U' ? j >= i : j <= i) ? rand_at(i, j) : T(0);
                     A[i + j * lda] = value;
                 }
 
@@ -492,8 +533,14 @@ void rocblas_init_matrix(rocblas_check_matrix_type matrix_type,
 // Initialize vectors with rand_int/hpl/NaN values
 
 template <typename T>
-void rocblas_init_vector(T rand_gen(), T* x, int64_t N, int64_t incx)
+void rocblas_init_vector(T rand_gen(rocblas_counter_rng&), T* x, int64_t N, int64_t incx)
 {
+    // x[j * incx] is a function of the stream and of j only
+    auto rand_at = [&, rng_stream = rocblas_next_rng_stream()](int64_t j) {
+        rocblas_counter_rng rng(rng_stream, j);
+        return rand_gen(rng);
+    };
+
     if(incx < 0)
         x -= (N - 1) * incx;
 
@@ -501,7 +548,7 @@ void rocblas_init_vector(T rand_gen(), T* x, int64_t N, int64_t incx)
 #pragma omp parallel for
 #endif
     for(int64_t j = 0; j < N; ++j)
-        x[j * incx] = rand_gen();
+        x[j * incx] = rand_at(j);
 }
 
 /* ============================================================================================ */
@@ -735,19 +782,19 @@ void rocblas_init_vector_trig(T* x, int64_t N, rocblas_stride incx, bool seedRes
 template <typename T>
 void rocblas_init(T* A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    // Column j of batch i_batch is the run of (i_batch * N + j) * M, ... in the stream
+    const rocblas_rng_stream rng_stream = rocblas_next_rng_stream();
+
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
     {
         size_t b_idx = i_batch * stride;
+#ifdef _OPENMP
+#pragma omp parallel for if(M * N > 65536)
+#endif
         for(size_t j = 0; j < N; ++j)
         {
             size_t col_idx = b_idx + j * lda;
-            if(M > 4)
-                random_run_generator<T>(A + col_idx, M);
-            else
-            {
-                for(size_t i = 0; i < M; ++i)
-                    A[col_idx + i] = random_generator<T>();
-            }
+            random_run_generator<T>(A + col_idx, M, rng_stream, (i_batch * N + j) * M);
         }
     }
 }
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_random.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+/*!\file
+ * \brief Random initialization of matrices in device memory
+ *
+ * The counter-based random numbers of a matrix element only depend on its seed, stream and
+ * index, so a large matrix can be generated on the device, without a transfer, with the same
+ * values as rocblas_init_matrix() generates on the host.
+ */
+
+template <typename T, T RAND_GEN(rocblas_counter_rng&)>
+__global__ void rocblas_init_matrix_device_kernel(T*                 A,
+                                                  size_t             M,
+                                                  size_t             N,
+                                                  size_t             lda,
+                                                  rocblas_stride     stride,
+                                                  size_t             batch_count,
+                                                  rocblas_rng_stream s)
+{
+    const size_t rows  = M > N ? M : N;
+    const size_t count = M * N * batch_count;
+    for(size_t k = blockIdx.x * size_t(blockDim.x) + threadIdx.x; k < count;
+        k += size_t(gridDim.x) * blockDim.x)
+    {
+        size_t i = k % M;
+        size_t j = k / M % N;
+        size_t b = k / M / N;
+
+        rocblas_counter_rng rng(s, (b * N + j) * rows + i);
+        A[i + j * lda + b * stride] = RAND_GEN(rng);
+    }
+}
+
+/*! \brief Initialize the general matrices of a strided batch in device memory
+
+    dA receives the values which rocblas_init_matrix(rocblas_client_general_matrix, uplo,
+    RAND_GEN, hA, M, N, lda, stride, batch_count) would give hA if it was called instead, and
+    the next stream of rocblas_next_rng_stream() is used as it would use it. RAND_GEN is one of
+    the __host__ __device__ counter-based generators, such as random_generator<T> or
+    random_hpl_generator<T>.
+*/
+template <typename T, T RAND_GEN(rocblas_counter_rng&)>
+hipError_t rocblas_init_matrix_device(T*             dA,
+                                      size_t         M,
+                                      size_t         N,
+                                      size_t         lda,
+                                      rocblas_stride stride      = 0,
+                                      int64_t        batch_count = 1,
+                                      hipStream_t    stream      = nullptr)
+{
+    const rocblas_rng_stream rng_stream = rocblas_next_rng_stream();
+
+    const size_t count = M * N * batch_count;
+    if(!count)
+        return hipSuccess;
+
+    constexpr int threads = 256;
+    size_t        blocks  = std::min((count - 1) / threads + 1, size_t(65536));
+    hipLaunchKernelGGL((rocblas_init_matrix_device_kernel<T, RAND_GEN>),
+                       dim3(blocks),
+                       dim3(threads),
+                       0,
+                       stream,
+                       dA,
+                       M,
+                       N,
+                       lda,
+                       stride,
+                       size_t(batch_count),
+                       rng_stream);
+    return hipGetLastError();
+}
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "rocblas.h"
+#include "rocblas_counter_rng.hpp"
 #include "rocblas_math.hpp"
 #include <cinttypes>
 #include <random>
@@ -33,19 +34,34 @@
 // Random number generator
 using rocblas_rng_t = std::mt19937;
 
+extern const uint64_t  g_rocblas_seed_value;
 extern rocblas_rng_t   g_rocblas_seed;
 extern std::thread::id g_main_thread_id;
 
 extern thread_local rocblas_rng_t t_rocblas_rng;
 extern thread_local int           t_rocblas_rand_idx;
+extern thread_local uint32_t      t_rocblas_rng_stream;
 
 // optimized helper
 float rocblas_uniform_int_1_10();
 
-void rocblas_uniform_int_1_10_run_float(float* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_double(double* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex* ptr, size_t num);
-void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex* ptr, size_t num);
+// Counter-based runs of index, index + 1, ... in s, which vectorize
+void rocblas_uniform_int_1_10_run_float(float*                    ptr,
+                                        size_t                    num,
+                                        const rocblas_rng_stream& s,
+                                        uint64_t                  index);
+void rocblas_uniform_int_1_10_run_double(double*                   ptr,
+                                         size_t                    num,
+                                         const rocblas_rng_stream& s,
+                                         uint64_t                  index);
+void rocblas_uniform_int_1_10_run_float_complex(rocblas_float_complex*    ptr,
+                                                size_t                    num,
+                                                const rocblas_rng_stream& s,
+                                                uint64_t                  index);
+void rocblas_uniform_int_1_10_run_double_complex(rocblas_double_complex*   ptr,
+                                                 size_t                    num,
+                                                 const rocblas_rng_stream& s,
+                                                 uint64_t                  index);
 
 // For the main thread, we use g_rocblas_seed; for other threads, we start with a different seed but
 // deterministically based on the thread id's hash function.
@@ -56,20 +72,46 @@ inline rocblas_rng_t get_seed()
                                    : rocblas_rng_t(std::hash<std::thread::id>{}(tid));
 }
 
+// The seed of the counter-based generators. Every thread uses the fixed seed, so that the data
+// of a test does not depend on the thread which runs it.
+inline uint64_t rocblas_rng_seed()
+{
+    return g_rocblas_seed_value;
+}
+
+// A new stream of counter-based random numbers for the initialization of one matrix or vector.
+// The streams of a thread are numbered from its last rocblas_seedrand().
+inline rocblas_rng_stream rocblas_next_rng_stream()
+{
+    return {rocblas_rng_seed(), t_rocblas_rng_stream++};
+}
+
 // Reset the seed (mainly to ensure repeatability of failures in a given suite)
 inline void rocblas_seedrand()
 {
-    t_rocblas_rng      = get_seed();
-    t_rocblas_rand_idx = 0;
+    t_rocblas_rng        = get_seed();
+    t_rocblas_rand_idx   = 0;
+    t_rocblas_rng_stream = 0;
 }
 
 /* ============================================================================================ */
 /*! \brief  Random number generator which generates NaN values */
 class rocblas_nan_rng
 {
+    // Counter-based random numbers of one element, or nullptr to use t_rocblas_rng
+    rocblas_counter_rng* m_rng = nullptr;
+
+    // Random integer in [0, max]
+    template <typename UINT_T>
+    UINT_T random_bits(UINT_T max = std::numeric_limits<UINT_T>::max())
+    {
+        return m_rng ? UINT_T(m_rng->bits64() & uint64_t(max))
+                     : std::uniform_int_distribution<UINT_T>{0, max}(t_rocblas_rng);
+    }
+
     // Generate random NaN values
     template <typename T, typename UINT_T, int SIG, int EXP>
-    static T random_nan_data()
+    T random_nan_data()
     {
         static_assert(sizeof(UINT_T) == sizeof(T), "Type sizes do not match");
         union
@@ -78,24 +120,31 @@ class rocblas_nan_rng
             T      fp;
         } x;
         do
-            x.u = std::uniform_int_distribution<UINT_T>{}(t_rocblas_rng);
+            x.u = random_bits<UINT_T>();
         while(!(x.u & (((UINT_T)1 << SIG) - 1))); // Reject Inf (mantissa == 0)
         x.u |= (((UINT_T)1 << EXP) - 1) << SIG; // Exponent = all 1's
         return x.fp; // NaN with random bits
     }
 
 public:
+    rocblas_nan_rng() = default;
+
+    explicit rocblas_nan_rng(rocblas_counter_rng& rng)
+        : m_rng(&rng)
+    {
+    }
+
     // Random integer
     template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
     explicit operator T()
     {
-        return std::uniform_int_distribution<T>{}(t_rocblas_rng);
+        return random_bits<T>();
     }
 
     // Random signed char
     explicit operator signed char()
     {
-        return static_cast<signed char>(std::uniform_int_distribution<int>{}(t_rocblas_rng));
+        return static_cast<signed char>(random_bits<int>());
     }
 
     // Random NaN double
@@ -367,40 +416,6 @@ inline int8_t random_generator<int8_t>()
     return static_cast<int8_t>(std::uniform_int_distribution<unsigned short>(1, 3)(t_rocblas_rng));
 };
 
-/*! \brief  generate a sequence of random number in range [1,2,3,4,5,6,7,8,9,10] */
-template <typename T>
-inline void random_run_generator(T* ptr, size_t num)
-{
-    for(size_t i = 0; i < num; i++)
-    {
-        ptr[i] = random_generator<T>();
-    }
-}
-
-template <>
-inline void random_run_generator<float>(float* ptr, size_t num)
-{
-    rocblas_uniform_int_1_10_run_float(ptr, num);
-};
-
-template <>
-inline void random_run_generator<double>(double* ptr, size_t num)
-{
-    rocblas_uniform_int_1_10_run_double(ptr, num);
-};
-
-template <>
-inline void random_run_generator<rocblas_float_complex>(rocblas_float_complex* ptr, size_t num)
-{
-    rocblas_uniform_int_1_10_run_float_complex(ptr, num);
-};
-
-template <>
-inline void random_run_generator<rocblas_double_complex>(rocblas_double_complex* ptr, size_t num)
-{
-    rocblas_uniform_int_1_10_run_double_complex(ptr, num);
-};
-
 // HPL
 
 /*! \brief  generate a random number in HPL-like [-0.5,0.5] doubles  */
@@ -530,3 +545,188 @@ inline rocblas_bf8 random_zero_one_generator<rocblas_bf8>()
 {
     return rocblas_bf8(float(std::uniform_int_distribution<int>(0, 1)(t_rocblas_rng)));
 }
+
+/* ============================================================================================ */
+/* generate the random number of one element from its counter-based random numbers :*/
+
+/*! \brief  generate a random NaN number */
+template <typename T>
+inline T random_nan_generator(rocblas_counter_rng& rng)
+{
+    return T(rocblas_nan_rng{rng});
+}
+
+/*! \brief  generate a random number in range [1,2,3,4,5,6,7,8,9,10] */
+template <typename T>
+__host__ __device__ inline T random_generator(rocblas_counter_rng& rng)
+{
+    return T(float(rng.uniform_int(1, 10)));
+}
+
+template <>
+__host__ __device__ inline rocblas_float_complex
+    random_generator<rocblas_float_complex>(rocblas_counter_rng& rng)
+{
+    float re = rng.uniform_int(1, 10);
+    return {re, float(rng.uniform_int(1, 10))};
+}
+
+template <>
+__host__ __device__ inline rocblas_double_complex
+    random_generator<rocblas_double_complex>(rocblas_counter_rng& rng)
+{
+    double re = rng.uniform_int(1, 10);
+    return {re, double(rng.uniform_int(1, 10))};
+}
+
+/*! \brief  generate a random number in range [-2,-1,0,1,2] */
+template <>
+__host__ __device__ inline rocblas_half random_generator<rocblas_half>(rocblas_counter_rng& rng)
+{
+    return rocblas_half(float(rng.uniform_int(-2, 2)));
+}
+
+/*! \brief  generate a random number in range [-2,-1,0,1,2] */
+template <>
+__host__ __device__ inline rocblas_bfloat16
+    random_generator<rocblas_bfloat16>(rocblas_counter_rng& rng)
+{
+    return rocblas_bfloat16(float(rng.uniform_int(-2, 2)));
+}
+
+/*! \brief  generate a random number in range [1,2] */
+template <>
+__host__ __device__ inline rocblas_f8 random_generator<rocblas_f8>(rocblas_counter_rng& rng)
+{
+    return rocblas_f8(float(rng.uniform_int(1, 2)));
+}
+
+/*! \brief  generate a random number in range [1,2] */
+template <>
+__host__ __device__ inline rocblas_bf8 random_generator<rocblas_bf8>(rocblas_counter_rng& rng)
+{
+    return rocblas_bf8(float(rng.uniform_int(1, 2)));
+}
+
+/*! \brief  generate a random number in range [1,2,3] */
+template <>
+__host__ __device__ inline int8_t random_generator<int8_t>(rocblas_counter_rng& rng)
+{
+    return int8_t(rng.uniform_int(1, 3));
+}
+
+/*! \brief  generate a random number in HPL-like [-0.5,0.5] doubles  */
+template <typename T>
+__host__ __device__ inline T random_hpl_generator(rocblas_counter_rng& rng)
+{
+    return rng.uniform_double(-0.5, 0.5);
+}
+
+// The normal values of rocblas_bf8 in [-0.5,0.5], 0 and the 60 patterns of each sign up to 0x3C
+template <>
+__host__ __device__ inline rocblas_bf8 random_hpl_generator(rocblas_counter_rng& rng)
+{
+    int         k = rng.uniform_int(-60, 60);
+    rocblas_bf8 x;
+    x.data = k < 0 ? 0x80 | -k : k;
+    return x;
+}
+
+// The normal values of rocblas_f8 in [-0.5,0.5], 0 and the 56 patterns of each sign up to 0x38
+template <>
+__host__ __device__ inline rocblas_f8 random_hpl_generator(rocblas_counter_rng& rng)
+{
+    int        k = rng.uniform_int(-56, 56);
+    rocblas_f8 x;
+    x.data = k < 0 ? 0x80 | -k : k;
+    return x;
+}
+
+template <>
+__host__ __device__ inline rocblas_bfloat16 random_hpl_generator(rocblas_counter_rng& rng)
+{
+    return rocblas_bfloat16(rng.uniform_float(-0.5f, 0.5f));
+}
+
+template <typename T>
+__host__ __device__ inline T random_zero_one_generator(rocblas_counter_rng& rng)
+{
+    return rng.uniform_int(0, 1);
+}
+
+template <>
+__host__ __device__ inline rocblas_half
+    random_zero_one_generator<rocblas_half>(rocblas_counter_rng& rng)
+{
+    return rocblas_half(float(rng.uniform_int(0, 1)));
+}
+
+template <>
+__host__ __device__ inline rocblas_bfloat16
+    random_zero_one_generator<rocblas_bfloat16>(rocblas_counter_rng& rng)
+{
+    return rocblas_bfloat16(float(rng.uniform_int(0, 1)));
+}
+
+template <>
+__host__ __device__ inline rocblas_f8
+    random_zero_one_generator<rocblas_f8>(rocblas_counter_rng& rng)
+{
+    return rocblas_f8(float(rng.uniform_int(0, 1)));
+}
+
+template <>
+__host__ __device__ inline rocblas_bf8
+    random_zero_one_generator<rocblas_bf8>(rocblas_counter_rng& rng)
+{
+    return rocblas_bf8(float(rng.uniform_int(0, 1)));
+}
+
+/*! \brief  generate the numbers of index, index + 1, ..., index + num - 1 in s, in range
+    [1,2,3,4,5,6,7,8,9,10] */
+template <typename T>
+inline void
+    random_run_generator(T* ptr, size_t num, const rocblas_rng_stream& s, uint64_t index)
+{
+    for(size_t i = 0; i < num; i++)
+    {
+        rocblas_counter_rng rng(s, index + i);
+        ptr[i] = random_generator<T>(rng);
+    }
+}
+
+template <>
+inline void random_run_generator<float>(float*                    ptr,
+                                        size_t                    num,
+                                        const rocblas_rng_stream& s,
+                                        uint64_t                  index)
+{
+    rocblas_uniform_int_1_10_run_float(ptr, num, s, index);
+};
+
+template <>
+inline void random_run_generator<double>(double*                   ptr,
+                                         size_t                    num,
+                                         const rocblas_rng_stream& s,
+                                         uint64_t                  index)
+{
+    rocblas_uniform_int_1_10_run_double(ptr, num, s, index);
+};
+
+template <>
+inline void random_run_generator<rocblas_float_complex>(rocblas_float_complex*    ptr,
+                                                        size_t                    num,
+                                                        const rocblas_rng_stream& s,
+                                                        uint64_t                  index)
+{
+    rocblas_uniform_int_1_10_run_float_complex(ptr, num, s, index);
+};
+
+template <>
+inline void random_run_generator<rocblas_double_complex>(rocblas_double_complex*   ptr,
+                                                         size_t                    num,
+                                                         const rocblas_rng_stream& s,
+                                                         uint64_t                  index)
+{
+    rocblas_uniform_int_1_10_run_double_complex(ptr, num, s, index);
+};
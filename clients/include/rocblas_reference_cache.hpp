@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_vector.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief On-disk memoization of the CPU reference results of tests
+ *
+ * rocblas_reference_cached() computes a reference result, such as the gold matrix of a test,
+ * or reads it from the directory named by the ROCBLAS_CLIENT_REFERENCE_CACHE environment
+ * variable, where an earlier run with the same inputs stored it. The key of a result is a hash
+ * of rocblas_reference_cache_version, the rocBLAS version, the host BLAS library, the seed of
+ * the test data, the function and every field of the Arguments record. The test data of a
+ * record is the same on every run, as it is initialized from the seed. As the key does not say
+ * which result of a test it is, a test caches at most one result of each size.
+ *
+ * Results are stored compressed, and written under a temporary name and renamed into place,
+ * so concurrent runs can share the directory. The cache is disabled when the variable is not
+ * set or is 0, and when arg.timing is set, so that CPU times are of the reference itself.
+ */
+
+//! Version of the cached results, which is part of their key. Increment it when the references
+//! or the initialization of their inputs change the results for the same Arguments.
+constexpr int rocblas_reference_cache_version = 1;
+
+//! Uses of the reference cache since the start of the process
+struct rocblas_reference_cache_stats
+{
+    uint64_t hits;         //!< Results read from the cache
+    uint64_t misses;       //!< Results computed, because they were not in the cache
+    uint64_t bytes;        //!< Bytes of the results read from or written to the cache
+    uint64_t stored_bytes; //!< Compressed bytes of the results read from or written to the cache
+};
+
+//! Bytes of a result, whose bytes are grouped by byte of elements of elem_size when compressed
+struct rocblas_reference_block
+{
+    void*  data;
+    size_t size;
+    size_t elem_size;
+};
+
+//! Directory of the reference cache, or "" if it is disabled
+std::string rocblas_reference_cache_dir();
+
+//! Reads the result of arg into blocks, returning whether it was in the cache
+bool rocblas_reference_cache_load(const Arguments&                            arg,
+                                  const std::vector<rocblas_reference_block>& blocks);
+
+//! Stores the result of arg in blocks in the cache
+void rocblas_reference_cache_store(const Arguments&                            arg,
+                                   const std::vector<rocblas_reference_block>& blocks);
+
+rocblas_reference_cache_stats rocblas_reference_cache_statistics();
+
+// Blocks of the host containers of results
+template <typename T>
+constexpr size_t rocblas_reference_elem_size = rocblas_is_complex<T> ? sizeof(T) / 2 : sizeof(T);
+
+template <typename T>
+void rocblas_reference_blocks(std::vector<rocblas_reference_block>& blocks, host_vector<T>& x)
+{
+    blocks.push_back({x.data(), x.size() * sizeof(T), rocblas_reference_elem_size<T>});
+}
+
+template <typename T>
+void rocblas_reference_blocks(std::vector<rocblas_reference_block>& blocks, host_matrix<T>& A)
+{
+    blocks.push_back({A.data(), A.size() * sizeof(T), rocblas_reference_elem_size<T>});
+}
+
+template <typename T>
+void rocblas_reference_blocks(std::vector<rocblas_reference_block>& blocks,
+                              host_strided_batch_matrix<T>&         A)
+{
+    blocks.push_back({A.data(), A.nmemb() * sizeof(T), rocblas_reference_elem_size<T>});
+}
+
+template <typename T>
+void rocblas_reference_blocks(std::vector<rocblas_reference_block>& blocks,
+                              host_batch_matrix<T>&                 A)
+{
+    for(int64_t b = 0; b < A.batch_count(); b++)
+        blocks.push_back({A[b], A.nmemb() * sizeof(T), rocblas_reference_elem_size<T>});
+}
+
+/*! \brief Computes the result in output with ref(), or reads it from the reference cache.
+
+    output is a host container written by ref(), which is not called when the result of arg is
+    in the cache, so ref must have no other effect. The result of ref() is stored in the cache.
+*/
+template <typename U, typename F>
+void rocblas_reference_cached(const Arguments& arg, U& output, F&& ref)
+{
+    std::vector<rocblas_reference_block> blocks;
+    rocblas_reference_blocks(blocks, output);
+
+    if(!rocblas_reference_cache_load(arg, blocks))
+    {
+        ref();
+        rocblas_reference_cache_store(arg, blocks);
+    }
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "rocblas_data.hpp"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*!\file
+ * \brief Sharding of the test data of rocblas-test by the estimated cost of its records
+ *
+ * With --shard i/N, rocblas-test runs shard i of N shards of its test data, whose estimated
+ * costs are balanced by longest processing time first (LPT) scheduling: the records of each
+ * category are assigned in decreasing order of cost to the shard with the least cost so far.
+ * The cost of a record is estimated from its floating point operations and bytes, with the
+ * models of flops.hpp and bytes.hpp, and optionally corrected for each function by the times
+ * of earlier runs, which --timing-log writes and --shard-timing reads. Every shard must be
+ * given the same data and --shard-timing logs, so that they compute the same assignment.
+ */
+
+//! Work of a test, which its estimated cost is computed from
+struct rocblas_test_work
+{
+    double gflops; //!< Floating point operations of all the batches, in billions
+    double gbytes; //!< Bytes of the operands of all the batches, in billions
+};
+
+//! Work of the test of arg, which is 0 for functions without a model
+rocblas_test_work rocblas_test_work_estimate(const Arguments& arg);
+
+//! Estimated cost of a test for work, in seconds on a typical host, before any correction
+double rocblas_test_model_seconds(const rocblas_test_work& work);
+
+//! Estimated costs of tests, corrected by the times of earlier runs
+class rocblas_test_cost_model
+{
+    // Measured and modeled seconds of the tests of each function in the timing logs
+    std::unordered_map<std::string, std::pair<double, double>> m_functions;
+    double                                                     m_measured = 0;
+    double                                                     m_modeled  = 0;
+
+public:
+    //! Learns the times of a log written by --timing-log, returning whether it could be read
+    bool learn(const std::string& log);
+
+    //! Estimated cost of the test of arg, in seconds
+    double operator()(const Arguments& arg) const;
+};
+
+//! Shard of each cost, assigned by longest processing time first scheduling to shards shards
+std::vector<size_t> rocblas_lpt_schedule(const std::vector<double>& costs, size_t shards);
+
+//! Parse the --shard, --shard-timing and --timing-log command-line arguments
+void rocblas_parse_shard(int& argc, char** argv);
+
+//! Writes the time of the test of arg to the log of --timing-log, if any
+void rocblas_log_test_time(const Arguments& arg, double seconds);
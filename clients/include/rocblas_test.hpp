@@ -30,8 +30,10 @@
 #include "argument_model.hpp"
 #include "rocblas.h"
 #include "rocblas_arguments.hpp"
+#include "rocblas_shard.hpp"
 #include "test_cleanup.hpp"
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <cstdio>
 #include <cstring>
@@ -156,17 +158,20 @@ inline void rocblas_expect_status(rocblas_status status, rocblas_status expect)
 // Function which matches Arguments with a category, accounting for arg.known_bug_platforms
 bool match_test_category(const Arguments& arg, const char* category);
 
-// The tests are instantiated by filtering through the RocBLAS_Data stream
+// The tests are instantiated by filtering through the RocBLAS_Data records
 // The filter is by category and by the type_filter() and function_filter()
-// functions in the testclass
+// functions in the testclass, and function_filter() also selects the records
+// of matching functions from the index of the data file
 #define INSTANTIATE_TEST_CATEGORY(testclass, category)                                            \
     INSTANTIATE_TEST_SUITE_P(category,                                                            \
                              testclass,                                                           \
-                             testing::ValuesIn(RocBLAS_TestData::begin([](const Arguments& arg) { \
-                                                   return match_test_category(arg, #category)     \
-                                                          && testclass::function_filter(arg)      \
-                                                          && testclass::type_filter(arg);         \
-                                               }),                                                \
+                             testing::ValuesIn(RocBLAS_TestData::begin(                           \
+                                                   [](const Arguments& arg) {                     \
+                                                       return match_test_category(arg, #category) \
+                                                              && testclass::function_filter(arg)  \
+                                                              && testclass::type_filter(arg);     \
+                                                   },                                             \
+                                                   testclass::function_filter),                   \
                                                RocBLAS_TestData::end()),                          \
                              testclass::PrintToStringParamName());
 
@@ -352,7 +357,21 @@ bool rocblas_client_global_filters(const Arguments& args);
 template <typename TEST, template <typename...> class FILTER>
 class RocBLAS_Test : public testing::TestWithParam<Arguments>
 {
+    // Start of the test, whose time is written to the log of --timing-log
+    std::chrono::steady_clock::time_point m_start;
+
 protected:
+    void SetUp() override
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    void TearDown() override
+    {
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - m_start;
+        rocblas_log_test_time(GetParam(), seconds.count());
+    }
+
     // This template functor returns true if the type arguments are valid.
     // It converts a FILTER specialization to bool to test type matching.
     template <typename... T>
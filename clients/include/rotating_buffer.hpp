@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_arguments.hpp"
+#include "singletons.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+/*!\file
+ * \brief Rotating operand buffers for cold-cache timing in rocblas-bench
+ *
+ * The timed calls cycle through enough copies of their operands that each copy is evicted
+ * from the L2 cache and MALL before it is read again, as operands produced elsewhere in an
+ * application would be. This is the method of Whaley and Castaldo which --flush_malloc_size
+ * applies to gemm_ex and syrk, with the copies sized from the device caches.
+ */
+
+/*! \brief rocblas-bench rotating-buffer options, set from the command line */
+struct rocblas_rotating_buffer_options
+{
+    bool   enabled = false;
+    size_t bytes   = 0; // total size of the copies, 0 is twice the device cache size
+};
+
+void rocblas_set_rotating_buffer(const rocblas_rotating_buffer_options& opt);
+const rocblas_rotating_buffer_options& rocblas_get_rotating_buffer();
+
+/*! \brief Bytes of the L2 cache and MALL (Infinity Cache) of the current device */
+size_t rocblas_device_cache_bytes();
+
+/*! \brief Number of copies of operands totalling operand_bytes to rotate through.
+
+    With rotating buffers enabled the copies cover the --rotating_buffer_size bytes, or twice
+    the device cache size; otherwise they cover arg.flush_malloc_size bytes. Always 1 when
+    arg.timing is not set.
+*/
+size_t rocblas_rotating_buffer_copies(const Arguments& arg, size_t operand_bytes);
+
+/*! \brief Hot-cache time measured alongside the rotating-buffer time */
+struct rocblas_rotating_buffer_result
+{
+    size_t copies = 1;
+    double hot_us = 0; // total over arg.iters calls, as gpu_time_used
+};
+
+// Result of the last timed hot loop on this thread, consumed when logged
+void rocblas_rotating_buffer_set_result(const rocblas_rotating_buffer_result& result);
+void rocblas_rotating_buffer_clear_result();
+bool rocblas_rotating_buffer_take_result(rocblas_rotating_buffer_result& result);
+
+/*! \brief Copies of a contiguous device operand such as device_matrix, device_vector or their
+    strided batched forms. Copy 0 is the operand itself, the others are allocated and filled
+    from it by init(). */
+template <typename T>
+class rocblas_rotating_copies
+{
+public:
+    template <typename U>
+    rocblas_rotating_copies(U& operand, size_t copies)
+        : m_data(static_cast<T*>(operand))
+        , m_nmemb(operand.nmemb())
+        , m_copies(std::max<size_t>(copies, 1))
+    {
+    }
+
+    rocblas_rotating_copies(const rocblas_rotating_copies&) = delete;
+    rocblas_rotating_copies& operator=(const rocblas_rotating_copies&) = delete;
+
+    ~rocblas_rotating_copies()
+    {
+        if(m_extra)
+            (void)d_vector_free(m_extra);
+    }
+
+    hipError_t init()
+    {
+        if(m_copies < 2 || !m_nmemb)
+            return hipSuccess;
+
+        size_t     bytes  = m_nmemb * sizeof(T);
+        hipError_t status
+            = d_vector_malloc(reinterpret_cast<void**>(&m_extra), bytes * (m_copies - 1));
+        for(size_t c = 1; status == hipSuccess && c < m_copies; c++)
+            status = hipMemcpy((*this)[c], m_data, bytes, hipMemcpyDeviceToDevice);
+        return status;
+    }
+
+    T* operator[](size_t copy)
+    {
+        return copy && m_extra ? m_extra + (copy - 1) * m_nmemb : m_data;
+    }
+
+private:
+    T*     m_data;
+    size_t m_nmemb;
+    size_t m_copies;
+    T*     m_extra = nullptr;
+};
+
+/*! \brief Copies of a device_batch_matrix or device_batch_vector operand, each with its own
+    device array of batch pointers. Copy 0 is the operand itself. offset is the offset given
+    to the device_batch_matrix constructor. */
+template <typename T>
+class rocblas_rotating_batch_copies
+{
+public:
+    template <typename U>
+    rocblas_rotating_batch_copies(U& operand, size_t copies, size_t offset = 0)
+        : m_ptrs(operand.ptr_on_device())
+        , m_nmemb(operand.nmemb())
+        , m_copies(std::max<size_t>(copies, 1))
+        , m_offset(offset)
+    {
+        // The batches are parts of a single allocation starting at batch 0
+        for(int64_t b = 0; b < operand.batch_count(); b++)
+            m_batch_offsets.push_back(operand[b] - operand[0]);
+        m_base = operand.batch_count() > 0 ? operand[0] : nullptr;
+    }
+
+    rocblas_rotating_batch_copies(const rocblas_rotating_batch_copies&) = delete;
+    rocblas_rotating_batch_copies& operator=(const rocblas_rotating_batch_copies&) = delete;
+
+    ~rocblas_rotating_batch_copies()
+    {
+        if(m_extra)
+            (void)d_vector_free(m_extra);
+        if(m_extra_ptrs)
+            (void)d_vector_free(m_extra_ptrs);
+    }
+
+    hipError_t init()
+    {
+        size_t batch_count = m_batch_offsets.size();
+        if(m_copies < 2 || !m_nmemb || !batch_count)
+            return hipSuccess;
+
+        size_t     bytes  = m_nmemb * sizeof(T);
+        hipError_t status
+            = d_vector_malloc(reinterpret_cast<void**>(&m_extra), bytes * (m_copies - 1));
+        if(status == hipSuccess)
+            status = d_vector_malloc(reinterpret_cast<void**>(&m_extra_ptrs),
+                                     sizeof(T*) * batch_count * (m_copies - 1));
+
+        std::vector<T*> ptrs;
+        for(size_t c = 1; status == hipSuccess && c < m_copies; c++)
+        {
+            T* copy = m_extra + (c - 1) * m_nmemb;
+            status  = hipMemcpy(copy, m_base, bytes, hipMemcpyDeviceToDevice);
+            for(auto batch_offset : m_batch_offsets)
+                ptrs.push_back(copy + batch_offset + m_offset);
+        }
+        if(status == hipSuccess)
+            status = hipMemcpy(
+                m_extra_ptrs, ptrs.data(), sizeof(T*) * ptrs.size(), hipMemcpyHostToDevice);
+        return status;
+    }
+
+    T** operator[](size_t copy)
+    {
+        return copy && m_extra_ptrs ? m_extra_ptrs + (copy - 1) * m_batch_offsets.size() : m_ptrs;
+    }
+
+private:
+    T**                  m_ptrs;
+    T*                   m_base = nullptr;
+    size_t               m_nmemb;
+    size_t               m_copies;
+    size_t               m_offset;
+    std::vector<int64_t> m_batch_offsets;
+    T*                   m_extra      = nullptr;
+    T**                  m_extra_ptrs = nullptr;
+};
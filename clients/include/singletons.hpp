@@ -20,7 +20,20 @@
  *
  * ************************************************************************ */
 
+#pragma once
+
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+
 // global for device memory padding see d_vector.hpp
 
 extern size_t g_DVEC_PAD;
 void          d_vector_set_pad_length(size_t pad);
+
+// Device memory used by d_vector. When the cache is enabled, freed blocks are kept and reused
+// by later allocations on the same device of at most their size, so repeated runs of a
+// benchmark with varying sizes do not pay for hipMalloc/hipFree each time. Cached blocks are
+// released when an allocation fails and when the cache is disabled.
+hipError_t d_vector_malloc(void** ptr, size_t bytes);
+hipError_t d_vector_free(void* ptr);
+void       d_vector_set_cache(bool enable);
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*!\file
+ * \brief Summary statistics of per-iteration benchmark timings
+ */
+
+/*! \brief Distribution of per-iteration times, in microseconds */
+struct rocblas_timing_statistics
+{
+    size_t samples = 0;
+    double min     = 0;
+    double median  = 0;
+    double p90     = 0;
+    double p99     = 0;
+    double max     = 0;
+    double mean    = 0;
+    double stddev  = 0;
+
+    // bootstrap confidence interval of the mean
+    double ci_low  = 0;
+    double ci_high = 0;
+
+    // per-iteration times in call order, only kept with keep_values in the options
+    std::vector<double> values;
+
+    // half width of the confidence interval relative to the mean
+    double ci_relative_half_width() const
+    {
+        return mean > 0 ? (ci_high - ci_low) / (2 * mean) : 0;
+    }
+};
+
+/*! \brief Percentile p in [0, 1] of sorted values, linearly interpolated between closest ranks */
+double rocblas_timing_percentile(const std::vector<double>& sorted, double p);
+
+/*! \brief Summarize samples, with a percentile bootstrap interval of the mean at the given confidence.
+    The resampling uses a fixed seed so that the interval is reproducible for the same samples. */
+rocblas_timing_statistics rocblas_timing_summarize(std::vector<double> samples,
+                                                   double              confidence = 0.95,
+                                                   int                 resamples  = 1000,
+                                                   uint64_t            seed       = 0x5eed);
+
+/*! \brief rocblas-bench per-iteration timing options, set from the command line */
+struct rocblas_iteration_timing_options
+{
+    bool   enabled     = false;
+    double ci_target   = 0; // stop when the relative CI half width is below this, 0 runs iters once
+    double confidence  = 0.95;
+    double time_budget = 0; // seconds, 0 is unlimited
+    size_t max_samples = 20000;
+    bool   keep_values = false; // report every per-iteration time, e.g. for significance tests
+};
+
+void rocblas_set_iteration_timing(const rocblas_iteration_timing_options& opt);
+const rocblas_iteration_timing_options& rocblas_get_iteration_timing();
+
+// Statistics of the last timed hot loop on this thread, consumed when logged
+void rocblas_iteration_timing_set_result(const rocblas_timing_statistics& stats);
+void rocblas_iteration_timing_clear_result();
+bool rocblas_iteration_timing_take_result(rocblas_timing_statistics& stats);
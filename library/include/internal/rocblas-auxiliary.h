@@ -367,6 +367,11 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_start_stop_events(rocblas_handle handl
 ROCBLAS_EXPORT rocblas_status rocblas_set_solution_fitness_query(rocblas_handle handle,
                                                                  double*        fitness);
 
+// For reporting the index of the Tensile solution selected by the last gemm-based call, in
+// the numbering of rocblas_gemm_ex_get_solutions, or 0 if none -- for internal testing only
+ROCBLAS_EXPORT rocblas_status rocblas_set_solution_index_query(rocblas_handle handle,
+                                                               rocblas_int*   index);
+
 /*! \brief specifies the performance metric that solution selection uses
      \details
     Determines which performance metric will be used by Tensile when selecting the optimal solution
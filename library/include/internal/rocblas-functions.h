@@ -19726,6 +19726,82 @@ ROCBLAS_EXPORT const char* rocblas_status_to_string(rocblas_status status);
  ******************************************************************************/
 ROCBLAS_EXPORT void rocblas_initialize(void);
 
+/*! \brief Start initializing rocBLAS on a list of HIP devices in the background.
+    \details
+
+    Calling `rocblas_initialize_async()` starts the same initialization as `rocblas_initialize()` on a
+    background thread for each requested device, and returns immediately. Functions which do not need
+    these initializations can be called while they are in progress. A function which needs them on a
+    device (mainly GEMM) waits only for the initialization of that device to complete.
+
+    Devices which are already initialized, or for which initialization was already requested, are
+    skipped.
+
+    @param[in]
+    options   pointer to a rocblas_initialize_options structure listing the devices to initialize,
+              or NULL to initialize all HIP devices.
+
+    @return rocblas_status_success if initialization was started,
+            rocblas_status_invalid_value if a device ID is out of range.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_initialize_async(const rocblas_initialize_options* options);
+
+/*! \brief Query the progress of initialization started by rocblas_initialize_async.
+    \details
+
+    @param[out]
+    devices_initialized   number of requested devices whose initialization has completed.
+
+    @param[out]
+    devices_requested     number of devices for which initialization has been requested.
+
+    @return rocblas_status_success, or rocblas_status_invalid_pointer if either pointer is NULL.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_initialize_query(int* devices_initialized,
+                                                       int* devices_requested);
+
+/*! \brief Wait for all initialization started by rocblas_initialize_async to complete.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_initialize_wait(void);
+
+/*! \brief Restrict the Tensile sub-libraries loaded to a list of data type and transposition combinations.
+    \details
+
+    By default, initialization preloads the Tensile library metadata and, when `rocblas_initialize()`
+    is called, the code objects for every problem type. With a filter, initialization only loads the
+    lazy-loading sub-libraries of the listed combinations, and `rocblas_initialize()` only loads their
+    code objects. Functions which call gemm, including those which use it internally such as trsm,
+    return rocblas_status_not_implemented for problem types which are not listed, and for types such
+    as float8 which cannot be listed. The filter can also be set with the environment variable
+    ROCBLAS_TENSILE_LOAD_FILTER. It must be set before the first function which initializes Tensile.
+
+    @param[in]
+    filter    comma-separated list of entries of the form `<Ti><To><Tc>[_<transA><transB>]`, for example
+              "HHS_NN,HHS_NT,BSS". Ti, To and Tc are the input, output and compute types, each one of
+              H, B, S, D, C, Z, I8 or I. transA and transB are N, T or C; when omitted, all
+              transpositions match. NULL or an empty string removes the filter.
+
+    @return rocblas_status_success, or rocblas_status_invalid_value if the filter cannot be parsed or
+            Tensile is already initialized.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_tensile_load_filter(const char* filter);
+
+/*! \brief Report statistics of the Tensile library and code object files loaded by rocBLAS.
+    \details
+
+    Files loaded lazily by Tensile are counted when they are loaded: the sub-libraries during
+    initialization, and the code objects of a problem type when it is first used.
+
+    @param[out]
+    stats     pointer to a rocblas_tensile_load_stats structure.
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats);
+
 /*
  * ===========================================================================
  *    build information
@@ -19849,6 +19925,43 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle hand
  ******************************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size);
 
+/*! \brief
+    \details
+    Sets the memory pool from which the handle makes stream-ordered allocations
+    of its device workspace, enabling stream-ordered allocation for the handle.
+
+    Any previously allocated device memory managed by the handle is freed.
+    The release threshold (hipMemPoolAttrReleaseThreshold) configured on the pool by the user
+    controls how much memory is retained by the pool between calls.
+    All temporary device memory required by a rocBLAS function is reserved with at most one
+    allocation from the pool, so rocBLAS functions using the pool can be captured in hipGraphs.
+
+    If pool is nullptr, stream-ordered allocations are made from the device's default memory pool.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_value if
+    pool is not readable and writable by the device of the handle; rocblas_status_not_implemented if
+    stream-ordered allocation is not supported by HIP; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    pool            memory pool on the device of the handle, or nullptr
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_stream_order_memory_pool(rocblas_handle handle,
+                                                                   hipMemPool_t   pool);
+
+/*! \brief
+    \details
+    Gets the memory pool set by \ref rocblas_set_stream_order_memory_pool.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if pool is nullptr; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[out]
+    pool            memory pool of the handle, or nullptr if the device's default memory pool is used
+
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_stream_order_memory_pool(rocblas_handle handle,
+                                                                   hipMemPool_t*  pool);
+
 /*! \brief
     \details
     Returns true when device memory in handle is managed by rocBLAS
@@ -67,6 +67,9 @@ typedef struct ihipStream_t* hipStream_t;
 /*! \brief Forward declaration of hipEvent_t */
 typedef struct ihipEvent_t* hipEvent_t;
 
+/*! \brief Forward declaration of hipMemPool_t */
+typedef struct ihipMemPoolHandle_t* hipMemPool_t;
+
 /*! \brief Opaque base class for device memory allocation */
 struct rocblas_device_malloc_base;
 
@@ -343,4 +346,30 @@ typedef enum rocblas_math_mode_
 
 } rocblas_math_mode;
 
+/*! \brief Options for background initialization with rocblas_initialize_async */
+typedef struct rocblas_initialize_options_
+{
+    /*! \brief HIP device IDs to initialize, or NULL to initialize all devices */
+    const int* devices;
+
+    /*! \brief Number of entries in devices */
+    int device_count;
+} rocblas_initialize_options;
+
+/*! \brief Statistics of the Tensile library files loaded, reported by rocblas_get_tensile_load_stats */
+typedef struct rocblas_tensile_load_stats_
+{
+    /*! \brief Number of library and code object files loaded by rocBLAS, including lazily loaded files */
+    int64_t files_loaded;
+
+    /*! \brief Number of code object files skipped by the Tensile load filter */
+    int64_t files_skipped;
+
+    /*! \brief Total size in bytes of the files loaded */
+    int64_t bytes_loaded;
+
+    /*! \brief Wall time spent initializing Tensile, summed over devices, in milliseconds */
+    double load_time_ms;
+} rocblas_tensile_load_stats;
+
 #endif /* ROCBLAS_TYPES_H */
@@ -23,6 +23,7 @@
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
+#include "rocblas_graph_cache.hpp"
 #include "utility.hpp"
 
 namespace
@@ -110,12 +111,6 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        auto w_mem = handle->device_malloc(dev_bytes);
-        if(!w_mem)
-            return rocblas_status_memory_error;
-
-        auto w_completed_sec = w_mem[0];
-
         auto check_numerics = handle->check_numerics;
 
         if(check_numerics)
@@ -141,21 +136,36 @@ namespace
                 return trsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_trsv_template(handle,
-                                                               uplo,
-                                                               transA,
-                                                               diag,
-                                                               n,
-                                                               A,
-                                                               0,
-                                                               lda,
-                                                               0,
-                                                               B,
-                                                               0,
-                                                               incx,
-                                                               0,
-                                                               1,
-                                                               (rocblas_int*)w_completed_sec);
+        //kernel functions are enclosed inside the lambda so that the launch sequence can be replayed
+        //from a cached graph when ROCBLAS_GRAPH_REPLAY is set.
+        auto launch = [&]() -> rocblas_status {
+            auto w_mem = handle->device_malloc(dev_bytes);
+            if(!w_mem)
+                return rocblas_status_memory_error;
+
+            auto w_completed_sec = w_mem[0];
+
+            return rocblas_internal_trsv_template(handle,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  n,
+                                                  A,
+                                                  0,
+                                                  lda,
+                                                  0,
+                                                  B,
+                                                  0,
+                                                  incx,
+                                                  0,
+                                                  1,
+                                                  (rocblas_int*)w_completed_sec);
+        };
+
+        rocblas_graph_key key(handle, rocblas_trsv_name<T>);
+        key.add_shape(uplo, transA, diag, n, lda, incx).add_args(A, B);
+
+        rocblas_status status = rocblas_graph_replay(handle, key, launch);
 
         if(status != rocblas_status_success)
             return status;
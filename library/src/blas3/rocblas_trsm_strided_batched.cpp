@@ -24,6 +24,7 @@
 #include "logging.hpp"
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
+#include "rocblas_graph_cache.hpp"
 #include "rocblas_trmm.hpp"
 #include "rocblas_trsm.hpp"
 #include "trtri_trsm.hpp"
@@ -205,8 +206,9 @@ namespace
         //////////////////////
         // MEMORY MANAGEMENT//
         //////////////////////
-        //kernel function is enclosed inside the brackets so that the handle device memory used by the kernel is released after the computation.
-        {
+        //kernel functions are enclosed inside the lambda so that the handle device memory used by the kernels is released after the computation,
+        //and so that the launch sequence can be replayed from a cached graph when ROCBLAS_GRAPH_REPLAY is set.
+        auto launch = [&]() -> rocblas_status {
             // Proxy object holds the allocation. It must stay alive as long as mem_* pointers below are alive.
             auto  w_mem = handle->device_malloc(0);
             void* w_mem_x_temp;
@@ -260,10 +262,21 @@ namespace
                                                     supplied_invA_size,
                                                     0,
                                                     stride_invA);
-            status = (status != rocblas_status_success) ? status : perf_status;
-            if(status != rocblas_status_success)
-                return status;
-        }
+            return (status != rocblas_status_success) ? status : perf_status;
+        };
+
+        // alpha is only dereferenced in host pointer mode, the only mode in which graphs are replayed
+        rocblas_graph_key key(handle, rocblas_trsm_name<T>);
+        key.add_shape(side, uplo, transA, diag, m, n, lda, ldb, stride_A, stride_B, batch_count)
+            .add_shape(supplied_invA_size, stride_invA)
+            .add_args(handle->pointer_mode == rocblas_pointer_mode_host ? *alpha : T(0),
+                      A,
+                      B,
+                      supplied_invA);
+
+        status = rocblas_graph_replay(handle, key, launch);
+        if(status != rocblas_status_success)
+            return status;
 
         if(check_numerics)
         {
@@ -23,6 +23,7 @@
 #include "rocblas_trtri.hpp"
 #include "logging.hpp"
 #include "rocblas_block_sizes.h"
+#include "rocblas_graph_cache.hpp"
 #include "utility.hpp"
 
 namespace
@@ -84,10 +85,6 @@ namespace
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
-        auto w_mem = handle->device_malloc(size);
-        if(!w_mem)
-            return rocblas_status_memory_error;
-
         if(check_numerics)
         {
             bool           is_input = true;
@@ -109,23 +106,36 @@ namespace
                 return trtri_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_trtri_template(handle,
-                                                                uplo,
-                                                                diag,
-                                                                n,
-                                                                A,
-                                                                0,
-                                                                lda,
-                                                                lda * n,
-                                                                0,
-                                                                invA,
-                                                                0,
-                                                                ldinvA,
-                                                                ldinvA * n,
-                                                                0,
-                                                                1,
-                                                                1,
-                                                                (T*)w_mem);
+        //kernel functions are enclosed inside the lambda so that the launch sequence can be replayed
+        //from a cached graph when ROCBLAS_GRAPH_REPLAY is set.
+        auto launch = [&]() -> rocblas_status {
+            auto w_mem = handle->device_malloc(size);
+            if(!w_mem)
+                return rocblas_status_memory_error;
+
+            return rocblas_internal_trtri_template(handle,
+                                                   uplo,
+                                                   diag,
+                                                   n,
+                                                   A,
+                                                   0,
+                                                   lda,
+                                                   lda * n,
+                                                   0,
+                                                   invA,
+                                                   0,
+                                                   ldinvA,
+                                                   ldinvA * n,
+                                                   0,
+                                                   1,
+                                                   1,
+                                                   (T*)w_mem);
+        };
+
+        rocblas_graph_key key(handle, rocblas_trtri_name<T>);
+        key.add_shape(uplo, diag, n, lda, ldinvA).add_args(A, invA);
+
+        rocblas_status status = rocblas_graph_replay(handle, key, launch);
 
         if(status != rocblas_status_success)
             return status;
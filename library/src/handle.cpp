@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 #include "handle.hpp"
+#include "rocblas_graph_cache.hpp"
 #include <cstdarg>
 #include <limits>
 #ifdef WIN32
@@ -31,6 +32,38 @@
 // see TensileHost.cpp for normal rocblas_initialize definition
 // it isn't compiled if not BUILD_WITH_TENSILE so defining here
 extern "C" void rocblas_initialize() {}
+
+extern "C" rocblas_status rocblas_initialize_async(const rocblas_initialize_options* options)
+{
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_initialize_query(int* devices_initialized,
+                                                   int* devices_requested)
+{
+    if(!devices_initialized || !devices_requested)
+        return rocblas_status_invalid_pointer;
+    *devices_initialized = *devices_requested = 0;
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_initialize_wait()
+{
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_set_tensile_load_filter(const char* filter)
+{
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats)
+{
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+    *stats = {};
+    return rocblas_status_success;
+}
 #endif
 
 // forcing early cleanup
@@ -163,6 +196,16 @@ _rocblas_handle::_rocblas_handle()
         stream_order_alloc             = stream_order_alloc_env_val ? true : false;
     }
 
+    //ROCBLAS_GRAPH_REPLAY
+    const char* graph_replay_env = read_env("ROCBLAS_GRAPH_REPLAY");
+
+    if(graph_replay_env)
+    {
+        size_t graph_replay_env_val = strtoul(graph_replay_env, nullptr, 0);
+        if(graph_replay_env_val)
+            graph_cache = std::make_unique<rocblas_graph_cache>(graph_replay_env_val);
+    }
+
     // Device memory size
     const char* env = read_env("ROCBLAS_DEVICE_MEMORY_SIZE");
     if(env)
@@ -268,6 +311,10 @@ _rocblas_handle::~_rocblas_handle()
                 rocblas_abort();
             };
 
+            // Memory pools provided by the user are left as configured by the user
+            if(stream_order_mem_pool)
+                return;
+
             hipMemPool_t mem_pool;
             int          device;
             hipStatus = hipGetDevice(&device);
@@ -518,6 +565,75 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Set the memory pool used for stream order allocation
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_stream_order_memory_pool(rocblas_handle handle,
+                                                               hipMemPool_t   pool)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+    // The pool must allocate memory on the handle's device
+    if(pool)
+    {
+        hipMemLocation location = {};
+        location.type           = hipMemLocationTypeDevice;
+        location.id             = handle->getDevice();
+
+        hipMemAccessFlags access = hipMemAccessFlagsProtNone;
+        if(hipMemPoolGetAccess(&access, pool, &location) != hipSuccess
+           || access != hipMemAccessFlagsProtReadWrite)
+            return rocblas_status_invalid_value;
+    }
+
+    // Temporarily change the thread's default device ID to the handle's device ID
+    auto saved_device_id = handle->push_device_id();
+
+    // Free any allocated memory unless owned by user, and set device memory to
+    // the default of being rocBLAS-managed
+    rocblas_status status = free_existing_device_memory(handle);
+    if(status != rocblas_status_success)
+        return status;
+
+    // Workspace is allocated from the pool on demand by each call
+    handle->stream_order_alloc      = true;
+    handle->stream_order_mem_pool   = pool;
+    handle->stream_order_high_water = 0;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the memory pool used for stream order allocation
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_stream_order_memory_pool(rocblas_handle handle,
+                                                               hipMemPool_t*  pool)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+    *pool = handle->stream_order_mem_pool;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Returns whether device memory is rocblas-managed
  ******************************************************************************/
@@ -783,6 +899,20 @@ extern "C" rocblas_status rocblas_set_solution_fitness_query(rocblas_handle hand
     return rocblas_status_success;
 }
 
+/*******************************************************************************
+ * Selected solution index query, for internal testing only
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_solution_index_query(rocblas_handle handle,
+                                                           rocblas_int*   index)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->solution_index_query = index;
+    if(index)
+        *index = 0;
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * Choose performance metric used to select solution
  ******************************************************************************/
@@ -26,6 +26,7 @@
 #include "rocblas.h"
 #include "rocblas_ostream.hpp"
 #include "utility.hpp"
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <hip/hip_runtime.h>
@@ -98,6 +99,9 @@ enum class Processor : int
 // helper function in handle.cpp
 static rocblas_status free_existing_device_memory(rocblas_handle);
 
+// cache of captured launch sequences in rocblas_graph_cache.hpp
+class rocblas_graph_cache;
+
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
  * It must be initialized using rocblas_create_handle() and the returned handle mus
@@ -269,12 +273,15 @@ public:
     friend rocblas_status(::rocblas_set_device_memory_size)(_rocblas_handle*, size_t);
     friend rocblas_status(::free_existing_device_memory)(rocblas_handle);
     friend rocblas_status(::rocblas_set_workspace)(_rocblas_handle*, void*, size_t);
+    friend rocblas_status(::rocblas_set_stream_order_memory_pool)(_rocblas_handle*, hipMemPool_t);
+    friend rocblas_status(::rocblas_get_stream_order_memory_pool)(_rocblas_handle*, hipMemPool_t*);
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
+    friend rocblas_status(::rocblas_set_solution_index_query)(_rocblas_handle*, rocblas_int*);
     friend rocblas_status(::rocblas_set_performance_metric)(_rocblas_handle*,
                                                             rocblas_performance_metric);
     friend rocblas_status(::rocblas_get_performance_metric)(_rocblas_handle*,
@@ -297,6 +304,12 @@ public:
         return solution_fitness_query;
     }
 
+    // Get the selected solution index query
+    auto* get_solution_index_query() const
+    {
+        return solution_index_query;
+    }
+
     void set_stream_order_memory_allocation(bool flag)
     {
         stream_order_alloc = flag;
@@ -347,6 +360,26 @@ public:
         return stream;
     }
 
+    // Temporarily change the stream, returning object which restores old stream when destroyed
+    auto push_stream(hipStream_t new_stream)
+    {
+        return _pushed_state<hipStream_t>(stream, new_stream);
+    }
+
+    // Address of the handle's device memory workspace available to the next allocation,
+    // which differs from the base address while earlier allocations are still held
+    const void* get_workspace_address() const
+    {
+        return static_cast<const char*>(device_memory) + device_memory_in_use;
+    }
+
+    // Return the cache of captured launch sequences, or nullptr if graph replay is disabled
+    // or workspace is allocated per call by stream order allocation
+    rocblas_graph_cache* get_graph_cache()
+    {
+        return stream_order_alloc ? nullptr : graph_cache.get();
+    }
+
     bool is_stream_in_capture_mode()
     {
         hipStreamCaptureStatus capture_status = hipStreamCaptureStatusNone;
@@ -374,9 +407,38 @@ private:
 
     bool stream_order_alloc = false;
 
+    // Memory pool used for stream order allocation (nullptr selects the device's default pool)
+    hipMemPool_t stream_order_mem_pool = nullptr;
+
+    // Arena reserved by the outermost stream order allocation of an API call. Nested
+    // allocations are carved out of it in LIFO order, tracked by device_memory_in_use.
+    void*  stream_order_arena      = nullptr;
+    size_t stream_order_arena_size = 0;
+
+    // Largest amount of stream order memory simultaneously in use, used to size the arena
+    size_t stream_order_high_water = 0;
+
+// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+    // Stream order allocation from the handle's memory pool
+    hipError_t stream_order_malloc(void** ptr, size_t size, hipStream_t stream_in_use)
+    {
+        return stream_order_mem_pool
+                   ? hipMallocFromPoolAsync(ptr, size, stream_order_mem_pool, stream_in_use)
+                   : hipMallocAsync(ptr, size, stream_in_use);
+    }
+#endif
+
+    // Captured launch sequences of multi-kernel routines, if ROCBLAS_GRAPH_REPLAY is set
+    std::unique_ptr<rocblas_graph_cache> graph_cache;
+
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
+    // Selected solution index query (used for benchmark reporting)
+    rocblas_int* solution_index_query = nullptr;
+
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t stream = 0;
 
@@ -405,10 +467,82 @@ private:
         void*          dev_mem = nullptr;
         hipStream_t    stream_in_use;
         bool           success;
+        bool           from_arena = false;
 
     private:
         std::vector<void*> pointers; // Important: must come last
 
+        // Stream order allocation of size bytes.
+        // The outermost allocation of an API call reserves the handle's arena with a single
+        // hipMallocAsync, sized to the largest amount of memory used by earlier calls, so
+        // nested allocations are carved out of the arena without further hipMallocAsync calls.
+        char* stream_order_allocate()
+        {
+// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+            if(!size)
+                return nullptr;
+
+            size_t in_use = handle->device_memory_in_use;
+            if(!in_use)
+            {
+                size_t arena_size = std::max(size, handle->stream_order_high_water);
+                if(handle->stream_order_malloc(&dev_mem, arena_size, stream_in_use) != hipSuccess)
+                {
+                    dev_mem = nullptr;
+                    success = false;
+                    rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << arena_size << std::endl;
+                    return nullptr;
+                }
+                handle->stream_order_arena      = dev_mem;
+                handle->stream_order_arena_size = arena_size;
+            }
+            else if(!handle->stream_order_arena || size > handle->stream_order_arena_size - in_use)
+            {
+                // The arena is exhausted, so this allocation is made separately and the
+                // arena reserved by the next API call is grown to accommodate it
+                handle->stream_order_high_water = std::max(handle->stream_order_high_water, in_use + size);
+                if(handle->stream_order_malloc(&dev_mem, size, stream_in_use) != hipSuccess)
+                {
+                    dev_mem = nullptr;
+                    success = false;
+                    rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << size << std::endl;
+                    return nullptr;
+                }
+                return static_cast<char*>(dev_mem);
+            }
+
+            char* addr = static_cast<char*>(handle->stream_order_arena) + in_use;
+            handle->device_memory_in_use += size;
+            handle->stream_order_high_water = std::max(handle->stream_order_high_water, handle->device_memory_in_use);
+            from_arena = true;
+            return addr;
+#else
+            success = false;
+            return nullptr;
+#endif
+        }
+
+        // Subtract size from the handle's device_memory_in_use, making sure
+        // it matches the device_memory_in_use when this object was created.
+        void release_device_memory_in_use()
+        {
+            if((handle->device_memory_in_use -= size) != prev_device_memory_in_use)
+            {
+                rocblas_cerr
+                    << "rocBLAS internal error: device_malloc() RAII object not "
+                    "destroyed in LIFO order.\n"
+                    "Objects returned by device_malloc() must be 0-sized, "
+                    "unsuccessfully allocated,\n"
+                    "or destroyed in the reverse order that they are created.\n"
+                    "device_malloc() objects cannot be assigned to unless they are 0-sized\n"
+                    "or they were unsuccessfully allocated previously."
+                    << std::endl;
+                rocblas_abort();
+            }
+        }
+
         // Allocate one or more pointers to buffers of different sizes
         template <typename... Ss>
         decltype(pointers) allocate_pointers(Ss... sizes)
@@ -424,21 +558,11 @@ private:
             if(handle->stream_order_alloc &&
                 handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
             {
-// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
-// Support for default stream added in hip version 5.3.0
-#if HIP_VERSION >= 50300000
-                if(!size)
-                    return decltype(pointers)(sizeof...(sizes));
+                addr = stream_order_allocate();
 
-                hipError_t hipStatus = hipMallocAsync(&dev_mem, size, stream_in_use);
-                if(hipStatus != hipSuccess)
-                {
-                    success = false;
-                    rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << size << std::endl;
+                // If allocation failed or total size is 0, return an array of nullptr's
+                if(!success || !size)
                     return decltype(pointers)(sizeof...(sizes));
-                }
-                addr = static_cast<char*>(dev_mem);
-#endif
             }
             else
             {
@@ -488,14 +612,10 @@ private:
             if(handle->stream_order_alloc &&
                 handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
             {
-// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
-// Support for default stream added in hip version 5.3.0
-#if HIP_VERSION >= 50300000
-                bool status = hipMallocAsync(&dev_mem, size, stream_in_use) == hipSuccess ;
+                char* addr = stream_order_allocate();
 
                 for(auto i= 0 ; i < count ; i++)
-                    pointers.push_back(status ? dev_mem : nullptr);
-#endif
+                    pointers.push_back(addr);
             }
             else
             {
@@ -528,6 +648,7 @@ private:
             , dev_mem(other.dev_mem)
             , stream_in_use(other.stream_in_use)
             , success(other.success)
+            , from_arena(other.from_arena)
             , pointers(std::move(other.pointers))
         {
             other.success = false;
@@ -551,43 +672,37 @@ private:
             // If success == false or size == 0, the destructor is a no-op
             if(success && size)
             {
-                if(handle->stream_order_alloc &&
-                    handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
+                if(dev_mem || from_arena)
                 {
+                    // Stream order allocation, carved out of the handle's arena and/or
+                    // allocated with its own hipMallocAsync
+                    if(from_arena)
+                        release_device_memory_in_use();
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-                        if(dev_mem)
+                    if(dev_mem)
+                    {
+                        if(dev_mem == handle->stream_order_arena)
                         {
+                            handle->stream_order_arena      = nullptr;
+                            handle->stream_order_arena_size = 0;
+                        }
 
-                            bool status = hipFreeAsync(dev_mem, stream_in_use) == hipSuccess ;
-                            if(!status)
-                            {
-                                rocblas_cerr << " rocBLAS internal error: hipFreeAsync() Failed, "
-                                "device memory could not be released to default memory pool" << std::endl;
-                                rocblas_abort();
-                            }
-                            dev_mem = nullptr;
+                        bool status = hipFreeAsync(dev_mem, stream_in_use) == hipSuccess ;
+                        if(!status)
+                        {
+                            rocblas_cerr << " rocBLAS internal error: hipFreeAsync() Failed, "
+                            "device memory could not be released to the memory pool" << std::endl;
+                            rocblas_abort();
                         }
+                        dev_mem = nullptr;
+                    }
 #endif
                 }
                 else
                 {
-                    // Subtract size from the handle's device_memory_in_use, making sure
-                    // it matches the device_memory_in_use when this object was created.
-                    if((handle->device_memory_in_use -= size) != prev_device_memory_in_use)
-                    {
-                        rocblas_cerr
-                            << "rocBLAS internal error: device_malloc() RAII object not "
-                            "destroyed in LIFO order.\n"
-                            "Objects returned by device_malloc() must be 0-sized, "
-                            "unsuccessfully allocated,\n"
-                            "or destroyed in the reverse order that they are created.\n"
-                            "device_malloc() objects cannot be assigned to unless they are 0-sized\n"
-                            "or they were unsuccessfully allocated previously."
-                            << std::endl;
-                        rocblas_abort();
-                    }
+                    release_device_memory_in_use();
                 }
 
                 handle->gsu_workspace_size = 0;
@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+/*******************************************************************************
+ * Key identifying the launch sequence of a multi-kernel routine.
+ *
+ * The shape part (routine name, sizes, modes, strides) selects the cached
+ * hipGraphExec_t. The argument part (device pointers, host scalars and the
+ * address of the handle's workspace left free by allocations still held)
+ * must also match for a graph to be replayed unchanged; otherwise the
+ * sequence is captured again and the kernel node parameters of the cached
+ * hipGraphExec_t are updated in place.
+ ******************************************************************************/
+class rocblas_graph_key
+{
+    std::string m_shape;
+    std::string m_args;
+    bool        m_enabled;
+
+    template <typename T>
+    static void append(std::string& str, const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>{}, "graph key values must be trivially copyable");
+        str.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+public:
+    // The key is left empty when graph replay is disabled on the handle
+    rocblas_graph_key(rocblas_handle handle, const char* name)
+        : m_enabled(handle->get_graph_cache() != nullptr)
+    {
+        if(m_enabled)
+        {
+            m_shape = name;
+            m_shape.push_back('\0');
+        }
+        add_shape(handle->atomics_mode, handle->math_mode, handle->performance_metric);
+        add_args(handle->get_workspace_address());
+    }
+
+    // Values which determine the kernels launched and their launch configuration
+    template <typename... Ts>
+    rocblas_graph_key& add_shape(const Ts&... values)
+    {
+        if(m_enabled)
+            (void)std::initializer_list<int>{(append(m_shape, values), 0)...};
+        return *this;
+    }
+
+    // Values which are only passed to the kernels launched, such as device pointers
+    // and host scalars
+    template <typename... Ts>
+    rocblas_graph_key& add_args(const Ts&... values)
+    {
+        if(m_enabled)
+            (void)std::initializer_list<int>{(append(m_args, values), 0)...};
+        return *this;
+    }
+
+    const std::string& shape() const
+    {
+        return m_shape;
+    }
+
+    const std::string& args() const
+    {
+        return m_args;
+    }
+};
+
+/*******************************************************************************
+ * Per-handle cache of captured launch sequences, enabled by setting the
+ * environment variable ROCBLAS_GRAPH_REPLAY to the maximum number of cached
+ * graphs.
+ ******************************************************************************/
+class rocblas_graph_cache
+{
+public:
+    struct entry
+    {
+        std::string    args;
+        hipGraphExec_t exec       = nullptr;
+        rocblas_status status     = rocblas_status_success;
+        size_t         calls      = 0;
+        uint64_t       last_use   = 0;
+        bool           capturable = true;
+    };
+
+    explicit rocblas_graph_cache(size_t max_entries)
+        : m_max_entries(max_entries)
+    {
+    }
+
+    ~rocblas_graph_cache();
+
+    rocblas_graph_cache(const rocblas_graph_cache&) = delete;
+    rocblas_graph_cache& operator=(const rocblas_graph_cache&) = delete;
+
+    // Find or create the entry for a shape, evicting the least recently used entry if full
+    entry& lookup(const std::string& shape);
+
+    // Stream used for capturing launch sequences, created on first use
+    hipStream_t capture_stream();
+
+    // Instantiate a captured graph, or update the entry's existing hipGraphExec_t with it.
+    // The graph is destroyed. Returns false if the graph cannot be used for replay.
+    bool update(entry& e, const std::string& args, hipGraph_t graph, rocblas_status status);
+
+    // Replay the entry's graph on stream
+    rocblas_status launch(entry& e, hipStream_t stream);
+
+private:
+    std::unordered_map<std::string, entry> m_entries;
+    size_t                                 m_max_entries;
+    uint64_t                               m_tick           = 0;
+    hipStream_t                            m_capture_stream = nullptr;
+};
+
+/*******************************************************************************
+ * Run the launch sequence of a multi-kernel routine, replaying a cached graph
+ * when graph replay is enabled on the handle.
+ *
+ * launch() must enqueue all of its work on handle->get_stream() and must not
+ * depend on device values read back to the host, so it is only used in host
+ * pointer mode. The first call for a shape runs launch() directly, so any
+ * workspace reallocation happens outside of capture. Later calls capture
+ * launch() on a private stream and replay the graph on the handle's stream.
+ * If capture fails, launch() is run directly from then on for that shape.
+ ******************************************************************************/
+template <typename F>
+rocblas_status rocblas_graph_replay(rocblas_handle handle, const rocblas_graph_key& key, F&& launch)
+{
+    rocblas_graph_cache* cache = handle->get_graph_cache();
+    if(!cache || handle->is_device_memory_size_query()
+       || handle->pointer_mode != rocblas_pointer_mode_host || handle->check_numerics
+       || handle->is_stream_in_capture_mode())
+        return launch();
+
+    auto& e = cache->lookup(key.shape());
+    if(e.exec && e.args == key.args())
+        return cache->launch(e, handle->get_stream());
+
+    if(!e.capturable || !e.calls++)
+        return launch();
+
+    hipStream_t    capture_stream = cache->capture_stream();
+    hipGraph_t     graph          = nullptr;
+    rocblas_status status         = rocblas_status_internal_error;
+
+    if(capture_stream
+       && hipStreamBeginCapture(capture_stream, hipStreamCaptureModeThreadLocal) == hipSuccess)
+    {
+        // Launch on the capture stream, restoring the handle's stream on return
+        auto saved_stream = handle->push_stream(capture_stream);
+        try
+        {
+            status = launch();
+        }
+        catch(...)
+        {
+            (void)hipStreamEndCapture(capture_stream, &graph);
+            if(graph)
+                (void)hipGraphDestroy(graph);
+            throw;
+        }
+        if(hipStreamEndCapture(capture_stream, &graph) != hipSuccess)
+            status = rocblas_status_internal_error;
+    }
+
+    if(!cache->update(e, key.args(), graph, status))
+    {
+        e.capturable = false;
+        return launch();
+    }
+
+    return cache->launch(e, handle->get_stream());
+}
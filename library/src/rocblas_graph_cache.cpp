@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocblas_graph_cache.hpp"
+
+/*******************************************************************************
+ * destructor
+ ******************************************************************************/
+rocblas_graph_cache::~rocblas_graph_cache()
+{
+    for(auto& kv : m_entries)
+        if(kv.second.exec)
+            PRINT_IF_HIP_ERROR(hipGraphExecDestroy(kv.second.exec));
+
+    if(m_capture_stream)
+        PRINT_IF_HIP_ERROR(hipStreamDestroy(m_capture_stream));
+}
+
+/*******************************************************************************
+ * Find or create the entry for a shape
+ ******************************************************************************/
+rocblas_graph_cache::entry& rocblas_graph_cache::lookup(const std::string& shape)
+{
+    auto it = m_entries.find(shape);
+    if(it == m_entries.end())
+    {
+        // Evict the least recently used entry when the cache is full
+        if(m_entries.size() >= m_max_entries)
+        {
+            auto lru = m_entries.begin();
+            for(auto e = m_entries.begin(); e != m_entries.end(); ++e)
+                if(e->second.last_use < lru->second.last_use)
+                    lru = e;
+            if(lru->second.exec)
+                PRINT_IF_HIP_ERROR(hipGraphExecDestroy(lru->second.exec));
+            m_entries.erase(lru);
+        }
+        it = m_entries.emplace(shape, entry{}).first;
+    }
+    it->second.last_use = ++m_tick;
+    return it->second;
+}
+
+/*******************************************************************************
+ * Stream used for capturing launch sequences
+ ******************************************************************************/
+hipStream_t rocblas_graph_cache::capture_stream()
+{
+    if(!m_capture_stream
+       && hipStreamCreateWithFlags(&m_capture_stream, hipStreamNonBlocking) != hipSuccess)
+        m_capture_stream = nullptr;
+    return m_capture_stream;
+}
+
+/*******************************************************************************
+ * Instantiate a captured graph, or update the existing hipGraphExec_t with the
+ * kernel node parameters of the newly captured graph
+ ******************************************************************************/
+bool rocblas_graph_cache::update(entry&             e,
+                                 const std::string& args,
+                                 hipGraph_t         graph,
+                                 rocblas_status     status)
+{
+    if(!graph)
+        return false;
+
+    bool success = status == rocblas_status_success || status == rocblas_status_perf_degraded;
+
+    if(success && e.exec)
+    {
+        hipGraphNode_t           error_node;
+        hipGraphExecUpdateResult update_result;
+        if(hipGraphExecUpdate(e.exec, graph, &error_node, &update_result) != hipSuccess
+           || update_result != hipGraphExecUpdateSuccess)
+        {
+            // The topology changed, so the graph must be instantiated again
+            PRINT_IF_HIP_ERROR(hipGraphExecDestroy(e.exec));
+            e.exec = nullptr;
+        }
+    }
+
+    if(success && !e.exec && hipGraphInstantiate(&e.exec, graph, nullptr, nullptr, 0) != hipSuccess)
+    {
+        e.exec  = nullptr;
+        success = false;
+    }
+
+    PRINT_IF_HIP_ERROR(hipGraphDestroy(graph));
+
+    if(success)
+    {
+        e.args   = args;
+        e.status = status;
+    }
+    return success;
+}
+
+/*******************************************************************************
+ * Replay the entry's graph
+ ******************************************************************************/
+rocblas_status rocblas_graph_cache::launch(entry& e, hipStream_t stream)
+{
+    RETURN_IF_HIP_ERROR(hipGraphLaunch(e.exec, stream));
+    return e.status;
+}
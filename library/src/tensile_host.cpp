@@ -44,6 +44,7 @@ extern "C" void rocblas_shutdown();
 #include <Tensile/hip/HipSolutionAdapter.hpp>
 #include <Tensile/hip/HipUtils.hpp>
 #include <atomic>
+#include <chrono>
 #include <complex>
 #include <exception>
 #include <future>
@@ -51,6 +52,7 @@ extern "C" void rocblas_shutdown();
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -272,6 +274,312 @@ namespace
         return Tensile::LazyLoadingInit::None;
     }
 
+    /**************************************************************************
+     * Filter restricting the Tensile sub-libraries which are loaded to a set *
+     * of data type and transposition combinations. Each entry has the form   *
+     * <Ti><To><Tc>[_<transA><transB>], e.g. HHS, BSS_NT or I8II_TN, where    *
+     * the types are H, B, S, D, C, Z, I8 or I, and transposes are N, T or C. *
+     * An entry is matched against the Tensile problem type in the names of   *
+     * the lazy-loading sub-library and code object files. Problems of types  *
+     * which are not listed are rejected while the filter is active.          *
+     **************************************************************************/
+    class TensileLoadFilter
+    {
+    public:
+        struct entry
+        {
+            std::string ti, to, tc; // Type letters
+            std::string transposes; // <transA><transB>, or empty for any transposition
+            std::string type_name; // Problem type in file names
+            std::string trans_name; // Transposition in file names, or empty for any
+        };
+
+    private:
+        std::vector<entry> m_entries;
+
+        static bool parse_type(const std::string& str, size_t& pos, std::string& type)
+        {
+            if(!str.compare(pos, 2, "I8"))
+                type = "I8";
+            else if(pos < str.size() && strchr("HBSDCZI", str[pos]))
+                type = str.substr(pos, 1);
+            else
+                return false;
+            pos += type.size();
+            return true;
+        }
+
+    public:
+        static bool is_complex(const std::string& type)
+        {
+            return type == "C" || type == "Z";
+        }
+
+        // Parse an entry. Conjugate transposes of real types are stored as transposes.
+        static bool parse_entry(const std::string& str, entry& e)
+        {
+            size_t pos = 0;
+            if(!parse_type(str, pos, e.ti) || !parse_type(str, pos, e.to)
+               || !parse_type(str, pos, e.tc))
+                return false;
+
+            // High precision accumulation is used when the compute type differs from the input type
+            e.type_name = "Type_" + e.ti + e.to + (e.tc != e.ti ? "_HPA" : "") + "_Contraction_l_";
+            e.transposes.clear();
+            e.trans_name.clear();
+
+            if(pos == str.size())
+                return true;
+            if(str.size() != pos + 3 || str[pos] != '_')
+                return false;
+
+            static const char* const a_index[] = {"Ailk", "Alik", "AlikC"};
+            static const char* const b_index[] = {"Bljk", "Bjlk", "BjlkC"};
+            for(size_t i = 1; i <= 2; ++i)
+            {
+                char trans = str[pos + i];
+                if(!trans || !strchr("NTC", trans))
+                    return false;
+                e.transposes += trans == 'C' && !is_complex(e.ti) ? 'T' : trans;
+            }
+            e.trans_name = std::string("_") + a_index[strchr("NTC", e.transposes[0]) - "NTC"]
+                           + "_" + b_index[strchr("NTC", e.transposes[1]) - "NTC"] + "_Cijk";
+            return true;
+        }
+
+        // Parse a comma-separated list of entries. Returns false if any entry is invalid.
+        bool set(const char* list)
+        {
+            std::vector<entry> entries;
+            std::string        str   = list ? list : "";
+            size_t             begin = 0;
+            while(begin < str.size())
+            {
+                size_t end = str.find(',', begin);
+                if(end == std::string::npos)
+                    end = str.size();
+                if(end > begin)
+                {
+                    entries.emplace_back();
+                    if(!parse_entry(str.substr(begin, end - begin), entries.back()))
+                        return false;
+                }
+                begin = end + 1;
+            }
+            m_entries = std::move(entries);
+            return true;
+        }
+
+        bool active() const
+        {
+            return !m_entries.empty();
+        }
+
+        const std::vector<entry>& entries() const
+        {
+            return m_entries;
+        }
+
+        // Whether a sub-library or code object file should be loaded. Files which are not
+        // specific to a problem type are always loaded.
+        bool matches(const std::string& file) const
+        {
+            if(!active() || file.find("Type_") == std::string::npos)
+                return true;
+            for(auto& e : m_entries)
+                if(file.find(e.type_name) != std::string::npos
+                   && (e.trans_name.empty() || file.find(e.trans_name) != std::string::npos))
+                    return true;
+            return false;
+        }
+
+        // Whether a problem of a listed type may be solved
+        bool allows(const entry& problem) const
+        {
+            if(!active())
+                return true;
+            for(auto& e : m_entries)
+                if(e.ti == problem.ti && e.to == problem.to && e.tc == problem.tc
+                   && (e.transposes.empty() || e.transposes == problem.transposes))
+                    return true;
+            return false;
+        }
+    };
+
+    // The filter is read from ROCBLAS_TENSILE_LOAD_FILTER unless rocblas_set_tensile_load_filter()
+    // is called before Tensile is initialized
+    TensileLoadFilter& get_tensile_load_filter()
+    {
+        static TensileLoadFilter filter = [] {
+            TensileLoadFilter filter;
+            const char*       env = getenv("ROCBLAS_TENSILE_LOAD_FILTER");
+            if(env && !filter.set(env))
+                rocblas_cerr << "\nrocBLAS warning: Ignoring invalid ROCBLAS_TENSILE_LOAD_FILTER \""
+                             << env << "\"" << std::endl;
+            return filter;
+        }();
+        return filter;
+    }
+
+    /*********************************************************
+     * Statistics of the Tensile files loaded by rocBLAS     *
+     *********************************************************/
+    struct TensileLoadStats
+    {
+        std::atomic<int64_t> files_loaded{0};
+        std::atomic<int64_t> files_skipped{0};
+        std::atomic<int64_t> bytes_loaded{0};
+        std::atomic<int64_t> load_time_us{0};
+
+        void add_file(const std::string& file)
+        {
+            std::error_code ec;
+            auto            size = fs::file_size(file, ec);
+            files_loaded++;
+            if(!ec)
+                bytes_loaded += size;
+        }
+
+        // Directory of the lazy-loading files of a processor, which are counted as they are
+        // loaded. Code objects are loaded lazily unless rocblas_initialize() was called.
+        void set_lazy_path(const std::string& processor,
+                           const std::string& path,
+                           const std::string& skip_xnack,
+                           bool               lazy_code_objects)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            lazy_dirs[processor] = {path, skip_xnack, lazy_code_objects};
+        }
+
+        // Count the lazy-loading sub-library (metadata) or code object files of a problem type
+        // of a processor the first time they are loaded. A type name of "Type_" matches all types.
+        void add_lazy_files(const std::string& processor,
+                            const std::string& type_name,
+                            const std::string& trans_name,
+                            bool               code_objects)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        dir = lazy_dirs.find(processor);
+            if(dir == lazy_dirs.end() || (code_objects && !dir->second.lazy_code_objects)
+               || !counted.insert(processor + (code_objects ? ":co:" : ":dat:") + type_name
+                                  + trans_name)
+                       .second)
+                return;
+
+            std::error_code ec;
+            for(auto& file : fs::directory_iterator(dir->second.path, ec))
+            {
+                std::string name = file.path().filename().string();
+                auto        ext  = name.substr(name.find_last_of('.') + 1);
+                if(name.find(type_name) == std::string::npos
+                   || name.find(trans_name) == std::string::npos
+                   || (ext == "co" || ext == "hsaco") != code_objects
+                   || (name.find(processor) == std::string::npos
+                       && name.find("fallback") == std::string::npos)
+                   || (!dir->second.skip_xnack.empty()
+                       && name.find(dir->second.skip_xnack) != std::string::npos))
+                    continue;
+                add_file(file.path().string());
+            }
+        }
+
+    private:
+        struct lazy_dir
+        {
+            std::string path;
+            std::string skip_xnack;
+            bool        lazy_code_objects;
+        };
+
+        std::mutex                                mutex;
+        std::unordered_map<std::string, lazy_dir> lazy_dirs;
+        std::set<std::string>                     counted;
+    };
+
+    TensileLoadStats& get_tensile_load_stats()
+    {
+        static TensileLoadStats stats;
+        return stats;
+    }
+
+    /**************************************************************************
+     * Type letters of the rocBLAS types in Tensile load filter entries, or    *
+     * nullptr for types which cannot be listed                               *
+     **************************************************************************/
+    template <typename>
+    constexpr const char* tensile_filter_type = nullptr;
+
+    template <>
+    constexpr const char* tensile_filter_type<int8_t> = "I8";
+
+    template <>
+    constexpr const char* tensile_filter_type<int32_t> = "I";
+
+    template <>
+    constexpr const char* tensile_filter_type<rocblas_half> = "H";
+
+    template <>
+    constexpr const char* tensile_filter_type<rocblas_bfloat16> = "B";
+
+    template <>
+    constexpr const char* tensile_filter_type<float> = "S";
+
+    template <>
+    constexpr const char* tensile_filter_type<double> = "D";
+
+    template <>
+    constexpr const char* tensile_filter_type<rocblas_float_complex> = "C";
+
+    template <>
+    constexpr const char* tensile_filter_type<rocblas_double_complex> = "Z";
+
+    /****************************************************************************
+     * Whether the Tensile load filter allows the type and transposes of prob.  *
+     * In lazy loading mode, the code object files of a type and transposition  *
+     * are counted the first time it is used. The result is cached, since the   *
+     * filter cannot change once Tensile is initialized.                        *
+     ****************************************************************************/
+    template <typename TiA, typename To, typename Tc, typename TiB, typename TcA, typename TcB>
+    bool tensileLoadFilterAllows(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
+    {
+        // 0 = not yet checked, 1 = allowed, -1 = rejected, indexed by trans_a and trans_b
+        static std::atomic<int> allowed[3][3];
+
+        auto index = [](rocblas_operation trans) {
+            return trans == rocblas_operation_none ? 0
+                                                   : trans == rocblas_operation_transpose ? 1 : 2;
+        };
+        auto& cached = allowed[index(prob.trans_a)][index(prob.trans_b)];
+        int   state  = cached.load(std::memory_order_relaxed);
+        if(state)
+            return state > 0;
+
+        auto& filter   = get_tensile_load_filter();
+        bool  listable = tensile_filter_type<TiA> && tensile_filter_type<To>
+                        && tensile_filter_type<Tc> && std::is_same<TiA, TiB>{}
+                        && std::is_same<TiA, TcA>{} && std::is_same<TiB, TcB>{};
+
+        TensileLoadFilter::entry problem;
+        if(listable)
+        {
+            auto trans = [](rocblas_operation op) {
+                return !rocblas_is_complex<TiA> && op == rocblas_operation_conjugate_transpose
+                           ? 'T'
+                           : rocblas_transpose_letter(op);
+            };
+            TensileLoadFilter::parse_entry(std::string(tensile_filter_type<TiA>)
+                                               + tensile_filter_type<To> + tensile_filter_type<Tc>
+                                               + "_" + trans(prob.trans_a) + trans(prob.trans_b),
+                                           problem);
+        }
+
+        state = (listable ? filter.allows(problem) : !filter.active()) ? 1 : -1;
+        if(!cached.exchange(state) && listable && state > 0)
+            get_tensile_load_stats().add_lazy_files(
+                rocblas_internal_get_arch_name(), problem.type_name, problem.trans_name, true);
+        return state > 0;
+    }
+
     /*************************************************************************
      * Class for converting alpha and beta between rocBLAS and Tensile types *
      * By default, alpha and beta are the same type as Tc compute_type       *
@@ -566,6 +874,92 @@ namespace
         return inputs;
     }
 
+    /*****************************************************************************
+     * Load the lazy-loading sub-libraries of a Tensile load filter entry, by    *
+     * looking up the solutions of a GEMM problem of each of its transpositions *
+     *****************************************************************************/
+    void preloadFilterEntry(const Tensile::SolutionLibrary<Tensile::ContractionProblem>& library,
+                            const Tensile::Hardware&                                     hardware,
+                            const TensileLoadFilter::entry&                              entry,
+                            const std::string&                                           processor)
+    {
+        static const std::unordered_map<std::string, Tensile::DataType> datatypes = {
+            {"I8", tensile_datatype<int8_t>},
+            {"I", tensile_datatype<int32_t>},
+            {"H", tensile_datatype<rocblas_half>},
+            {"B", tensile_datatype<rocblas_bfloat16>},
+            {"S", tensile_datatype<float>},
+            {"D", tensile_datatype<double>},
+            {"C", tensile_datatype<rocblas_float_complex>},
+            {"Z", tensile_datatype<rocblas_double_complex>},
+        };
+        auto ti = datatypes.at(entry.ti);
+        auto to = datatypes.at(entry.to);
+        auto tc = datatypes.at(entry.tc);
+
+        std::vector<std::string> transposes;
+        if(!entry.transposes.empty())
+            transposes.push_back(entry.transposes);
+        else
+        {
+            std::string ops = TensileLoadFilter::is_complex(entry.ti) ? "NTC" : "NT";
+            for(char trans_a : ops)
+                for(char trans_b : ops)
+                    transposes.push_back({trans_a, trans_b});
+        }
+
+        for(auto& trans : transposes)
+        {
+            // The indices are set up as in ConstructTensileProblem() for a 1x1x1 GEMM
+            Tensile::TensorDescriptor a{ti, {1, 1, 1}, {1, 1, 1}, 0};
+            Tensile::TensorDescriptor b{ti, {1, 1, 1}, {1, 1, 1}, 0};
+            Tensile::TensorDescriptor c{to, {1, 1, 1}, {1, 1, 1}, 0};
+            Tensile::TensorDescriptor d{to, {1, 1, 1}, {1, 1, 1}, 0};
+            Tensile::TensorOps        aops, bops, cops, dops;
+            if(trans[0] == 'C')
+                aops.push_back(Tensile::TensorOp::Type::ComplexConjugate);
+            if(trans[1] == 'C')
+                bops.push_back(Tensile::TensorOp::Type::ComplexConjugate);
+
+            Tensile::ContractionProblem::FreeIndices  freeIndex(2);
+            Tensile::ContractionProblem::BoundIndices boundIndex(1);
+            Tensile::ContractionProblem::BatchIndices batchIndex{{2, 2, 2, 2}};
+            freeIndex[0].isA = true;
+            freeIndex[1].isA = false;
+            freeIndex[0].c = freeIndex[0].d = 0;
+            freeIndex[1].c = freeIndex[1].d = 1;
+
+            freeIndex[0].i  = trans[0] != 'N';
+            boundIndex[0].a = trans[0] == 'N';
+            freeIndex[1].i  = trans[1] == 'N';
+            boundIndex[0].b = trans[1] != 'N';
+
+            Tensile::ContractionProblem problem{a,
+                                                aops,
+                                                b,
+                                                bops,
+                                                c,
+                                                cops,
+                                                d,
+                                                dops,
+                                                freeIndex,
+                                                batchIndex,
+                                                boundIndex,
+                                                value_category(1.0),
+                                                0};
+            problem.setAlphaType(tc);
+            problem.setBetaType(tc);
+            problem.setHighPrecisionAccumulate(entry.tc != entry.ti);
+
+            library.findAllSolutionsMatchingType(problem, hardware);
+
+            TensileLoadFilter::entry loaded;
+            TensileLoadFilter::parse_entry(entry.ti + entry.to + entry.tc + "_" + trans, loaded);
+            get_tensile_load_stats().add_lazy_files(
+                processor, loaded.type_name, loaded.trans_name, false);
+        }
+    }
+
     /**************************************************
      * The TensileHost struct interfaces with Tensile *
      **************************************************/
@@ -783,6 +1177,18 @@ namespace
             else
                 tensile_lazy_load_enabled = true;
 
+            // With a load filter, only the sub-libraries of the listed problem types are loaded,
+            // once the master library is loaded, instead of preloading all of them
+            auto& filter = get_tensile_load_filter();
+            auto& stats  = get_tensile_load_stats();
+            if(tensile_lazy_load_enabled)
+                stats.set_lazy_path(processor, path, skip_xnack, !rocblas_initialize_called());
+            auto  preload = [&](std::vector<Tensile::LazyLoadingInit> archs) {
+                if(tensile_lazy_load_enabled && filter.active())
+                    archs = {Tensile::LazyLoadingInit::None};
+                return archs;
+            };
+
             //Supports multi architecture configuration in lazy library loading mode
             static int initialize_once = [&] {
                 hipDeviceProp_t prop;
@@ -816,7 +1222,7 @@ namespace
                         std::launch::async,
                         Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
                         tensileLibraryPath,
-                        std::vector<Tensile::LazyLoadingInit>{Tensile::LazyLoadingInit::All});
+                        preload({Tensile::LazyLoadingInit::All}));
                     return 0;
                 }();
 
@@ -839,7 +1245,13 @@ namespace
                         // Skip experimental libraries
                         if(codeObjectFile.find("Experimental") != std::string::npos)
                             continue;
+                        if(!filter.matches(codeObjectFile))
+                        {
+                            stats.files_skipped++;
+                            continue;
+                        }
                         adapter.loadCodeObjectFile(codeObjectFile.c_str());
+                        stats.add_file(codeObjectFile);
                     } while(FindNextFileA(hfine, &finddata));
                 }
                 else
@@ -859,7 +1271,13 @@ namespace
                             continue;
                         if(cofile.find("Experimental") != std::string::npos)
                             continue;
+                        if(!filter.matches(cofile))
+                        {
+                            stats.files_skipped++;
+                            continue;
+                        }
                         adapter.loadCodeObjectFile(cofile);
+                        stats.add_file(cofile);
                     }
                 }
                 else if(g == GLOB_NOMATCH)
@@ -895,8 +1313,7 @@ namespace
                         = std::async(std::launch::async,
                                      Tensile::LoadLibraryFilePreload<Tensile::ContractionProblem>,
                                      tensileLibraryPath,
-                                     std::vector<Tensile::LazyLoadingInit>{tensileDeviceSet.begin(),
-                                                                           tensileDeviceSet.end()});
+                                     preload({tensileDeviceSet.begin(), tensileDeviceSet.end()}));
                     return 0;
                 }();
             }
@@ -907,6 +1324,7 @@ namespace
 
                 static int once = [&] {
                     auto lib = ftr_lib.get();
+                    stats.add_file(tensileLibraryPath);
                     if(!lib)
                         rocblas_cerr << "\nrocBLAS error: Could not load " << tensileLibraryPath
                                      << std::endl;
@@ -914,6 +1332,19 @@ namespace
                     {
                         using MSL = Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>;
                         m_library = std::dynamic_pointer_cast<MSL>(lib);
+
+                        if(m_library && tensile_lazy_load_enabled)
+                        {
+                            if(filter.active())
+                            {
+                                auto hardware
+                                    = Tensile::hip::GetDevice(*get_device_property(processor));
+                                for(auto& entry : filter.entries())
+                                    preloadFilterEntry(*m_library, *hardware, entry, processor);
+                            }
+                            else
+                                stats.add_lazy_files(processor, "Type_", "", false);
+                        }
                     }
                     return 0;
                 }();
@@ -944,6 +1375,13 @@ namespace
         }
     };
 
+    // TensileHost is initialized on the first call
+    TensileHost& get_tensile_host()
+    {
+        static TensileHost host;
+        return host;
+    }
+
     // Return the library and adapter for the current HIP device
     auto& get_library_and_adapter(
         std::shared_ptr<Tensile::MasterSolutionLibrary<Tensile::ContractionProblem>>* library
@@ -952,8 +1390,7 @@ namespace
         int                               device     = -1)
     try
     {
-        // TensileHost is initialized on the first call
-        static TensileHost host;
+        auto& host = get_tensile_host();
 
         if(device == -1)
             hipGetDevice(&device);
@@ -975,7 +1412,12 @@ namespace
                 adapter = new Tensile::hip::SolutionAdapter;
 
                 // Initialize the adapter and possibly the library
+                auto start = std::chrono::steady_clock::now();
                 host.initialize(*adapter, device);
+                get_tensile_load_stats().load_time_us
+                    += std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
 
                 // Atomically change the adapter stored for this device ID
                 a.adapter.store(adapter, std::memory_order_release);
@@ -1004,6 +1446,29 @@ namespace
         rocblas_abort();
     }
 
+    /*********************************************************************
+     * Background initialization started by rocblas_initialize_async().  *
+     * A GEMM on a device being initialized blocks on that device's      *
+     * adapter mutex in get_library_and_adapter() until it is complete.  *
+     *********************************************************************/
+    struct async_initialization
+    {
+        std::mutex                            mutex;
+        std::vector<bool>                     requested;
+        std::vector<std::shared_future<void>> pending;
+        std::atomic<int>                      initialized{0};
+        std::atomic<int>                      requests{0};
+    };
+
+    async_initialization& get_async_initialization()
+    {
+        // Construct TensileHost first, so that it is destroyed after any pending
+        // initializations have been waited for at exit
+        get_tensile_host();
+        static async_initialization init;
+        return init;
+    }
+
     /**************************************************************************
     * We normally print error messages only once, to avoid excessive logging *
     **************************************************************************/
@@ -1061,6 +1526,14 @@ rocblas_status
 
         auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
 
+        if(!tensileLoadFilterAllows(prob))
+        {
+            rocblas_internal_ostream msg;
+            print_once(msg << "\nrocBLAS error: Problem type excluded by the Tensile load filter "
+                           << prob);
+            return rocblas_status_not_implemented;
+        }
+
         hardware = Tensile::hip::GetDevice(*deviceProp);
 
         auto  tensile_prob  = ConstructTensileProblem(prob);
@@ -1100,6 +1573,9 @@ rocblas_status
         }
         else
         {
+            if(auto* index_query = handle->get_solution_index_query())
+                *index_query = solution->index + 1;
+
             if(fitness_query)
             {
                 status = rocblas_status_success;
@@ -1166,7 +1642,11 @@ rocblas_status getAllSolutions(const RocblasContractionProblem<TiA, To, Tc, TiB,
         std::shared_ptr<Tensile::Hardware>                                           hardware;
 
         auto& adapter = get_library_and_adapter(&library, &deviceProp, prob.handle->getDevice());
-        hardware      = Tensile::hip::GetDevice(*deviceProp);
+
+        if(!tensileLoadFilterAllows(prob))
+            return rocblas_status_not_implemented;
+
+        hardware          = Tensile::hip::GetDevice(*deviceProp);
         auto tensile_prob = ConstructTensileProblem(prob);
 
         if(option == CAN_SOLVE)
@@ -1227,6 +1707,138 @@ extern "C" void rocblas_initialize()
     get_library_and_adapter();
 }
 
+/*****************************************************************************
+ * ! \brief  Start initializing rocBLAS on a list of HIP devices on         *
+ * background threads. Each thread selects its device and performs the same *
+ * initialization as rocblas_initialize().                                   *
+ *****************************************************************************/
+extern "C" rocblas_status rocblas_initialize_async(const rocblas_initialize_options* options)
+try
+{
+    int count = TensileHost::GetDeviceCount();
+
+    std::vector<int> devices;
+    if(options && options->devices)
+    {
+        if(options->device_count < 0)
+            return rocblas_status_invalid_value;
+        devices.assign(options->devices, options->devices + options->device_count);
+        for(int device : devices)
+            if(device < 0 || device >= count)
+                return rocblas_status_invalid_value;
+    }
+    else
+    {
+        for(int device = 0; device < count; ++device)
+            devices.push_back(device);
+    }
+
+    rocblas_initialize_called() = true;
+
+    auto&                       init = get_async_initialization();
+    std::lock_guard<std::mutex> lock(init.mutex);
+    init.requested.resize(count);
+
+    for(int device : devices)
+    {
+        if(init.requested[device])
+            continue;
+        init.requested[device] = true;
+        init.requests++;
+
+        auto initialize_device = [device, &init] {
+            if(hipSetDevice(device) == hipSuccess)
+                get_library_and_adapter(nullptr, nullptr, device);
+            init.initialized++;
+        };
+        init.pending.push_back(std::async(std::launch::async, initialize_device).share());
+    }
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/**************************************************************************
+ * ! \brief  Query the progress of rocblas_initialize_async() requests.  *
+ **************************************************************************/
+extern "C" rocblas_status rocblas_initialize_query(int* devices_initialized,
+                                                   int* devices_requested)
+try
+{
+    if(!devices_initialized || !devices_requested)
+        return rocblas_status_invalid_pointer;
+
+    auto& init           = get_async_initialization();
+    *devices_requested   = init.requests;
+    *devices_initialized = init.initialized;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/****************************************************************
+ * ! \brief  Wait for rocblas_initialize_async() to complete.  *
+ ****************************************************************/
+extern "C" rocblas_status rocblas_initialize_wait()
+try
+{
+    auto&                                 init = get_async_initialization();
+    std::vector<std::shared_future<void>> pending;
+    {
+        std::lock_guard<std::mutex> lock(init.mutex);
+        pending = init.pending;
+    }
+    for(auto& p : pending)
+        p.get();
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*****************************************************************************
+ * ! \brief  Restrict the Tensile sub-libraries which are loaded to a list of *
+ * data type and transposition combinations, before Tensile is initialized.  *
+ *****************************************************************************/
+extern "C" rocblas_status rocblas_set_tensile_load_filter(const char* filter)
+try
+{
+    if(rocblas_internal_tensile_is_initialized())
+        return rocblas_status_invalid_value;
+    return get_tensile_load_filter().set(filter) ? rocblas_status_success
+                                                 : rocblas_status_invalid_value;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*****************************************************************
+ * ! \brief  Report statistics of the Tensile files loaded so far *
+ *****************************************************************/
+extern "C" rocblas_status rocblas_get_tensile_load_stats(rocblas_tensile_load_stats* stats)
+try
+{
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    auto& s              = get_tensile_load_stats();
+    stats->files_loaded  = s.files_loaded;
+    stats->files_skipped = s.files_skipped;
+    stats->bytes_loaded  = s.bytes_loaded;
+    stats->load_time_ms  = s.load_time_us * 1e-3;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /******************************************************************************
  * Intantiate the cases of runContractionProblem which are needed to satisfy  *
  * rocBLAS dependencies. This file's template functions are not defined in a  *